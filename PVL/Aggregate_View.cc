@@ -0,0 +1,1249 @@
+/*	Aggregate_View
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"Aggregate_View.hh"
+#include	"Value.hh"
+#include	"Parser.hh"
+#include	"Lister.hh"
+#include	"PVL_Exceptions.hh"
+
+#include	<string>
+#include	<vector>
+#include	<sstream>
+#include	<memory>
+#include	<cstring>
+#include	<cctype>
+#include	<cerrno>
+
+#if defined (_WIN32)
+#include	<fstream>
+#include	<iterator>
+#else
+#include	<sys/types.h>
+#include	<sys/stat.h>
+#include	<sys/mman.h>
+#include	<fcntl.h>
+#include	<unistd.h>
+#endif
+using std::string;
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Aggregate_View
+*/
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Aggregate_View::ID =
+		"idaeim::PVL::Aggregate_View (1.0 2026/10/18)";
+
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+inline bool
+same_character
+	(
+	char	character_1,
+	char	character_2,
+	bool	case_sensitive
+	)
+{
+return
+	character_1 == character_2 ||
+	(! case_sensitive && toupper (character_1) == toupper (character_2));
+}
+}	//	Local namespace
+
+/*==============================================================================
+	View_Image
+*/
+/*	The encoding that is viewed.
+
+	Only the header is checked when the image is constructed. Every
+	other read is checked against the bounds of the encoding when it
+	occurs.
+*/
+struct View_Image
+{
+typedef Binary::Count	Count;
+
+const char
+	*Data,
+	*Strings,
+	*Nodes,
+	*End;
+Count
+	Total_Strings;
+
+//	Where memory mapping is not available the encoding is held here.
+string
+	Buffer;
+
+//	The memory mapped file, if any.
+void
+	*Map;
+std::size_t
+	Map_Size;
+
+
+View_Image
+	(
+	const char*		data,
+	std::size_t		size,
+	void*			map = NULL
+	)
+	:	Data (data),
+		End (data + size),
+		Map (map),
+		Map_Size (size)
+{header ();}
+
+
+explicit View_Image
+	(
+	string&		buffer
+	)
+	:	Map (NULL),
+		Map_Size (0)
+{
+Buffer.swap (buffer);
+Data = Buffer.data ();
+End = Data + Buffer.size ();
+header ();
+}
+
+
+~View_Image ()
+{
+#if ! defined (_WIN32)
+if (Map)
+	munmap (Map, Map_Size);
+#endif
+}
+
+
+void
+invalid
+	(
+	const char*		location,
+	const string&	message
+	) const
+{throw Invalid_Syntax (message, (int)(location - Data), Aggregate_View::ID);}
+
+
+template<typename T>
+T
+get
+	(
+	const char*		location
+	) const
+{
+if (location < Data ||
+	location > End ||
+	(std::size_t)(End - location) < sizeof (T))
+	invalid (location, "The encoding is truncated.");
+T
+	datum;
+std::memcpy (&datum, location, sizeof (T));
+return datum;
+}
+
+
+void
+header ()
+{
+if ((std::size_t)(End - Data) < Binary::HEADER_SIZE)
+	invalid (Data, "The encoding is truncated.");
+if (std::memcmp (Data, Binary::MAGIC, sizeof (Binary::MAGIC)))
+	invalid (Data, "Not a binary PVL encoding.");
+if (get<unsigned short> (Data + Binary::VERSION_OFFSET) != Binary::VERSION)
+	{
+	std::ostringstream
+		message;
+	message << "Unsupported binary PVL version "
+			<< get<unsigned short> (Data + Binary::VERSION_OFFSET)
+			<< "; version " << Binary::VERSION << " expected.";
+	invalid (Data + Binary::VERSION_OFFSET, message.str ());
+	}
+if (get<unsigned short> (Data + Binary::BYTE_ORDER_OFFSET)
+		!= Binary::BYTE_ORDER_MARK ||
+	Data[Binary::INTEGER_SIZE_OFFSET] != (char)sizeof (Value::Integer_type) ||
+	Data[Binary::REAL_SIZE_OFFSET] != (char)sizeof (Value::Real_type))
+	invalid (Data + Binary::BYTE_ORDER_OFFSET,
+		"The encoding byte order or data sizes do not match this host.");
+Strings = Data + Binary::HEADER_SIZE;
+if ((std::size_t)(End - Strings)
+		!= get<Count> (Data + Binary::DATA_SIZE_OFFSET))
+	invalid (Data + Binary::DATA_SIZE_OFFSET,
+		"The encoding size does not match the header.");
+Total_Strings = get<Count> (Data + Binary::STRINGS_OFFSET);
+Count
+	node_table = get<Count> (Data + Binary::NODE_TABLE_OFFSET);
+if (! Total_Strings ||
+	Total_Strings > (std::size_t)(End - Strings) / sizeof (Count) ||
+	node_table >= (std::size_t)(End - Strings))
+	invalid (Data + Binary::STRINGS_OFFSET,
+		"The table sizes do not match the encoding size.");
+Nodes = Strings + node_table;
+int
+	type = get<int> (Nodes + Binary::RECORD_TYPE);
+if (type != Parameter::AGGREGATE &&
+	type != Parameter::GROUP &&
+	type != Parameter::OBJECT)
+	invalid (Nodes, "The encoding is not of an Aggregate.");
+}
+
+
+bool
+verify () const
+{
+return
+	get<unsigned int> (Data + Binary::CHECKSUM_OFFSET) ==
+	Binary::checksum (Strings, End - Strings);
+}
+
+
+//	The location of a string table entry and its characters.
+const char*
+string_at
+	(
+	Count	index,
+	Count&	length
+	) const
+{
+if (index >= Total_Strings)
+	invalid (Strings, "Invalid string table index.");
+const char
+	*entry = Strings + get<Count> (Strings + index * sizeof (Count));
+length = get<Count> (entry);
+entry += sizeof (Count);
+if ((std::size_t)(End - entry) < length)
+	invalid (entry, "The encoding is truncated.");
+return entry;
+}
+
+
+string
+string_of
+	(
+	const char*		location
+	) const
+{
+Count
+	length;
+const char
+	*characters = string_at (get<Count> (location), length);
+return string (characters, length);
+}
+
+
+/*	The record of a Parameter's parent; NULL if there is none.
+
+	A parent record always precedes the records it contains.
+*/
+const char*
+parent
+	(
+	const char*		record
+	) const
+{
+Count
+	offset = get<Count> (record + Binary::PARAMETER_PARENT);
+if (offset == Binary::NO_PARENT)
+	return NULL;
+if (offset >= (std::size_t)(record - Nodes))
+	invalid (record + Binary::PARAMETER_PARENT, "Invalid parent offset.");
+return Nodes + offset;
+}
+
+
+/*	The number of records contained by a record.
+
+	Each contained record is at least the minimum size, so the count
+	can not exceed the extent divided by the minimum size.
+*/
+Count
+contained
+	(
+	const char*		record,
+	int				count_offset,
+	int				extent_offset,
+	std::size_t		minimum
+	) const
+{
+Count
+	count = get<Count> (record + count_offset);
+if (count > get<Count> (record + extent_offset) / minimum)
+	invalid (record + count_offset,
+		"The record count does not match the record size.");
+return count;
+}
+
+
+//	Checks that the end of a record is within the encoding.
+const char*
+within
+	(
+	const char*		record,
+	const char*		end
+	) const
+{
+if (end > End ||
+	end < record)
+	invalid (record, "The record size exceeds the encoding.");
+return end;
+}
+
+
+const char*
+value_end
+	(
+	const char*		record
+	) const
+{
+switch (get<int> (record + Binary::RECORD_TYPE))
+	{
+	case Value::INTEGER:
+		return within (record, record + Binary::INTEGER_RECORD_SIZE);
+	case Value::REAL:
+		return within (record, record + Binary::REAL_RECORD_SIZE);
+	case Value::STRING:
+	case Value::IDENTIFIER:
+	case Value::SYMBOL:
+	case Value::TEXT:
+	case Value::DATE_TIME:
+		return within (record, record + Binary::STRING_RECORD_SIZE);
+	case Value::ARRAY:
+	case Value::SET:
+	case Value::SEQUENCE:
+		return within (record, record + Binary::ARRAY_RECORD_SIZE
+			+ get<Count> (record + Binary::ARRAY_EXTENT));
+	}
+invalid (record, "Invalid Value type.");
+return NULL;
+}
+
+
+const char*
+parameter_end
+	(
+	const char*		record
+	) const
+{
+int
+	type = get<int> (record + Binary::RECORD_TYPE);
+if (type & Parameter::AGGREGATE)
+	return within (record, record + Binary::AGGREGATE_RECORD_SIZE
+		+ get<Count> (record + Binary::AGGREGATE_EXTENT));
+if (type & Parameter::ASSIGNMENT)
+	return value_end (record + Binary::PARAMETER_BODY);
+invalid (record, "Invalid Parameter type.");
+return NULL;
+}
+
+private:
+View_Image (const View_Image&);
+View_Image& operator= (const View_Image&);
+};
+#endif	//	DOXYGEN_PROCESSING
+
+/*******************************************************************************
+	Value_View
+*/
+Value_View::Value_View ()
+	:	Record (NULL)
+{}
+
+
+Value_View::Value_View
+	(
+	const std::shared_ptr<const View_Image>&	image,
+	const char*									record
+	)
+	:	Image (image),
+		Record (record)
+{}
+
+
+Value::Type
+Value_View::type () const
+{return (Value::Type)Image->get<int> (Record + Binary::RECORD_TYPE);}
+
+
+std::string
+Value_View::units () const
+{return Image->string_of (Record + Binary::VALUE_UNITS);}
+
+
+int
+Value_View::digits () const
+{
+int
+	digits = Image->get<int> (Record + Binary::VALUE_DIGITS);
+if (! Binary::valid_digits (digits))
+	Image->invalid (Record + Binary::VALUE_DIGITS, "Invalid Value digits.");
+return digits;
+}
+
+
+int
+Value_View::base () const
+{
+int
+	base = Image->get<int> (Record + Binary::VALUE_BASE);
+if (! Binary::valid_base (base))
+	Image->invalid (Record + Binary::VALUE_BASE, "Invalid Value base.");
+return base;
+}
+
+
+bool
+Value_View::is_signed () const
+{
+return
+	! is_Integer () ||
+	Image->get<char> (Record + Binary::INTEGER_SIGNED) != 0;
+}
+
+
+Value_View::operator Value::Integer_type () const
+{
+if (is_Integer ())
+	return Image->get<Value::Integer_type> (Record + Binary::VALUE_DATUM);
+std::unique_ptr<Value>
+	value (materialize ());
+return static_cast<Value::Integer_type>(*value);
+}
+
+
+Value_View::operator Value::Real_type () const
+{
+if (is_Real ())
+	return Image->get<Value::Real_type> (Record + Binary::VALUE_DATUM);
+std::unique_ptr<Value>
+	value (materialize ());
+return static_cast<Value::Real_type>(*value);
+}
+
+
+Value_View::operator Value::String_type () const
+{
+if (is_String ())
+	return Image->string_of (Record + Binary::VALUE_DATUM);
+std::unique_ptr<Value>
+	value (materialize ());
+return static_cast<Value::String_type>(*value);
+}
+
+
+const char*
+Value_View::next () const
+{return Image->value_end (Record);}
+
+/*------------------------------------------------------------------------------
+	Array
+*/
+int
+Value_View::size () const
+{
+return is_Array () ?
+	(int)Image->contained (Record, Binary::ARRAY_COUNT, Binary::ARRAY_EXTENT,
+		Binary::STRING_RECORD_SIZE) : 0;
+}
+
+
+Value_View::const_iterator
+Value_View::begin () const
+{
+if (! Record ||
+	! is_Array ())
+	return end ();
+return const_iterator
+	(Value_View (Image, Record + Binary::ARRAY_RECORD_SIZE));
+}
+
+
+Value_View::const_iterator
+Value_View::end () const
+{
+if (! Record)
+	return const_iterator ();
+return const_iterator (Value_View (Image, next ()));
+}
+
+
+Value_View
+Value_View::operator[]
+	(
+	int		index
+	)
+	const
+{
+if (index < 0 ||
+	index >= size ())
+	{
+	std::ostringstream
+		message;
+	message << "Can't access element " << index << " of a "
+			<< type_name () << " Value with " << size () << " elements.";
+	throw Out_of_Range (message.str (), Aggregate_View::ID);
+	}
+const_iterator
+	element = begin ();
+while (index--)
+	++element;
+return *element;
+}
+
+/*------------------------------------------------------------------------------
+	Materialize
+*/
+Value*
+Value_View::materialize () const
+{
+//	All of the record fields are read before any Value is allocated.
+Value::Type
+	type = this->type ();
+int
+	digits = this->digits (),
+	base = this->base ();
+std::string
+	units = this->units ();
+Value
+	*value;
+switch (type)
+	{
+	case Value::INTEGER:
+		value = new Integer
+			(Image->get<Value::Integer_type> (Record + Binary::VALUE_DATUM),
+			 is_signed (), base, digits);
+		break;
+	case Value::REAL:
+		{
+		unsigned int
+			flags = Image->get<unsigned int>
+				(Record + Binary::REAL_FORMAT_FLAGS);
+		if (! Binary::valid_format_flags (flags))
+			Image->invalid (Record + Binary::REAL_FORMAT_FLAGS,
+				"Invalid Real format flags.");
+		Real
+			*real = new Real
+				(Image->get<Value::Real_type> (Record + Binary::VALUE_DATUM),
+				 digits);
+		real->format_flags ((std::ios::fmtflags)flags);
+		value = real;
+		}
+		break;
+	case Value::STRING:
+	case Value::IDENTIFIER:
+	case Value::SYMBOL:
+	case Value::TEXT:
+	case Value::DATE_TIME:
+		value = new String
+			(Image->string_of (Record + Binary::VALUE_DATUM), type);
+		break;
+	case Value::ARRAY:
+	case Value::SET:
+	case Value::SEQUENCE:
+		{
+		Array
+			*array = new Array (type);
+		value = array;
+		try
+			{
+			array->reserve (size ());
+			for (const_iterator
+					element = begin (),
+					last    = end ();
+				 element != last;
+				 ++element)
+				array->poke_back (element->materialize ());
+			}
+		catch (...)
+			{
+			delete array;
+			throw;
+			}
+		}
+		break;
+	default:
+		Image->invalid (Record, "Invalid Value type.");
+		return NULL;
+	}
+value->units (units);
+value->digits (digits);
+value->base (base);
+return value;
+}
+
+/*******************************************************************************
+	Parameter_View
+*/
+Parameter_View::Parameter_View ()
+	:	Record (NULL)
+{}
+
+
+Parameter_View::Parameter_View
+	(
+	const std::shared_ptr<const View_Image>&	image,
+	const char*									record
+	)
+	:	Image (image),
+		Record (record)
+{}
+
+
+std::string
+Parameter_View::name () const
+{return Image->string_of (Record + Binary::PARAMETER_NAME);}
+
+
+std::string
+Parameter_View::comment () const
+{return Image->string_of (Record + Binary::PARAMETER_COMMENT);}
+
+
+Parameter::Type
+Parameter_View::type () const
+{return (Parameter::Type)Image->get<int> (Record + Binary::RECORD_TYPE);}
+
+
+Parameter::MODE_STATE
+Parameter_View::mode_state
+	(
+	const Parameter::MODE	mode
+	)
+	const
+{
+const char
+	*location = Record + Binary::PARAMETER_MODES + mode;
+char
+	state = Image->get<char> (location);
+if (! Binary::valid_mode_state (state))
+	Image->invalid (location, "Invalid Parameter mode state.");
+return (Parameter::MODE_STATE)state;
+}
+
+
+Aggregate_View
+Parameter_View::parent () const
+{
+const char
+	*record = Image->parent (Record);
+return record ? Aggregate_View (Image, record) : Aggregate_View ();
+}
+
+
+std::string
+Parameter_View::pathname () const
+{
+char
+	delimiter = Parameter::path_delimiter ();
+string
+	path;
+const char
+	*record = Record;
+while (record)
+	{
+	const char
+		*parent = Image->parent (record);
+	path.insert (0, Image->string_of (record + Binary::PARAMETER_NAME));
+	path.insert (0, 1, delimiter);
+	if (! parent ||
+		//	Special case: CONTAINER_NAME qualifies as default root.
+		Image->string_of (parent + Binary::PARAMETER_NAME)
+			== Parser::CONTAINER_NAME)
+		break;
+	record = parent;
+	}
+return path;
+}
+
+
+bool
+Parameter_View::at_pathname
+	(
+	const std::string&		pathname,
+	bool					case_sensitive,
+	const Parameter_View*	root
+	)
+	const
+{
+char
+	delimiter = Parameter::path_delimiter ();
+bool
+	absolute = ! pathname.empty () && pathname[0] == delimiter;
+const char
+	*root_record = (absolute && root) ? root->Record : NULL;
+std::size_t
+	container_length = std::strlen (Parser::CONTAINER_NAME);
+
+/*	The pathname is matched from its end against the pathname of this
+	Parameter, which is produced in reverse, a name at a time, by
+	ascending the parent records; the same as Parameter::at_pathname.
+*/
+string::size_type
+	remaining = pathname.length ();
+const char
+	*record = Record;
+while (true)
+	{
+	Binary::Count
+		length;
+	const char
+		*name = Image->string_at
+			(Image->get<Binary::Count> (record + Binary::PARAMETER_NAME),
+			 length);
+	string::size_type
+		index = length;
+	while (index)
+		{
+		if (! remaining)
+			//	A relative pathname may end after a delimiter in a name.
+			return ! absolute &&
+				same_character (delimiter, name[index - 1], case_sensitive);
+		if (! same_character
+				(name[--index], pathname[--remaining], case_sensitive))
+			return false;
+		}
+	if (! remaining)
+		return ! absolute;
+	if (! same_character
+			(delimiter, pathname[--remaining], case_sensitive))
+		return false;
+
+	const char
+		*parent = Image->parent (record);
+	if (parent == root_record)
+		break;
+	if (! root_record)
+		{
+		//	Special case: CONTAINER_NAME qualifies as default root.
+		const char
+			*parent_name = Image->string_at
+				(Image->get<Binary::Count> (parent + Binary::PARAMETER_NAME),
+				 length);
+		if (length == container_length &&
+			! std::memcmp (parent_name, Parser::CONTAINER_NAME, length))
+			break;
+		}
+	if (! parent)
+		//	The root is not a parent of the Parameter.
+		return false;
+	record = parent;
+	}
+return absolute && ! remaining;
+}
+
+
+Value_View
+Parameter_View::value () const
+{
+if (is_Aggregate ())
+	throw Invalid_Argument
+		(
+		type_name () + " Parameter " + name () + " does not have a Value.",
+		Aggregate_View::ID
+		);
+return Value_View (Image, Record + Binary::PARAMETER_BODY);
+}
+
+
+const char*
+Parameter_View::next () const
+{return Image->parameter_end (Record);}
+
+
+Parameter*
+Parameter_View::materialize () const
+{
+if (is_Aggregate ())
+	return Aggregate_View (*this).materialize ();
+
+//	All of the record fields are read before the Assignment is allocated.
+Parameter::Type
+	type = this->type ();
+std::string
+	name = this->name (),
+	comment = this->comment ();
+Parameter::MODE_STATE
+	mode_states[Parameter::TOTAL_LOCAL_MODES];
+for (int
+		mode = 0;
+	 mode < Parameter::TOTAL_LOCAL_MODES;
+	 mode++)
+	mode_states[mode] = mode_state ((Parameter::MODE)mode);
+std::unique_ptr<Value>
+	value (this->value ().materialize ());
+
+Assignment
+	*assignment = new Assignment (name);
+try
+	{
+	assignment->value (value.release ());
+	assignment->type (type);
+	assignment->comment (comment);
+	for (int
+			mode = 0;
+		 mode < Parameter::TOTAL_LOCAL_MODES;
+		 mode++)
+		assignment->mode_state ((Parameter::MODE)mode, mode_states[mode]);
+	}
+catch (...)
+	{
+	delete assignment;
+	throw;
+	}
+return assignment;
+}
+
+/*******************************************************************************
+	Aggregate_View
+*/
+/*==============================================================================
+	Constructors
+*/
+Aggregate_View::Aggregate_View ()
+{}
+
+
+Aggregate_View::Aggregate_View
+	(
+	const char*		data,
+	std::size_t		size
+	)
+	:	Parameter_View (std::shared_ptr<const View_Image>
+			(new View_Image (data, size)), NULL)
+{Record = Image->Nodes;}
+
+
+Aggregate_View::Aggregate_View
+	(
+	const Parameter_View&	parameter
+	)
+	:	Parameter_View (parameter)
+{
+if (! Record ||
+	! is_Aggregate ())
+	throw Invalid_Argument
+		(
+		Record ?
+			(type_name () + " Parameter " + name () + " is not an Aggregate.") :
+			string ("An invalid Parameter_View is not an Aggregate."),
+		ID
+		);
+}
+
+
+Aggregate_View::Aggregate_View
+	(
+	const std::shared_ptr<const View_Image>&	image,
+	const char*									record
+	)
+	:	Parameter_View (image, record)
+{}
+
+
+Aggregate_View
+Aggregate_View::open
+	(
+	const std::string&	pathname
+	)
+{
+#if defined (_WIN32)
+std::ifstream
+	file (pathname.c_str (), std::ios::in | std::ios::binary);
+if (! file)
+	throw IO_Failure ("Unable to open the binary PVL file " + pathname + '.',
+		ID);
+string
+	buffer
+		((std::istreambuf_iterator<char>(file)),
+		 std::istreambuf_iterator<char>());
+if (file.bad ())
+	throw IO_Failure ("Unable to read the binary PVL file " + pathname + '.',
+		ID);
+std::shared_ptr<const View_Image>
+	image (new View_Image (buffer));
+#else
+int
+	file = ::open (pathname.c_str (), O_RDONLY);
+if (file < 0)
+	throw IO_Failure ("Unable to open the binary PVL file " + pathname
+		+ ": " + std::strerror (errno), ID);
+struct stat
+	status;
+if (fstat (file, &status) < 0)
+	{
+	int
+		error = errno;
+	close (file);
+	throw IO_Failure ("Unable to obtain the size of the binary PVL file "
+		+ pathname + ": " + std::strerror (error), ID);
+	}
+std::size_t
+	size = (std::size_t)status.st_size;
+void
+	*map = NULL;
+if (size)
+	{
+	map = mmap (NULL, size, PROT_READ, MAP_SHARED, file, 0);
+	if (map == MAP_FAILED)
+		{
+		int
+			error = errno;
+		close (file);
+		throw IO_Failure ("Unable to map the binary PVL file "
+			+ pathname + ": " + std::strerror (error), ID);
+		}
+	}
+//	The mapping remains after the file is closed.
+close (file);
+View_Image
+	*view_image;
+try {view_image = new View_Image ((const char*)map, size, map);}
+catch (...)
+	{
+	if (map)
+		munmap (map, size);
+	throw;
+	}
+std::shared_ptr<const View_Image>
+	image (view_image);
+#endif
+return Aggregate_View (image, image->Nodes);
+}
+
+
+bool
+Aggregate_View::verify () const
+{return Image && Image->verify ();}
+
+/*==============================================================================
+	Accessors
+*/
+int
+Aggregate_View::size () const
+{
+return Record ?
+	(int)Image->contained (Record, Binary::AGGREGATE_COUNT,
+		Binary::AGGREGATE_EXTENT, Binary::AGGREGATE_RECORD_SIZE) : 0;
+}
+
+
+const char*
+Aggregate_View::contents_end () const
+{return Image->parameter_end (Record);}
+
+/*==============================================================================
+	Iterators
+*/
+Aggregate_View::const_iterator
+Aggregate_View::begin () const
+{
+if (! Record)
+	return const_iterator ();
+return const_iterator
+	(Parameter_View (Image, Record + Binary::AGGREGATE_RECORD_SIZE));
+}
+
+
+Aggregate_View::const_iterator
+Aggregate_View::end () const
+{
+if (! Record)
+	return const_iterator ();
+return const_iterator (Parameter_View (Image, contents_end ()));
+}
+
+
+Aggregate_View::Depth_Iterator
+Aggregate_View::begin_depth () const
+{return Depth_Iterator (*this);}
+
+
+Aggregate_View::Depth_Iterator
+Aggregate_View::end_depth () const
+{return Depth_Iterator (*this).end_depth ();}
+
+
+Aggregate_View::Depth_Iterator::Depth_Iterator
+	(
+	const Aggregate_View&	aggregate
+	)
+	:	End (NULL)
+{
+if (aggregate.Record)
+	{
+	Current = Parameter_View
+		(aggregate.Image, aggregate.Record + Binary::AGGREGATE_RECORD_SIZE);
+	End = aggregate.contents_end ();
+	}
+}
+
+
+Aggregate_View::Depth_Iterator&
+Aggregate_View::Depth_Iterator::operator++ ()
+{
+/*	The records are in depth-first order: the record following an
+	Aggregate's record is that of its first Parameter, if it has any,
+	otherwise the record following it and its contents.
+*/
+if (Current.is_Aggregate ())
+	Current.Record += Binary::AGGREGATE_RECORD_SIZE;
+else
+	Current.Record = Current.next ();
+if (Current.Record > End)
+	Current.Image->invalid (Current.Record,
+		"The record size exceeds the enclosing Aggregate.");
+return *this;
+}
+
+
+Aggregate_View::Depth_Iterator
+Aggregate_View::Depth_Iterator::end_depth () const
+{
+Depth_Iterator
+	last (*this);
+last.Current.Record = End;
+return last;
+}
+
+/*==============================================================================
+	Find
+*/
+Parameter_View
+Aggregate_View::find
+	(
+	const std::string&	pathname,
+	bool				case_sensitive,
+	int					skip,
+	Parameter::Type		type
+	)
+	const
+{
+if (skip < 0)
+	skip = 0;
+for (Depth_Iterator
+		parameter = begin_depth (),
+		last      = end_depth ();
+	 parameter != last;
+	 ++parameter)
+	if (parameter->is (type) &&
+		parameter->at_pathname (pathname, case_sensitive, this) &&
+		! skip--)
+		return *parameter;
+return Parameter_View ();
+}
+
+
+std::vector<Parameter_View>
+Aggregate_View::find_all
+	(
+	const std::string&	pathname,
+	bool				case_sensitive,
+	Parameter::Type		type
+	)
+	const
+{
+std::vector<Parameter_View>
+	found;
+for (Depth_Iterator
+		parameter = begin_depth (),
+		last      = end_depth ();
+	 parameter != last;
+	 ++parameter)
+	if (parameter->is (type) &&
+		parameter->at_pathname (pathname, case_sensitive, this))
+		found.push_back (*parameter);
+return found;
+}
+
+
+int
+Aggregate_View::find_count
+	(
+	const std::string&	pathname,
+	bool				case_sensitive,
+	Parameter::Type		type
+	)
+	const
+{
+int
+	count = 0;
+for (Depth_Iterator
+		parameter = begin_depth (),
+		last      = end_depth ();
+	 parameter != last;
+	 ++parameter)
+	if (parameter->is (type) &&
+		parameter->at_pathname (pathname, case_sensitive, this))
+		++count;
+return count;
+}
+
+
+void
+Aggregate_View::select
+	(
+	Aggregate::Selection*	selections
+	)
+	const
+{
+if (! selections)
+	return;
+
+for (;
+	 selections->Type;
+	 selections++)
+	{
+	if (! selections->Variable)
+		continue;
+
+	if (selections->Type & Value::ARRAY)
+		{
+		std::ostringstream
+			message;
+		message
+			<< "The selection of pathname "
+				<< selections->Pathname << std::endl
+			<< "specifies the invalid "
+				<< Value::type_name (selections->Type)
+				<< " Value Type (" << selections->Type << ')';
+		throw Invalid_Argument (message.str (), ID);
+		}
+
+	Parameter_View
+		parameter = find (selections->Pathname, false, 0,
+			Parameter::ASSIGNMENT);
+	if (! parameter)
+		continue;
+
+	Value_View
+		value = parameter.value ();
+	Value_View::const_iterator
+		element,
+		last;
+	if (value.is_Array ())
+		{
+		element = value.begin ();
+		last = value.end ();
+		}
+	if (selections->Count <= 0)
+		selections->Count  = 1;
+
+	for (int
+			count = 0;
+		 count < selections->Count &&
+		 (! value.is_Array () || element != last);
+		 )
+		{
+		const Value_View
+			&datum = value.is_Array () ? *element : value;
+		if (datum.is_Integer () &&
+			selections->Type == Value::INTEGER)
+			((Value::Integer_type*)selections->Variable)[count++] =
+				(Value::Integer_type)datum;
+		else
+		if (datum.is_Real () &&
+			selections->Type == Value::REAL)
+			((Value::Real_type*)selections->Variable)[count++] =
+				(Value::Real_type)datum;
+		else
+		if (datum.is_String () &&
+			(selections->Type & Value::STRING))
+			((Value::String_type*)selections->Variable)[count++] =
+				(Value::String_type)datum;
+		if (! value.is_Array ())
+			break;
+		++element;
+		}
+	}
+}
+
+/*==============================================================================
+	Materialize
+*/
+Aggregate*
+Aggregate_View::materialize () const
+{
+Aggregate
+	*aggregate = new Aggregate (name (), type ());
+try
+	{
+	aggregate->reserve (size ());
+	for (const_iterator
+			parameter = begin (),
+			last      = end ();
+		 parameter != last;
+		 ++parameter)
+		aggregate->poke_back (parameter->materialize ());
+	aggregate->comment (comment ());
+	for (int
+			mode = 0;
+		 mode < Parameter::TOTAL_LOCAL_MODES;
+		 mode++)
+		aggregate->mode_state ((Parameter::MODE)mode,
+			mode_state ((Parameter::MODE)mode));
+	}
+catch (...)
+	{
+	delete aggregate;
+	throw;
+	}
+return aggregate;
+}
+
+/*==============================================================================
+	Listing
+*/
+std::ostream&
+operator<<
+	(
+	Lister&					lister,
+	const Parameter_View&	parameter
+	)
+{
+std::unique_ptr<Parameter>
+	materialized (parameter.materialize ());
+return lister << *materialized;
+}
+
+
+std::ostream&
+operator<<
+	(
+	std::ostream&			out,
+	const Parameter_View&	parameter
+	)
+{
+std::unique_ptr<Parameter>
+	materialized (parameter.materialize ());
+return out << *materialized;
+}
+
+}		//	namespace PVL
+}		//	namespace idaeim
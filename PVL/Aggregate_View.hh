@@ -0,0 +1,890 @@
+/*	Aggregate_View
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#ifndef idaeim_PVL_Aggregate_View_hh
+#define idaeim_PVL_Aggregate_View_hh
+
+#include	"Parameter.hh"
+#include	"Binary.hh"
+
+#include	<string>
+#include	<vector>
+#include	<iostream>
+#include	<iterator>
+#include	<memory>
+#include	<cstddef>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+//	Forward references.
+class Lister;
+class Aggregate_View;
+
+#ifndef DOXYGEN_PROCESSING
+//	The encoding shared by all the views of it.
+struct View_Image;
+#endif
+
+/*******************************************************************************
+	Value_View
+*/
+/**	A <i>Value_View</i> is a read-only view of a Value record in a
+	{@link Binary Binary} encoding.
+
+	A Value_View is obtained from the {@link Parameter_View::value()
+	const value} of an Assignment Parameter_View or from the elements of
+	an Array Value_View. It has the same read methods as a Value, but
+	they read the encoding in place; no Value object is constructed
+	unless the Value_View is {@link materialize() const materialized}.
+
+	A Value_View is a small handle that may be freely copied. It keeps
+	the encoding it views available.
+
+	@version	1.0
+	@see	Aggregate_View
+	@see	Value
+*/
+class Value_View
+{
+public:
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs an invalid Value_View.
+
+	An invalid Value_View does not view any Value; it tests false.
+*/
+Value_View ();
+
+/*==============================================================================
+	Accessors
+*/
+/**	Tests if this Value_View views a Value.
+
+	@return	true if this Value_View views a Value; false otherwise.
+*/
+explicit operator bool () const
+	{return Record != NULL;}
+
+/**	Gets the Type of the Value.
+
+	@return	The Value::Type code of the Value.
+*/
+Value::Type type () const;
+
+/**	Gets the name of the Value Type.
+
+	@return	The Value::type_name of the Value's Type.
+*/
+std::string type_name () const
+	{return Value::type_name (type ());}
+
+//!	Tests if the Value is an Integer.
+bool is_Integer () const
+	{return type () == Value::INTEGER;}
+//!	Tests if the Value is a Real.
+bool is_Real () const
+	{return type () == Value::REAL;}
+//!	Tests if the Value is an Integer or a Real.
+bool is_Numeric () const
+	{return (type () & Value::NUMERIC) != 0;}
+//!	Tests if the Value is a String of any Type.
+bool is_String () const
+	{return (type () & Value::STRING) != 0;}
+//!	Tests if the Value is an Array of any Type.
+bool is_Array () const
+	{return (type () & Value::ARRAY) != 0;}
+
+/**	Gets the units description of the Value.
+
+	@return	The units string. This will be empty if the Value has no
+		units.
+*/
+std::string units () const;
+
+/**	Gets the minimum number of digits of the Value representation.
+
+	@return	The digits of the Value.
+	@throws	Invalid_Syntax	If the digits are outside the range 0 to
+		Binary::MAX_DIGITS.
+*/
+int digits () const;
+
+/**	Gets the numeric base of the Value representation.
+
+	@return	The base of the Value.
+	@throws	Invalid_Syntax	If the base is not zero or in the range
+		Value::MIN_BASE to Value::MAX_BASE.
+*/
+int base () const;
+
+/**	Tests if the Value is signed.
+
+	@return	The signedness of an Integer; true for any other Value.
+*/
+bool is_signed () const;
+
+/**	Gets the Value as an integer.
+
+	@return	The Value::Integer_type conversion of the Value.
+	@throws	Invalid_Value	If the Value can not be converted.
+	@see	Value::operator Integer_type()
+*/
+operator Value::Integer_type () const;
+
+/**	Gets the Value as a floating point number.
+
+	@return	The Value::Real_type conversion of the Value.
+	@throws	Invalid_Value	If the Value can not be converted.
+	@see	Value::operator Real_type()
+*/
+operator Value::Real_type () const;
+
+/**	Gets the Value as a string.
+
+	@return	The Value::String_type conversion of the Value.
+	@see	Value::operator String_type()
+*/
+operator Value::String_type () const;
+
+/*==============================================================================
+	Array
+*/
+class const_iterator;
+
+/**	Gets the number of Values in an Array.
+
+	@return	The number of Values in an Array; zero for any other Value.
+*/
+int size () const;
+
+/**	Gets the first Value of an Array.
+
+	@return	A const_iterator positioned at the first Value of an Array.
+		For any other Value this is the end().
+*/
+const_iterator begin () const;
+
+/**	Gets the end of an Array.
+
+	@return	A const_iterator positioned after the last Value of an
+		Array.
+*/
+const_iterator end () const;
+
+/**	Gets a Value of an Array.
+
+	<b>N.B.</b>: The Values of an Array are stepped over from the
+	beginning of the Array to reach the Value at the index.
+
+	@param	index	The index of the Value in the Array.
+	@return	A Value_View of the Value.
+	@throws	Out_of_Range	If this is not an Array or the index is not
+		less than the size of the Array.
+*/
+Value_View operator[] (int index) const;
+
+/*==============================================================================
+	Materialize
+*/
+/**	Constructs the Value that is viewed.
+
+	@return	A pointer to a new Value equal to the Value that was
+		encoded, including any Values it contains. The caller owns the
+		Value.
+*/
+Value* materialize () const;
+
+/*==============================================================================
+	Operators
+*/
+/**	Tests if two Value_Views view the same Value.
+
+	@param	value	The Value_View to compare with.
+	@return	true if both view the same Value record; false otherwise.
+*/
+bool operator== (const Value_View& value) const
+	{return Record == value.Record;}
+
+//!	Tests if two Value_Views view different Values.
+bool operator!= (const Value_View& value) const
+	{return Record != value.Record;}
+
+private:
+
+friend class Parameter_View;
+
+Value_View (const std::shared_ptr<const View_Image>& image,
+	const char* record);
+
+//	The record following this record and the records it contains.
+const char* next () const;
+
+std::shared_ptr<const View_Image>
+	Image;
+const char
+	*Record;
+
+};		//	End of Value_View class.
+
+/*------------------------------------------------------------------------------
+	Value_View::const_iterator
+*/
+/**	A <i>const_iterator</i> steps through the Values of an Array
+	Value_View.
+
+	@see	Value_View
+*/
+class Value_View::const_iterator
+{
+public:
+
+typedef std::forward_iterator_tag	iterator_category;
+typedef Value_View					value_type;
+typedef std::ptrdiff_t				difference_type;
+typedef const Value_View*			pointer;
+typedef const Value_View&			reference;
+
+//!	Constructs an invalid const_iterator.
+const_iterator ()
+	{}
+
+reference operator* () const
+	{return Current;}
+
+pointer operator-> () const
+	{return &Current;}
+
+const_iterator& operator++ ()
+	{Current.Record = Current.next (); return *this;}
+
+const_iterator operator++ (int)
+	{const_iterator previous (*this); ++*this; return previous;}
+
+bool operator== (const const_iterator& other) const
+	{return Current == other.Current;}
+
+bool operator!= (const const_iterator& other) const
+	{return Current != other.Current;}
+
+private:
+
+friend class Value_View;
+
+explicit const_iterator (const Value_View& value)
+	:	Current (value)
+	{}
+
+Value_View
+	Current;
+};
+
+/*******************************************************************************
+	Parameter_View
+*/
+/**	A <i>Parameter_View</i> is a read-only view of a Parameter record
+	in a {@link Binary Binary} encoding.
+
+	A Parameter_View has the read methods of a Parameter, but they read
+	the encoding in place; no Parameter object is constructed unless
+	the Parameter_View is {@link materialize() const materialized}. An
+	Aggregate Parameter is viewed by an Aggregate_View.
+
+	A Parameter_View is a small handle that may be freely copied. It
+	keeps the encoding it views available.
+
+	@version	1.0
+	@see	Aggregate_View
+	@see	Parameter
+*/
+class Parameter_View
+{
+public:
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs an invalid Parameter_View.
+
+	An invalid Parameter_View does not view any Parameter; it tests
+	false.
+*/
+Parameter_View ();
+
+/*==============================================================================
+	Accessors
+*/
+/**	Tests if this Parameter_View views a Parameter.
+
+	@return	true if this Parameter_View views a Parameter; false
+		otherwise.
+*/
+explicit operator bool () const
+	{return Record != NULL;}
+
+/**	Gets the name of the Parameter.
+
+	@return	The Parameter name.
+*/
+std::string name () const;
+
+/**	Gets the comment of the Parameter.
+
+	@return	The Parameter comment. This will be empty if the Parameter
+		has no comment.
+*/
+std::string comment () const;
+
+/**	Gets the Type of the Parameter.
+
+	@return	The Parameter::Type code of the Parameter.
+*/
+Parameter::Type type () const;
+
+/**	Gets the name of the Parameter Type.
+
+	@return	The Parameter::type_name of the Parameter's Type.
+*/
+std::string type_name () const
+	{return Parameter::type_name (type ());}
+
+/**	Tests the Parameter Type.
+
+	@param	type	The Parameter::Type specification to test.
+	@return	true if the Parameter's Type is included in the type
+		specification; false otherwise.
+	@see	Parameter::is(const Type)
+*/
+bool is (const Parameter::Type type) const
+	{return (this->type () & type) != 0;}
+
+//!	Tests if the Parameter is an Aggregate.
+bool is_Aggregate () const
+	{return is (Parameter::AGGREGATE);}
+//!	Tests if the Parameter is an Assignment.
+bool is_Assignment () const
+	{return is (Parameter::ASSIGNMENT);}
+//!	Tests if the Parameter is a TOKEN Assignment.
+bool is_Token () const
+	{return type () == Parameter::TOKEN;}
+//!	Tests if the Parameter is a GROUP Aggregate.
+bool is_Group () const
+	{return type () == Parameter::GROUP;}
+//!	Tests if the Parameter is an OBJECT Aggregate.
+bool is_Object () const
+	{return type () == Parameter::OBJECT;}
+
+/**	Gets the local state of a syntax mode.
+
+	@param	mode	The selected Parameter::MODE.
+	@return	The Parameter::MODE_STATE of the LOCAL_MODE_SET.
+	@throws	Invalid_Syntax	If the encoded state is not a
+		Parameter::MODE_STATE.
+*/
+Parameter::MODE_STATE mode_state (const Parameter::MODE mode) const;
+
+/**	Gets the Aggregate that contains the Parameter.
+
+	@return	An Aggregate_View of the parent Aggregate. This is invalid
+		for the encoded Aggregate.
+*/
+Aggregate_View parent () const;
+
+/**	Gets the pathname of the Parameter.
+
+	The pathname is formed the same way as the {@link
+	Parameter::pathname(const Parameter*) const pathname} of a
+	Parameter: it is absolute from the encoded Aggregate or, if its
+	name is the Parser::CONTAINER_NAME, from the Aggregate it contains.
+
+	@return	The pathname of the Parameter.
+*/
+std::string pathname () const;
+
+/**	Tests if the Parameter is at a pathname.
+
+	@param	pathname	A relative or absolute pathname.
+	@param	case_sensitive	If true, the names are compared case
+		sensitively; case insensitive otherwise.
+	@param	root	The Aggregate_View from which an absolute pathname
+		starts. If NULL the absolute pathname starts from the root of
+		the encoding.
+	@return	true if the Parameter is at the pathname; false otherwise.
+	@see	Parameter::at_pathname(const std::string&, bool,
+		const Parameter*) const
+*/
+bool at_pathname (const std::string& pathname, bool case_sensitive = false,
+	const Parameter_View* root = NULL) const;
+
+/**	Gets the Value of an Assignment.
+
+	@return	A Value_View of the Assignment Value.
+	@throws	Invalid_Argument	If the Parameter is an Aggregate.
+*/
+Value_View value () const;
+
+/*==============================================================================
+	Materialize
+*/
+/**	Constructs the Parameter that is viewed.
+
+	@return	A pointer to a new Parameter equal to the Parameter that was
+		encoded, including all the Parameters and Values it contains.
+		The caller owns the Parameter.
+*/
+Parameter* materialize () const;
+
+/*==============================================================================
+	Operators
+*/
+/**	Tests if two Parameter_Views view the same Parameter.
+
+	@param	parameter	The Parameter_View to compare with.
+	@return	true if both view the same Parameter record; false
+		otherwise.
+*/
+bool operator== (const Parameter_View& parameter) const
+	{return Record == parameter.Record;}
+
+//!	Tests if two Parameter_Views view different Parameters.
+bool operator!= (const Parameter_View& parameter) const
+	{return Record != parameter.Record;}
+
+protected:
+
+friend class Aggregate_View;
+
+Parameter_View (const std::shared_ptr<const View_Image>& image,
+	const char* record);
+
+//	The record following this record and the records it contains.
+const char* next () const;
+
+std::shared_ptr<const View_Image>
+	Image;
+const char
+	*Record;
+
+};		//	End of Parameter_View class.
+
+/*******************************************************************************
+	Aggregate_View
+*/
+/**	An <i>Aggregate_View</i> is a read-only view of an Aggregate
+	hierarchy in a {@link Binary Binary} encoding that is read in place.
+
+	An encoding - typically a cache file of many labels - is {@link
+	open(const std::string&) opened} by memory mapping the file. Opening
+	only checks the encoding header, so it takes the same small time
+	regardless of the size of the file, and no memory is used for the
+	encoding other than the pages of the file that are actually read.
+	Since the mapping is read-only and shared, those pages are shared
+	through the system page cache by all processes that open the same
+	file. An encoding that is already in memory can also be viewed
+	directly.
+
+	The Aggregate_View has the common read methods of an Aggregate:
+	iteration over the Parameters it contains, depth-first traversal
+	with a {@link Depth_Iterator Depth_Iterator}, {@link find(const
+	std::string&, bool, int, Parameter::Type) const find}, {@link
+	find_all(const std::string&, bool, Parameter::Type) const
+	find_all}, {@link select(Aggregate::Selection*) const select} and
+	listing with a Lister. The Parameters are viewed by Parameter_View
+	objects - Aggregate_View for Aggregates - and their Values by
+	Value_View objects; these are small handles to records in the
+	encoding that read the records in place. Each record contains the
+	size of the records it contains and the location of its parent's
+	record, so stepping from a Parameter to the next, to the next
+	sibling, or to the parent all take constant time.
+
+	Because the encoding is read without decoding it, the checksum is
+	only checked when the encoding is {@link verify() const verified}.
+	Every read is checked against the bounds of the encoding, so a
+	corrupt encoding results in an Invalid_Syntax exception rather than
+	an invalid memory access.
+
+	The views of an encoding keep it open; it is closed, or unmapped,
+	when the last view of it is destroyed. Views are read-only and
+	may be used by any number of threads at the same time.
+
+	@version	1.0
+	@see	Binary
+	@see	Aggregate
+*/
+class Aggregate_View
+:	public Parameter_View
+{
+public:
+/*==============================================================================
+	Constants:
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs an invalid Aggregate_View.
+
+	An invalid Aggregate_View does not view any Aggregate; it tests
+	false.
+*/
+Aggregate_View ();
+
+/**	Constructs a view of a Binary encoding in memory.
+
+	<b>N.B.</b>: The encoding is not copied; it must remain unchanged
+	while any view of it exists.
+
+	@param	data	A pointer to the encoding.
+	@param	size	The size of the encoding.
+	@throws	Invalid_Syntax	If the encoding header is not valid for
+		this host.
+*/
+Aggregate_View (const char* data, std::size_t size);
+
+/**	Converts a Parameter_View of an Aggregate to an Aggregate_View.
+
+	@param	parameter	A Parameter_View of an Aggregate.
+	@throws	Invalid_Argument	If the Parameter is not an Aggregate.
+*/
+explicit Aggregate_View (const Parameter_View& parameter);
+
+/**	Opens a file containing a Binary encoding.
+
+	The file is memory mapped read-only. Where memory mapping is not
+	available the file is read into memory.
+
+	@param	pathname	The pathname of the file.
+	@return	An Aggregate_View of the encoded Aggregate.
+	@throws	IO_Failure	If the file can not be opened or mapped.
+	@throws	Invalid_Syntax	If the encoding header is not valid for
+		this host.
+*/
+static Aggregate_View open (const std::string& pathname);
+
+/**	Verifies the checksum of the encoding.
+
+	<b>N.B.</b>: The entire encoding is read.
+
+	@return	true if the checksum of the encoding is correct; false
+		otherwise.
+*/
+bool verify () const;
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the number of Parameters contained by the Aggregate.
+
+	@return	The number of Parameters immediately contained by the
+		Aggregate.
+*/
+int size () const;
+
+/**	Tests if the Aggregate is empty.
+
+	@return	true if the Aggregate does not contain any Parameters.
+*/
+bool empty () const
+	{return ! size ();}
+
+/*==============================================================================
+	Iterators
+*/
+class const_iterator;
+class Depth_Iterator;
+
+/**	Gets the first Parameter contained by the Aggregate.
+
+	@return	A const_iterator positioned at the first Parameter.
+*/
+const_iterator begin () const;
+
+/**	Gets the end of the Parameters contained by the Aggregate.
+
+	@return	A const_iterator positioned after the last Parameter.
+*/
+const_iterator end () const;
+
+/**	Gets the first Parameter in depth-first order.
+
+	@return	A Depth_Iterator positioned at the first Parameter
+		contained by the Aggregate.
+*/
+Depth_Iterator begin_depth () const;
+
+/**	Gets the end of the depth-first order.
+
+	@return	A Depth_Iterator positioned after the last Parameter
+		contained by the Aggregate hierarchy.
+*/
+Depth_Iterator end_depth () const;
+
+/*==============================================================================
+	Find
+*/
+/**	Finds a Parameter at a pathname.
+
+	The Parameter is matched exactly as by the {@link
+	Aggregate::find(const std::string&, bool, int, Parameter::Type) const
+	find} method of an Aggregate.
+
+	@param	pathname	The relative or absolute pathname of the
+		Parameter.
+	@param	case_sensitive	If true, the name search is case
+		sensitive; case insensitive otherwise.
+	@param	skip		The number of matching Parameters to skip.
+	@param	type		A Type code that specifies the type of Parameter
+		that is to be selected.
+	@return	A Parameter_View of the matching Parameter. This is invalid
+		if no Parameter matches.
+*/
+Parameter_View find
+	(
+	const std::string&	pathname,
+	bool				case_sensitive = false,
+	int					skip = 0,
+	Parameter::Type		type =
+		(Parameter::Type)(Parameter::ASSIGNMENT | Parameter::AGGREGATE)
+	)
+	const;
+
+/**	Finds all the Parameters at a pathname.
+
+	@param	pathname	The relative or absolute pathname of the
+		Parameters.
+	@param	case_sensitive	If true, the name search is case
+		sensitive; case insensitive otherwise.
+	@param	type		A Type code that specifies the type of Parameter
+		that is to be selected.
+	@return	A vector of Parameter_Views of the matching Parameters in
+		depth-first order.
+	@see	find(const std::string&, bool, int, Parameter::Type) const
+*/
+std::vector<Parameter_View> find_all
+	(
+	const std::string&	pathname,
+	bool				case_sensitive = false,
+	Parameter::Type		type =
+		(Parameter::Type)(Parameter::ASSIGNMENT | Parameter::AGGREGATE)
+	)
+	const;
+
+/**	Counts the Parameters at a pathname.
+
+	@param	pathname	The relative or absolute pathname of the
+		Parameters.
+	@param	case_sensitive	If true, the name search is case
+		sensitive; case insensitive otherwise.
+	@param	type		A Type code that specifies the type of Parameter
+		that is to be counted.
+	@return	The number of Parameters that find_all would obtain.
+*/
+int find_count
+	(
+	const std::string&	pathname,
+	bool				case_sensitive = false,
+	Parameter::Type		type =
+		(Parameter::Type)(Parameter::ASSIGNMENT | Parameter::AGGREGATE)
+	)
+	const;
+
+/**	Obtains the Values of selected Parameters.
+
+	The Selections are resolved and their variables are set exactly as
+	by the {@link Aggregate::select(Aggregate::Selection*) const select}
+	method of an Aggregate.
+
+	@param	selections	An array of Aggregate::Selection structures
+		terminated by an empty Selection.
+	@throws	Invalid_Argument	If a Selection specifies an Array Type.
+*/
+void select (Aggregate::Selection* selections) const;
+
+/*==============================================================================
+	Materialize
+*/
+/**	Constructs the Aggregate that is viewed.
+
+	@return	A pointer to a new Aggregate equal to the Aggregate that was
+		encoded. The caller owns the Aggregate.
+*/
+Aggregate* materialize () const;
+
+private:
+
+friend class Parameter_View;
+
+Aggregate_View (const std::shared_ptr<const View_Image>& image,
+	const char* record);
+
+//	The first record following the records contained by the Aggregate.
+const char* contents_end () const;
+
+};		//	End of Aggregate_View class.
+
+/*------------------------------------------------------------------------------
+	Aggregate_View::const_iterator
+*/
+/**	A <i>const_iterator</i> steps through the Parameters immediately
+	contained by an Aggregate_View.
+
+	@see	Aggregate_View
+*/
+class Aggregate_View::const_iterator
+{
+public:
+
+typedef std::forward_iterator_tag	iterator_category;
+typedef Parameter_View				value_type;
+typedef std::ptrdiff_t				difference_type;
+typedef const Parameter_View*		pointer;
+typedef const Parameter_View&		reference;
+
+//!	Constructs an invalid const_iterator.
+const_iterator ()
+	{}
+
+reference operator* () const
+	{return Current;}
+
+pointer operator-> () const
+	{return &Current;}
+
+const_iterator& operator++ ()
+	{Current.Record = Current.next (); return *this;}
+
+const_iterator operator++ (int)
+	{const_iterator previous (*this); ++*this; return previous;}
+
+bool operator== (const const_iterator& other) const
+	{return Current == other.Current;}
+
+bool operator!= (const const_iterator& other) const
+	{return Current != other.Current;}
+
+private:
+
+friend class Aggregate_View;
+
+explicit const_iterator (const Parameter_View& parameter)
+	:	Current (parameter)
+	{}
+
+Parameter_View
+	Current;
+};
+
+/*------------------------------------------------------------------------------
+	Aggregate_View::Depth_Iterator
+*/
+/**	A <i>Depth_Iterator</i> steps through all the Parameters of an
+	Aggregate_View hierarchy in depth-first order.
+
+	The order is the same as that of an Aggregate::Depth_Iterator: each
+	Aggregate is followed by the Parameters it contains. Since the
+	records of the encoding are in this order each step takes constant
+	time.
+
+	@see	Aggregate_View
+*/
+class Aggregate_View::Depth_Iterator
+{
+public:
+
+typedef std::forward_iterator_tag	iterator_category;
+typedef Parameter_View				value_type;
+typedef std::ptrdiff_t				difference_type;
+typedef const Parameter_View*		pointer;
+typedef const Parameter_View&		reference;
+
+//!	Constructs an invalid Depth_Iterator.
+Depth_Iterator ()
+	{}
+
+/**	Constructs a Depth_Iterator positioned at the first Parameter of
+	an Aggregate_View hierarchy.
+
+	@param	aggregate	The Aggregate_View to be traversed.
+*/
+explicit Depth_Iterator (const Aggregate_View& aggregate);
+
+reference operator* () const
+	{return Current;}
+
+pointer operator-> () const
+	{return &Current;}
+
+Depth_Iterator& operator++ ();
+
+Depth_Iterator operator++ (int)
+	{Depth_Iterator previous (*this); ++*this; return previous;}
+
+bool operator== (const Depth_Iterator& other) const
+	{return Current == other.Current;}
+
+bool operator!= (const Depth_Iterator& other) const
+	{return Current != other.Current;}
+
+/**	Gets the end of the traversal.
+
+	@return	A Depth_Iterator positioned after the last Parameter.
+*/
+Depth_Iterator end_depth () const;
+
+private:
+
+Parameter_View
+	Current;
+const char
+	*End;
+};
+
+/*==============================================================================
+	Listing
+*/
+/**	Lists a viewed Parameter.
+
+	The Parameter, and any Parameters it contains, are materialized and
+	written by the Lister.
+
+	@param	lister	The Lister to write the Parameter.
+	@param	parameter	The Parameter_View of the Parameter to be listed.
+	@return	The output stream of the Lister.
+	@see	Lister::operator<<(const Parameter&)
+*/
+std::ostream& operator<< (Lister& lister, const Parameter_View& parameter);
+
+/**	Prints a viewed Parameter.
+
+	@param	out	The ostream where the Parameter is to be printed.
+	@param	parameter	The Parameter_View of the Parameter to be printed.
+	@return	The ostream.
+	@see	operator<<(std::ostream&, const Parameter&)
+*/
+std::ostream& operator<< (std::ostream& out, const Parameter_View& parameter);
+
+}		//	namespace PVL
+}		//	namespace idaeim
+#endif	//	idaeim_PVL_Aggregate_View_hh
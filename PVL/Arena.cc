@@ -0,0 +1,411 @@
+/*	Arena
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"Arena.hh"
+
+#include	<new>
+#include	<cstdlib>
+#include	<cstdint>
+#include	<functional>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Arena
+*/
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Arena::ID =
+		"idaeim::PVL::Arena (1.0 2026/10/18)";
+
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+/*	Node header.
+
+	Every Arena node allocation is preceded by a header that identifies
+	the Arena the node came from and the size of the node. The header is
+	sized to preserve the maximum fundamental alignment of the node.
+	Heap nodes have no header.
+*/
+union Node_Header
+{
+struct Node_Source
+	{
+	Arena
+		*Source;
+	std::size_t
+		Size;
+	}
+	Node;
+std::max_align_t
+	Alignment;
+};
+
+const std::size_t
+	HEADER_SIZE			= sizeof (Node_Header),
+	ALIGNMENT			= alignof (std::max_align_t),
+	MAX_BLOCK_SCALING	= 16;
+
+inline std::size_t
+aligned
+	(
+	std::size_t	size
+	)
+{return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);}
+
+//	The size of an Arena node allocation, including its header.
+inline std::size_t
+allocation_size
+	(
+	const Node_Header*	header
+	)
+{return aligned (HEADER_SIZE + header->Node.Size);}
+
+/*	Arena page map.
+
+	Since heap nodes have no header, a node is identified as an Arena
+	node by the memory page that contains it. The Arena blocks are page
+	aligned and a whole number of pages, so no heap memory shares a page
+	with an Arena block. Each page of an Arena block is marked in a bit
+	map indexed by the page number. The top level of the map covers the
+	entire address space; the leaf maps are allocated as they are first
+	needed and are never freed. The map is read without locking.
+*/
+const unsigned int
+	PAGE_BITS			= 12,
+	ADDRESS_BITS		= (sizeof (void*) > 4) ? 48 : 32,
+	LEAF_BITS			= 20,
+	WORD_BITS			= 64;
+
+const std::size_t
+	PAGE_SIZE			= (std::size_t)1 << PAGE_BITS,
+	LEAF_WORDS			= ((std::size_t)1 << LEAF_BITS) / WORD_BITS,
+	MAP_ENTRIES			=
+		(std::size_t)1 << (ADDRESS_BITS - PAGE_BITS - LEAF_BITS);
+
+typedef std::atomic<std::uint64_t>	Page_Bits;
+
+std::atomic<Page_Bits*>
+	Page_Map[MAP_ENTRIES];
+
+inline std::size_t
+paged
+	(
+	std::size_t	size
+	)
+{return (size + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);}
+
+
+void
+mark_pages
+	(
+	const char*		memory,
+	std::size_t		size,
+	bool			arena_pages
+	)
+{
+for (std::uintptr_t
+		page = reinterpret_cast<std::uintptr_t>(memory) >> PAGE_BITS,
+		last = page + (size >> PAGE_BITS);
+	 page < last;
+	 ++page)
+	{
+	std::size_t
+		entry = page >> LEAF_BITS,
+		bit   = page & (((std::size_t)1 << LEAF_BITS) - 1);
+	if (entry >= MAP_ENTRIES)
+		{
+		//	An Arena block must be within the range of the map.
+		if (arena_pages)
+			throw std::bad_alloc ();
+		continue;
+		}
+	Page_Bits
+		*leaf = Page_Map[entry].load (std::memory_order_acquire);
+	if (! leaf)
+		{
+		if (! arena_pages)
+			continue;
+		Page_Bits
+			*new_leaf = new Page_Bits[LEAF_WORDS] ();
+		if (Page_Map[entry].compare_exchange_strong (leaf, new_leaf,
+				std::memory_order_acq_rel))
+			leaf = new_leaf;
+		else
+			delete[] new_leaf;
+		}
+	std::uint64_t
+		mask = (std::uint64_t)1 << (bit % WORD_BITS);
+	if (arena_pages)
+		leaf[bit / WORD_BITS].fetch_or (mask, std::memory_order_release);
+	else
+		leaf[bit / WORD_BITS].fetch_and (~mask, std::memory_order_release);
+	}
+}
+
+
+inline bool
+in_arena
+	(
+	const void*	node
+	)
+{
+std::uintptr_t
+	page = reinterpret_cast<std::uintptr_t>(node) >> PAGE_BITS;
+std::size_t
+	entry = page >> LEAF_BITS,
+	bit   = page & (((std::size_t)1 << LEAF_BITS) - 1);
+if (entry >= MAP_ENTRIES)
+	return false;
+const Page_Bits
+	*leaf = Page_Map[entry].load (std::memory_order_acquire);
+return leaf &&
+	(leaf[bit / WORD_BITS].load (std::memory_order_acquire) &
+		((std::uint64_t)1 << (bit % WORD_BITS)));
+}
+
+thread_local Arena
+	*Current_Arena = NULL;
+
+std::atomic<Arena::Node_Hook>
+	Hook (NULL);
+}
+#endif
+
+/*==============================================================================
+	Constructors
+*/
+Arena::Arena
+	(
+	std::size_t	block_size
+	)
+	:	Position (NULL),
+		Limit (NULL),
+		Block_Size (paged (block_size ? block_size : ARENA_BLOCK_SIZE)),
+		Max_Block_Size (Block_Size * MAX_BLOCK_SCALING),
+		Capacity (0),
+		Used (0),
+		Nodes (1),
+		Owned (true)
+{}
+
+Arena::~Arena ()
+{
+for (std::vector<Block>::iterator
+		block = Blocks.begin (),
+		last  = Blocks.end ();
+	 block != last;
+	 ++block)
+	{
+	mark_pages (block->Memory, block->Size, false);
+	::operator delete (block->Memory, std::align_val_t (PAGE_SIZE));
+	}
+}
+
+void
+Arena::release ()
+{
+Owned = false;
+if (--Nodes == 0)
+	delete this;
+}
+
+/*==============================================================================
+	Accessors
+*/
+bool
+Arena::contains
+	(
+	const void*	address
+	) const
+{
+const char
+	*location = static_cast<const char*>(address);
+for (std::vector<Block>::const_iterator
+		block = Blocks.begin (),
+		last  = Blocks.end ();
+	 block != last;
+	 ++block)
+	if (std::less_equal<const char*> ()(block->Memory, location) &&
+		std::less<const char*> ()(location, block->Memory + block->Size))
+		return true;
+return false;
+}
+
+/*==============================================================================
+	Scope
+*/
+Arena::Scope::Scope
+	(
+	Arena*	arena
+	)
+	:	Previous (Current_Arena)
+{Current_Arena = arena;}
+
+Arena::Scope::~Scope ()
+{Current_Arena = Previous;}
+
+Arena*
+Arena::current ()
+{return Current_Arena;}
+
+/*==============================================================================
+	Node memory
+*/
+void*
+Arena::allocate
+	(
+	std::size_t	size
+	)
+{
+size = aligned (size);
+if (static_cast<std::size_t>(Limit - Position) < size)
+	{
+	//	New block; each is twice the size of the previous one.
+	Block
+		block;
+	block.Size = Block_Size;
+	if (Block_Size < Max_Block_Size)
+		Block_Size <<= 1;
+	if (block.Size < size)
+		block.Size = paged (size);
+	Blocks.reserve (Blocks.size () + 1);
+	block.Memory = static_cast<char*>
+		(::operator new (block.Size, std::align_val_t (PAGE_SIZE)));
+	try {mark_pages (block.Memory, block.Size, true);}
+	catch (...)
+		{
+		mark_pages (block.Memory, block.Size, false);
+		::operator delete (block.Memory, std::align_val_t (PAGE_SIZE));
+		throw;
+		}
+	Blocks.push_back (block);
+	Position = block.Memory;
+	Limit = Position + block.Size;
+	Capacity += block.Size;
+	}
+void
+	*memory = Position;
+Position += size;
+Used += size;
+return memory;
+}
+
+
+void*
+Arena::allocate_node
+	(
+	std::size_t	size
+	)
+{
+Arena
+	*arena = Current_Arena;
+Node_Hook
+	hook = Hook.load (std::memory_order_relaxed);
+if (! arena)
+	{
+	void
+		*node = ::operator new (size);
+	if (hook)
+		hook (static_cast<long>(size), NULL);
+	return node;
+	}
+Node_Header
+	*header = static_cast<Node_Header*>
+		(arena->allocate (HEADER_SIZE + size));
+++arena->Nodes;
+header->Node.Source = arena;
+header->Node.Size = size;
+if (hook)
+	hook (static_cast<long>(allocation_size (header)), arena);
+return reinterpret_cast<char*>(header) + HEADER_SIZE;
+}
+
+
+void
+Arena::release_node
+	(
+	void*		node,
+	std::size_t	size
+	)
+{
+if (! node)
+	return;
+Node_Hook
+	hook = Hook.load (std::memory_order_relaxed);
+if (! in_arena (node))
+	{
+	if (hook)
+		hook (-static_cast<long>(size), NULL);
+	::operator delete (node);
+	return;
+	}
+Node_Header
+	*header = reinterpret_cast<Node_Header*>
+		(static_cast<char*>(node) - HEADER_SIZE);
+if (hook)
+	hook (-static_cast<long>(allocation_size (header)), header->Node.Source);
+if (--header->Node.Source->Nodes == 0)
+	delete header->Node.Source;
+}
+
+
+void
+Arena::node_usage
+	(
+	const void*		node,
+	Memory_Usage&	usage
+	)
+{
+if (! node ||
+	! in_arena (node))
+	return;
+const Node_Header
+	*header = reinterpret_cast<const Node_Header*>
+		(static_cast<const char*>(node) - HEADER_SIZE);
+std::size_t
+	size = allocation_size (header);
+usage.Node_Overhead += size - header->Node.Size;
+usage.Arena_Nodes += size;
+}
+
+/*==============================================================================
+	Node hook
+*/
+Arena::Node_Hook
+Arena::node_hook
+	(
+	Node_Hook	hook
+	)
+{return Hook.exchange (hook);}
+
+
+Arena::Node_Hook
+Arena::node_hook ()
+{return Hook.load ();}
+
+}		//	namespace PVL
+}		//	namespace idaeim
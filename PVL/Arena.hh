@@ -0,0 +1,325 @@
+/*	Arena
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#ifndef idaeim_PVL_Arena_hh
+#define idaeim_PVL_Arena_hh
+
+#include	"PVL/Memory_Usage.hh"
+
+#include	<cstddef>
+#include	<vector>
+#include	<atomic>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Arena
+*/
+/**	An <i>Arena</i> is a monotonic memory pool for Parameter and Value
+	nodes.
+
+	A parsed PVL document is built from many small node allocations
+	which are later released one by one as the tree is destroyed. When
+	an Arena is {@link Scope in scope} for the current thread, the
+	Parameter and Value classes obtain the memory for new nodes from the
+	Arena instead of the heap. An Arena hands out node memory from large
+	blocks by simply advancing a position in the current block; memory
+	is never returned to the Arena when a node is deleted. Instead the
+	Arena counts its live nodes and, once it has been released by its
+	owner, frees all of its blocks in one step when the last node is
+	deleted.
+
+	Because each node keeps the Arena it came from alive, nodes
+	allocated from an Arena may be freely moved or copied into other
+	Parameter or Value trees, and trees may mix nodes from different
+	Arenas and the heap.
+
+	<b>N.B.</b>: Only the node objects themselves are allocated from
+	the Arena. The strings and the pointer vectors they contain use the
+	standard allocator. Short strings, which includes most Parameter
+	names and Value units, are stored within the node by the standard
+	string implementation.
+
+	An Arena is not itself thread safe: only one thread at a time may
+	allocate from an Arena. However, nodes allocated from an Arena may
+	be deleted by any thread.
+
+	@version	1.0
+	@see	Parser::arena(bool)
+*/
+class Arena
+{
+public:
+/*==============================================================================
+	Constants:
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+/**	The default size of an Arena memory block.
+
+	Each new block is twice the size of the previous one, up to
+	sixteen times this size.
+*/
+#ifndef ARENA_BLOCK_SIZE
+#define ARENA_BLOCK_SIZE	8192
+#endif
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs an empty Arena.
+
+	No memory is allocated until the first node is allocated.
+
+	The new Arena is owned by its creator, which must {@link release()
+	release} it rather than delete it.
+
+	@param	block_size	The size of the first memory block.
+*/
+explicit Arena (std::size_t block_size = ARENA_BLOCK_SIZE);
+
+/**	Releases the creator's ownership of the Arena.
+
+	The Arena is deleted when it has been released and all of its nodes
+	have been deleted.
+*/
+void release ();
+
+private:
+//	Use release.
+~Arena ();
+
+//	Arenas are not copyable.
+Arena (const Arena&);
+Arena& operator= (const Arena&);
+
+public:
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the number of live nodes allocated from the Arena.
+
+	@return	The number of nodes allocated from the Arena that have not
+		yet been deleted.
+*/
+long nodes () const
+	{return Nodes.load () - (Owned.load () ? 1 : 0);}
+
+/**	Gets the number of memory blocks held by the Arena.
+
+	@return	The number of memory blocks.
+*/
+std::size_t blocks () const
+	{return Blocks.size ();}
+
+/**	Gets the amount of memory held by the Arena.
+
+	@return	The total size, in bytes, of the Arena memory blocks.
+*/
+std::size_t capacity () const
+	{return Capacity;}
+
+/**	Gets the amount of Arena memory that has been allocated.
+
+	@return	The total size, in bytes, of the memory handed out by the
+		Arena, including the node bookkeeping overhead.
+*/
+std::size_t used () const
+	{return Used;}
+
+/**	Tests if a memory location is within the Arena's memory blocks.
+
+	@param	address	The memory address to test.
+	@return	true if the address is in one of the Arena's blocks; false
+		otherwise.
+*/
+bool contains (const void* address) const;
+
+/*==============================================================================
+	Scope
+*/
+/**	A <i>Scope</i> makes an Arena the source of node memory for the
+	current thread while the Scope exists.
+
+	Scopes nest: when a Scope is destroyed the Arena that was current
+	when it was constructed - if any - becomes current again.
+*/
+class Scope
+{
+public:
+/**	Makes an Arena current for this thread.
+
+	@param	arena	A pointer to the Arena to be used. If NULL, no Arena
+		is current for the Scope; nodes are allocated from the heap.
+*/
+explicit Scope (Arena* arena);
+
+//!	Restores the previously current Arena.
+~Scope ();
+
+private:
+Scope (const Scope&);
+Scope& operator= (const Scope&);
+
+Arena
+	*Previous;
+};
+
+/**	Gets the Arena that is current for this thread.
+
+	@return	A pointer to the current Arena, or NULL if no Arena is
+		current.
+*/
+static Arena* current ();
+
+/*==============================================================================
+	Node memory
+*/
+/**	Allocates memory for a node.
+
+	If an Arena is {@link current() current} for this thread the memory
+	is obtained from the Arena, preceded by a small header that
+	identifies the Arena; otherwise the memory is obtained from the heap
+	with no header.
+
+	This function is used by the Parameter and Value class allocation
+	operators.
+
+	@param	size	The size of the node.
+	@return	A pointer to the node memory.
+	@throws	std::bad_alloc	If memory could not be obtained.
+*/
+static void* allocate_node (std::size_t size);
+
+/**	Releases memory for a node.
+
+	Node memory that came from the heap is returned to it. Node memory
+	that came from an Arena is left in place; the Arena's count of live
+	nodes is decremented which may result in the Arena being deleted.
+
+	@param	node	A pointer to node memory obtained from
+		allocate_node. Nothing is done if this is NULL.
+	@param	size	The size of the node; the same size that was used
+		to allocate the node.
+*/
+static void release_node (void* node, std::size_t size);
+
+/**	Accounts for the allocation of a node.
+
+	If the node is in Arena memory the header and alignment padding of
+	the node memory are added to the Node_Overhead of the usage and the
+	entire node allocation is added to the Arena_Nodes. A heap node has
+	no overhead. The node object itself is not added to the Nodes; that
+	is left to the node.
+
+	@param	node	A pointer to node memory obtained from
+		allocate_node. Nothing is done if this is NULL.
+	@param	usage	The Memory_Usage to which the node allocation is
+		to be added.
+*/
+static void node_usage (const void* node, Memory_Usage& usage);
+
+/*==============================================================================
+	Node hook
+*/
+/**	A <i>Node_Hook</i> is a function that is called for each node
+	allocation and release.
+
+	Only the memory of the nodes themselves - the Parameter and Value
+	objects obtained with allocate_node - is reported. The memory that
+	the nodes obtain for themselves from the standard allocator - name,
+	comment and String Value characters, the Parameter and Value lists
+	of Aggregates and Arrays, pathname indices - is not. The {@link
+	Parameter::memory_usage() memory_usage} of a Parameter or {@link
+	Value::memory_usage() Value} accounts for all of its memory; a
+	cache that limits the memory it holds should use that instead.
+
+	The bytes argument is the size of the node allocation, including
+	the header and alignment padding of an Arena node; it is positive
+	when the node is allocated and negative when it is released. The
+	arena argument is the Arena that holds the node, or NULL if it is
+	on the heap. Note that the memory of an Arena node is not actually
+	returned until the Arena itself is deleted.
+
+	A hook may be called concurrently from any thread that allocates or
+	releases nodes, so it must be thread safe; it must not throw an
+	exception or allocate nodes.
+*/
+typedef void (*Node_Hook) (long bytes, const Arena* arena);
+
+/**	Sets the node hook.
+
+	The hook applies to all threads. By default there is no hook.
+
+	@param	hook	The Node_Hook to be called for each node allocation
+		and release. If NULL no hook is called.
+	@return	The previous node hook.
+*/
+static Node_Hook node_hook (Node_Hook hook);
+
+/**	Gets the node hook.
+
+	@return	The current Node_Hook, or NULL if there is none.
+	@see	node_hook(Node_Hook)
+*/
+static Node_Hook node_hook ();
+
+/*==============================================================================
+	Private
+*/
+private:
+
+void* allocate (std::size_t size);
+
+struct Block
+{
+char
+	*Memory;
+std::size_t
+	Size;
+};
+
+std::vector<Block>
+	Blocks;
+char
+	*Position,
+	*Limit;
+std::size_t
+	Block_Size,
+	Max_Block_Size,
+	Capacity,
+	Used;
+
+//	Live nodes, plus one for the creator's ownership.
+std::atomic<long>
+	Nodes;
+std::atomic<bool>
+	Owned;
+
+};		//	End of Arena class.
+
+}		//	namespace PVL
+}		//	namespace idaeim
+#endif	//	idaeim_PVL_Arena_hh
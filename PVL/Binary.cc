@@ -0,0 +1,860 @@
+/*	Binary
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"Binary.hh"
+#include	"Value.hh"
+#include	"PVL_Exceptions.hh"
+
+#include	<string>
+#include	<vector>
+#include	<unordered_map>
+#include	<sstream>
+#include	<iterator>
+#include	<cstring>
+#include	<limits>
+using std::string;
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Binary
+*/
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Binary::ID =
+		"idaeim::PVL::Binary (1.0 2026/10/18)";
+
+const char
+	Binary::MAGIC[4]		= {'P', 'V', 'L', 'B'};
+
+const unsigned short
+	Binary::VERSION			= 3;
+
+/*	Header layout:
+
+	Offset	Size	Field
+	0		4		MAGIC
+	4		2		VERSION
+	6		2		Byte order mark
+	8		1		sizeof (Value::Integer_type)
+	9		1		sizeof (Value::Real_type)
+	10		2		Reserved (zero)
+	12		4		CRC-32 of the data following the header
+	16		4		Number of strings
+	20		4		Number of nodes
+	24		4		Size of the data following the header
+	28		4		Offset of the node table in the data
+
+	The string table offsets and the node table offset are relative to
+	the beginning of the data; the parent offsets of the Parameter
+	records are relative to the beginning of the node table.
+*/
+const std::size_t
+	Binary::HEADER_SIZE		= 32;
+
+const int
+	Binary::MAX_DIGITS		= 1024;
+
+const unsigned short
+	Binary::BYTE_ORDER_MARK	= 0x0102;
+
+const Binary::Count
+	Binary::NO_PARENT		= std::numeric_limits<Binary::Count>::max ();
+
+//	Only the standard flags; any other bits mark a corrupt encoding.
+const unsigned int
+	Binary::FORMAT_FLAGS	=
+		std::ios::boolalpha | std::ios::showbase | std::ios::showpoint |
+		std::ios::showpos | std::ios::skipws | std::ios::unitbuf |
+		std::ios::uppercase | std::ios::adjustfield |
+		std::ios::basefield | std::ios::floatfield;
+
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+//	The CRC-32 of each byte value for the reflected polynomial 0xEDB88320.
+struct CRC_Table
+{
+unsigned int
+	Entry[256];
+
+CRC_Table ()
+{
+for (unsigned int
+		index = 0;
+	 index < 256;
+	 index++)
+	{
+	unsigned int
+		crc = index;
+	for (int
+			bit = 0;
+		 bit < 8;
+		 bit++)
+		crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+	Entry[index] = crc;
+	}
+}
+};
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+/*==============================================================================
+	Validation
+*/
+unsigned int
+Binary::checksum
+	(
+	const char*		data,
+	std::size_t		size
+	)
+{
+static const CRC_Table
+	table;
+const unsigned char
+	*byte = reinterpret_cast<const unsigned char*>(data),
+	*end = byte + size;
+unsigned int
+	crc = 0xFFFFFFFF;
+while (byte != end)
+	crc = table.Entry[(crc ^ *byte++) & 0xFF] ^ (crc >> 8);
+return ~crc & 0xFFFFFFFF;
+}
+
+
+bool
+Binary::valid_mode_state
+	(
+	int		state
+	)
+{
+return
+	state == Parameter::MODE_FALSE ||
+	state == Parameter::MODE_TRUE ||
+	state == Parameter::MODE_INHERITED;
+}
+
+
+bool
+Binary::valid_digits
+	(
+	int		digits
+	)
+{return digits >= 0 && digits <= MAX_DIGITS;}
+
+
+bool
+Binary::valid_base
+	(
+	int		base
+	)
+{
+//	Base zero is the unspecified base.
+return
+	! base ||
+	(base >= Value::MIN_BASE &&
+	 base <= Value::MAX_BASE);
+}
+
+
+bool
+Binary::valid_format_flags
+	(
+	unsigned int	flags
+	)
+{return ! (flags & ~FORMAT_FLAGS);}
+
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+template<typename T>
+inline void
+append
+	(
+	string&		buffer,
+	const T&	datum
+	)
+{buffer.append (reinterpret_cast<const char*>(&datum), sizeof (T));}
+
+template<typename T>
+inline void
+put
+	(
+	string&				buffer,
+	string::size_type	offset,
+	const T&			datum
+	)
+{std::memcpy (&buffer[offset], &datum, sizeof (T));}
+}	//	Local namespace
+
+/*------------------------------------------------------------------------------
+	Encoder
+*/
+class Binary::Encoder
+{
+public:
+
+Encoder ()
+	:	Nodes (0)
+{
+//	String zero is the empty string.
+string_index ("");
+}
+
+string
+encode
+	(
+	const Aggregate&	aggregate
+	)
+{
+parameter (aggregate, NO_PARENT);
+
+string::size_type
+	offsets_size = String_Offsets.size () * sizeof (Count),
+	size = offsets_size + String_Table.size () + Node_Table.size ();
+if (size > std::numeric_limits<Count>::max ())
+	throw Out_of_Range ("The Aggregate is too large to be encoded.",
+		Binary::ID);
+
+string
+	buffer (HEADER_SIZE, '\0');
+std::memcpy (&buffer[0], MAGIC, sizeof (MAGIC));
+put (buffer, VERSION_OFFSET, VERSION);
+put (buffer, BYTE_ORDER_OFFSET, BYTE_ORDER_MARK);
+buffer[INTEGER_SIZE_OFFSET] = (char)sizeof (Value::Integer_type);
+buffer[REAL_SIZE_OFFSET] = (char)sizeof (Value::Real_type);
+put (buffer, STRINGS_OFFSET, (Count)String_Offsets.size ());
+put (buffer, NODES_OFFSET, Nodes);
+put (buffer, DATA_SIZE_OFFSET, (Count)size);
+put (buffer, NODE_TABLE_OFFSET,
+	(Count)(offsets_size + String_Table.size ()));
+buffer.reserve (HEADER_SIZE + size);
+for (std::vector<Count>::const_iterator
+		offset = String_Offsets.begin ();
+	 offset != String_Offsets.end ();
+	 ++offset)
+	append (buffer, (Count)(offsets_size + *offset));
+buffer += String_Table;
+buffer += Node_Table;
+
+put (buffer, CHECKSUM_OFFSET, checksum (&buffer[HEADER_SIZE], size));
+return buffer;
+}
+
+private:
+
+//	Adds a string to the string table, if it is not already there.
+Count
+string_index
+	(
+	const string&	text
+	)
+{
+std::unordered_map<string, Count>::iterator
+	entry = Table.find (text);
+if (entry != Table.end ())
+	return entry->second;
+Count
+	index = (Count)String_Offsets.size ();
+String_Offsets.push_back ((Count)String_Table.size ());
+append (String_Table, (Count)text.size ());
+String_Table += text;
+Table[text] = index;
+return index;
+}
+
+void
+parameter
+	(
+	const Parameter&	parameter,
+	Count				parent
+	)
+{
+++Nodes;
+string::size_type
+	record = Node_Table.size ();
+append (Node_Table, (int)parameter.type ());
+append (Node_Table, parent);
+append (Node_Table, string_index (parameter.name ()));
+append (Node_Table, string_index (parameter.comment ()));
+const Parameter::MODE_STATE
+	*modes = parameter.mode_state ();
+for (int
+		mode = 0;
+	 mode < Parameter::TOTAL_LOCAL_MODES;
+	 mode++)
+	Node_Table += (char)modes[mode];
+
+if (parameter.is_Aggregate ())
+	{
+	const Aggregate
+		&aggregate = static_cast<const Aggregate&>(parameter);
+	append (Node_Table, (Count)aggregate.size ());
+	append (Node_Table, (Count)0);
+	string::size_type
+		contents = Node_Table.size ();
+	for (Aggregate::const_iterator
+			element = aggregate.begin ();
+		 element != aggregate.end ();
+		 ++element)
+		this->parameter (*element, (Count)record);
+	put (Node_Table, record + AGGREGATE_EXTENT,
+		(Count)(Node_Table.size () - contents));
+	}
+else
+	value (parameter.value ());
+}
+
+void
+value
+	(
+	const Value&	value
+	)
+{
+++Nodes;
+if (! valid_digits (value.digits ()))
+	{
+	std::ostringstream
+		message;
+	message << "The " << value.type_name () << " Value digits "
+			<< value.digits () << " are outside of the encodable range: 0 - "
+			<< MAX_DIGITS;
+	throw Out_of_Range (message.str (), Binary::ID);
+	}
+string::size_type
+	record = Node_Table.size ();
+append (Node_Table, (int)value.type ());
+append (Node_Table, string_index (value.units ()));
+append (Node_Table, value.digits ());
+append (Node_Table, value.base ());
+if (value.is_Integer ())
+	{
+	append (Node_Table, static_cast<Value::Integer_type>(value));
+	Node_Table += (char)value.is_signed ();
+	}
+else
+if (value.is_Real ())
+	{
+	unsigned int
+		flags = static_cast<const Real&>(value).format_flags ();
+	if (! valid_format_flags (flags))
+		throw Out_of_Range
+			("The Real Value has format flags that can not be encoded.",
+			Binary::ID);
+	append (Node_Table, static_cast<Value::Real_type>(value));
+	append (Node_Table, flags);
+	}
+else
+if (value.is_String ())
+	append (Node_Table,
+		string_index (static_cast<Value::String_type>(value)));
+else
+	{
+	const Array
+		&array = static_cast<const Array&>(value);
+	append (Node_Table, (Count)array.size ());
+	append (Node_Table, (Count)0);
+	string::size_type
+		contents = Node_Table.size ();
+	for (Array::const_iterator
+			element = array.begin ();
+		 element != array.end ();
+		 ++element)
+		this->value (*element);
+	put (Node_Table, record + ARRAY_EXTENT,
+		(Count)(Node_Table.size () - contents));
+	}
+}
+
+std::unordered_map<string, Count>
+	Table;
+std::vector<Count>
+	String_Offsets;
+string
+	String_Table,
+	Node_Table;
+Count
+	Nodes;
+};
+
+/*------------------------------------------------------------------------------
+	Decoder
+*/
+class Binary::Decoder
+{
+public:
+
+Decoder
+	(
+	const char*		data,
+	std::size_t		size
+	)
+	:	Data (data),
+		Position (data),
+		End (data + size),
+		Nodes (0)
+	{}
+
+Aggregate*
+decode ()
+{
+header ();
+const char
+	*offsets = Position;
+require (Total_Strings * sizeof (Count));
+Position += Total_Strings * sizeof (Count);
+Strings.reserve (Total_Strings);
+for (Count
+		index = 0;
+	 index < Total_Strings;
+	 index++)
+	{
+	Count
+		offset;
+	std::memcpy (&offset, offsets + index * sizeof (Count), sizeof (Count));
+	if (offset != (Count)(Position - Data_Start))
+		{
+		Position = offsets + index * sizeof (Count);
+		invalid ("The string table offsets do not match the strings.");
+		}
+	Count
+		length = get<Count> ();
+	require (length);
+	Strings.push_back (string (Position, length));
+	Position += length;
+	}
+if (Position != Node_Table)
+	invalid ("The node table offset does not match the string table.");
+
+Parameter
+	*root = parameter (NO_PARENT);
+if (! root->is_Aggregate ())
+	{
+	delete root;
+	invalid ("The encoding is not of an Aggregate.");
+	}
+if (Position != End ||
+	Nodes != Total_Nodes)
+	{
+	delete root;
+	invalid ("The node table does not match the header.");
+	}
+return static_cast<Aggregate*>(root);
+}
+
+private:
+
+void
+invalid
+	(
+	const string&	message
+	)
+{throw Invalid_Syntax (message, (int)(Position - Data), Binary::ID);}
+
+void
+require
+	(
+	std::size_t		amount
+	)
+{
+if ((std::size_t)(End - Position) < amount)
+	invalid ("The encoding is truncated.");
+}
+
+template<typename T>
+T
+get ()
+{
+T
+	datum;
+require (sizeof (T));
+std::memcpy (&datum, Position, sizeof (T));
+Position += sizeof (T);
+return datum;
+}
+
+const string&
+get_string ()
+{
+Count
+	index = get<Count> ();
+if (index >= Strings.size ())
+	{
+	Position -= sizeof (Count);
+	invalid ("Invalid string table index.");
+	}
+return Strings[index];
+}
+
+//	Checks that a count of records of a minimum size fits in an extent.
+void
+check_count
+	(
+	Count			count,
+	Count			extent,
+	std::size_t		minimum
+	)
+{
+if (count > extent / minimum)
+	{
+	Position -= 2 * sizeof (Count);
+	invalid ("The record count does not match the record size.");
+	}
+}
+
+//	Checks that the records following an extent have the extent's size.
+void
+check_extent
+	(
+	const char*		contents,
+	Count			extent
+	)
+{
+if (Position - contents != (std::ptrdiff_t)extent)
+	{
+	Position = contents - sizeof (Count);
+	invalid ("The record size does not match the contents.");
+	}
+}
+
+void
+header ()
+{
+require (HEADER_SIZE);
+if (std::memcmp (Position, MAGIC, sizeof (MAGIC)))
+	invalid ("Not a binary PVL encoding.");
+unsigned short
+	datum;
+std::memcpy (&datum, Position + VERSION_OFFSET, sizeof (datum));
+if (datum != VERSION)
+	{
+	std::ostringstream
+		message;
+	message << "Unsupported binary PVL version " << datum
+			<< "; version " << VERSION << " expected.";
+	Position += VERSION_OFFSET;
+	invalid (message.str ());
+	}
+std::memcpy (&datum, Position + BYTE_ORDER_OFFSET, sizeof (datum));
+if (datum != BYTE_ORDER_MARK ||
+	Position[INTEGER_SIZE_OFFSET] != (char)sizeof (Value::Integer_type) ||
+	Position[REAL_SIZE_OFFSET] != (char)sizeof (Value::Real_type))
+	{
+	Position += BYTE_ORDER_OFFSET;
+	invalid ("The encoding byte order or data sizes "
+		"do not match this host.");
+	}
+Count
+	size,
+	node_table;
+std::memcpy (&Total_Strings, Position + STRINGS_OFFSET, sizeof (Count));
+std::memcpy (&Total_Nodes, Position + NODES_OFFSET, sizeof (Count));
+std::memcpy (&size, Position + DATA_SIZE_OFFSET, sizeof (Count));
+std::memcpy (&node_table, Position + NODE_TABLE_OFFSET, sizeof (Count));
+Position += HEADER_SIZE;
+Data_Start = Position;
+if ((std::size_t)(End - Position) != size)
+	invalid ("The encoding size does not match the header.");
+if (! Total_Strings ||
+	Total_Strings > size / sizeof (Count) ||
+	Total_Nodes > size / sizeof (int) ||
+	node_table > size)
+	invalid ("The table sizes do not match the encoding size.");
+Node_Table = Position + node_table;
+
+//	The checksum of intact data matches the stored checksum.
+unsigned int
+	stored;
+std::memcpy (&stored, Data + CHECKSUM_OFFSET, sizeof (stored));
+if (checksum (Position, size) != stored)
+	invalid ("Checksum mismatch; the encoding is corrupt.");
+}
+
+Parameter*
+parameter
+	(
+	Count	parent
+	)
+{
+if (++Nodes > Total_Nodes)
+	invalid ("More nodes than the header specifies.");
+const char
+	*record = Position;
+int
+	type = get<int> ();
+if (get<Count> () != parent)
+	{
+	Position = record + PARAMETER_PARENT;
+	invalid ("The parent offset does not match the enclosing Aggregate.");
+	}
+const string
+	&name = get_string (),
+	&comment = get_string ();
+Parameter::MODE_STATE
+	modes[Parameter::TOTAL_LOCAL_MODES];
+require (Parameter::TOTAL_LOCAL_MODES);
+for (int
+		mode = 0;
+	 mode < Parameter::TOTAL_LOCAL_MODES;
+	 mode++, Position++)
+	{
+	if (! valid_mode_state (*Position))
+		invalid ("Invalid Parameter mode state.");
+	modes[mode] = (Parameter::MODE_STATE)*Position;
+	}
+
+Parameter
+	*parameter;
+if (type == Parameter::AGGREGATE ||
+	type == Parameter::GROUP ||
+	type == Parameter::OBJECT)
+	{
+	Aggregate
+		*aggregate = new Aggregate (name, (Parameter::Type)type);
+	parameter = aggregate;
+	try
+		{
+		Count
+			count = get<Count> (),
+			extent = get<Count> ();
+		const char
+			*contents = Position;
+		check_count (count, extent, AGGREGATE_RECORD_SIZE);
+		aggregate->reserve (count);
+		while (count--)
+			aggregate->poke_back
+				(this->parameter ((Count)(record - Node_Table)));
+		check_extent (contents, extent);
+		}
+	catch (...)
+		{
+		delete aggregate;
+		throw;
+		}
+	}
+else
+if (type == Parameter::ASSIGNMENT ||
+	type == Parameter::TOKEN)
+	{
+	Assignment
+		*assignment = new Assignment (name);
+	parameter = assignment;
+	try
+		{
+		assignment->value (this->value ());
+		assignment->type (type);
+		}
+	catch (...)
+		{
+		delete assignment;
+		throw;
+		}
+	}
+else
+	{
+	Position = record;
+	invalid ("Invalid Parameter type.");
+	}
+parameter->comment (comment);
+parameter->mode_state (modes);
+return parameter;
+}
+
+Value*
+value ()
+{
+if (++Nodes > Total_Nodes)
+	invalid ("More nodes than the header specifies.");
+const char
+	*record = Position;
+int
+	type = get<int> ();
+const string
+	&units = get_string ();
+int
+	digits = get<int> (),
+	base = get<int> ();
+if (! valid_digits (digits))
+	{
+	Position = record + VALUE_DIGITS;
+	invalid ("Invalid Value digits.");
+	}
+if (! valid_base (base))
+	{
+	Position = record + VALUE_BASE;
+	invalid ("Invalid Value base.");
+	}
+
+Value
+	*value;
+switch (type)
+	{
+	case Value::INTEGER:
+		{
+		Value::Integer_type
+			datum = get<Value::Integer_type> ();
+		bool
+			is_signed = get<char> () != 0;
+		value = new Integer (datum, is_signed, base, digits);
+		}
+		break;
+	case Value::REAL:
+		{
+		Value::Real_type
+			datum = get<Value::Real_type> ();
+		unsigned int
+			flags = get<unsigned int> ();
+		if (! valid_format_flags (flags))
+			{
+			Position = record + REAL_FORMAT_FLAGS;
+			invalid ("Invalid Real format flags.");
+			}
+		Real
+			*real = new Real (datum, digits);
+		real->format_flags ((std::ios::fmtflags)flags);
+		value = real;
+		}
+		break;
+	case Value::STRING:
+	case Value::IDENTIFIER:
+	case Value::SYMBOL:
+	case Value::TEXT:
+	case Value::DATE_TIME:
+		value = new String (get_string (), (Value::Type)type);
+		break;
+	case Value::ARRAY:
+	case Value::SET:
+	case Value::SEQUENCE:
+		{
+		Array
+			*array = new Array ((Value::Type)type);
+		value = array;
+		try
+			{
+			Count
+				count = get<Count> (),
+				extent = get<Count> ();
+			const char
+				*contents = Position;
+			check_count (count, extent, STRING_RECORD_SIZE);
+			array->reserve (count);
+			while (count--)
+				array->poke_back (this->value ());
+			check_extent (contents, extent);
+			}
+		catch (...)
+			{
+			delete array;
+			throw;
+			}
+		}
+		break;
+	default:
+		Position = record;
+		invalid ("Invalid Value type.");
+		return NULL;
+	}
+value->units (units);
+value->digits (digits);
+value->base (base);
+return value;
+}
+
+const char
+	*Data,
+	*Position,
+	*End,
+	*Data_Start,
+	*Node_Table;
+std::vector<string>
+	Strings;
+Count
+	Total_Strings,
+	Total_Nodes,
+	Nodes;
+};
+#endif	//	DOXYGEN_PROCESSING
+
+/*==============================================================================
+	Encoding
+*/
+std::string
+Binary::encode
+	(
+	const Aggregate&	aggregate
+	)
+{
+Encoder
+	encoder;
+return encoder.encode (aggregate);
+}
+
+
+void
+Binary::write
+	(
+	const Aggregate&	aggregate,
+	std::ostream&		out
+	)
+{
+string
+	encoding (encode (aggregate));
+if (! out.write (encoding.data (), encoding.size ()))
+	throw IO_Failure ("Unable to write the binary PVL encoding.", ID);
+}
+
+/*==============================================================================
+	Decoding
+*/
+Aggregate*
+Binary::decode
+	(
+	const char*		data,
+	std::size_t		size
+	)
+{
+Decoder
+	decoder (data, size);
+return decoder.decode ();
+}
+
+
+Aggregate*
+Binary::read
+	(
+	std::istream&	in
+	)
+{
+string
+	encoding
+		((std::istreambuf_iterator<char>(in)),
+		 std::istreambuf_iterator<char>());
+if (in.bad ())
+	throw IO_Failure ("Unable to read the binary PVL encoding.", ID);
+return decode (encoding);
+}
+
+}		//	namespace PVL
+}		//	namespace idaeim
@@ -0,0 +1,275 @@
+/*	Binary
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#ifndef idaeim_PVL_Binary_hh
+#define idaeim_PVL_Binary_hh
+
+#include	"Parameter.hh"
+
+#include	<string>
+#include	<iostream>
+#include	<cstddef>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Binary
+*/
+/**	<i>Binary</i> provides a flat binary encoding of an Aggregate
+	hierarchy that can be decoded much faster than PVL text can be
+	parsed.
+
+	The encoding is intended for caching Aggregates that have already
+	been parsed - e.g. the labels of a collection of PDS products - so
+	they can be reloaded quickly. It retains everything that
+	contributes to the PVL listing of the Aggregate: the names,
+	comments, types and syntax modes of the Parameters, and the
+	units, digits, base, signedness and format flags of the Values as
+	well as their data. Thus a decoded Aggregate lists exactly the same
+	as the encoded Aggregate.
+
+	The encoding consists of:
+
+<dl>
+<dt>Header
+<dd>The four character {@link MAGIC magic} identifier, the format
+	{@link VERSION version}, a byte order mark, the sizes of the
+	Value::Integer_type and Value::Real_type data, a checksum of the
+	rest of the encoding, the number of strings in the string table,
+	the number of nodes in the node table, the size of the rest of
+	the encoding, and the offset of the node table.
+
+<dt>String table
+<dd>Each distinct name, comment, units and String Value datum is
+	stored once as a length followed by the characters. The strings
+	are preceeded by the offset of each one, so any string can be
+	located directly. String zero is always the empty string. The other
+	tables refer to strings by their index in this table.
+
+<dt>Node table
+<dd>One record for each Parameter and Value in depth-first order,
+	starting with the encoded Aggregate itself. Each record starts with
+	its Parameter::Type or Value::Type code. A Parameter record
+	continues with the node table offset of its parent's record, its
+	name, comment and local mode states; an Aggregate record then has
+	the number of Parameters it contains and the size of their records,
+	which immediately follow it; an Assignment record is immediately
+	followed by the record of its Value. A Value record continues with
+	its units, digits and base and then its typed data: the integer
+	datum and whether it is signed for an Integer, the floating point
+	datum and the format flags for a Real, the datum string for a
+	String, or the number of Values and the size of their records -
+	which immediately follow it - for an Array.
+</dl>
+
+	Since every record can be located, and skipped, without examining
+	the records it contains, an encoding can also be read in place -
+	without decoding it - by an {@link Aggregate_View Aggregate_View}.
+
+	All numbers are stored in the native byte order and sizes of the
+	host. The encoding is not meant to be exchanged between systems:
+	decoding fails if the byte order or the data type sizes recorded in
+	the header do not match those of the host. The checksum is the
+	CRC-32 (ISO-HDLC) of the data following the header; it detects
+	accidental corruption, not deliberate modification. The decoder
+	also rejects out of range mode states, digits, bases and format
+	flags, so a damaged encoding can not produce Values that are unsafe
+	to list.
+
+	@version	1.0
+	@see	Aggregate
+	@see	Aggregate_View
+*/
+class Binary
+{
+public:
+/*==============================================================================
+	Constants:
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+//!	The magic identifier at the beginning of an encoding.
+static const char
+	MAGIC[4];
+
+//!	The version of the encoding format.
+static const unsigned short
+	VERSION;
+
+//!	The size of the encoding header.
+static const std::size_t
+	HEADER_SIZE;
+
+/**	The largest number of digits of an encoded Value.
+
+	A Value with more digits - or a negative number of digits - can not
+	be encoded.
+*/
+static const int
+	MAX_DIGITS;
+
+/*==============================================================================
+	Encoding
+*/
+/**	Encodes an Aggregate hierarchy.
+
+	@param	aggregate	The Aggregate to be encoded.
+	@return	A string containing the encoding.
+	@throws	Out_of_Range	If the Aggregate hierarchy is too large to
+		be encoded, or one of its Values has digits outside the range
+		0 to #MAX_DIGITS or a Real Value has non-standard format flags.
+*/
+static std::string encode (const Aggregate& aggregate);
+
+/**	Writes the encoding of an Aggregate hierarchy.
+
+	@param	aggregate	The Aggregate to be encoded.
+	@param	out		The ostream where the encoding is to be written.
+	@throws	Out_of_Range	If the Aggregate hierarchy can not be
+		encoded.
+	@throws	IO_Failure	If the encoding could not be written.
+*/
+static void write (const Aggregate& aggregate, std::ostream& out);
+
+/*==============================================================================
+	Decoding
+*/
+/**	Decodes an Aggregate hierarchy.
+
+	@param	data	A pointer to the encoding.
+	@param	size	The size of the encoding.
+	@return	A pointer to a new Aggregate. The caller owns the Aggregate.
+	@throws	Invalid_Syntax	If the data is not a valid encoding for this
+		host. The exception location is the offset of the problem in
+		the encoding.
+*/
+static Aggregate* decode (const char* data, std::size_t size);
+
+/**	Decodes an Aggregate hierarchy.
+
+	@param	data	The encoding.
+	@return	A pointer to a new Aggregate. The caller owns the Aggregate.
+	@throws	Invalid_Syntax	If the data is not a valid encoding for this
+		host.
+	@see	decode(const char*, std::size_t)
+*/
+static Aggregate* decode (const std::string& data)
+	{return decode (data.data (), data.size ());}
+
+/**	Reads the encoding of an Aggregate hierarchy.
+
+	Everything remaining in the istream is read.
+
+	@param	in		The istream from which the encoding is read.
+	@return	A pointer to a new Aggregate. The caller owns the Aggregate.
+	@throws	Invalid_Syntax	If the data is not a valid encoding for this
+		host.
+	@throws	IO_Failure	If the istream could not be read.
+	@see	decode(const char*, std::size_t)
+*/
+static Aggregate* read (std::istream& in);
+
+private:
+//	Only static methods.
+Binary ();
+
+/*==============================================================================
+	Layout
+*/
+friend struct View_Image;
+friend class Value_View;
+friend class Parameter_View;
+friend class Aggregate_View;
+
+class Encoder;
+class Decoder;
+
+//	Counts, sizes, offsets and string table indexes.
+typedef unsigned int	Count;
+
+//	The byte order mark of the host.
+static const unsigned short
+	BYTE_ORDER_MARK;
+
+//	The parent offset of the encoded Aggregate's record.
+static const Count
+	NO_PARENT;
+
+//	The Real format flags that may be encoded.
+static const unsigned int
+	FORMAT_FLAGS;
+
+//	The CRC-32 of the data following the header.
+static unsigned int checksum (const char* data, std::size_t size);
+
+//	Tests for the encoded values that are valid.
+static bool valid_mode_state (int state);
+static bool valid_digits (int digits);
+static bool valid_base (int base);
+static bool valid_format_flags (unsigned int flags);
+
+//	Byte offsets of the header fields and of the record fields.
+enum
+	{
+	VERSION_OFFSET			= 4,
+	BYTE_ORDER_OFFSET		= 6,
+	INTEGER_SIZE_OFFSET		= 8,
+	REAL_SIZE_OFFSET		= 9,
+	CHECKSUM_OFFSET			= 12,
+	STRINGS_OFFSET			= 16,
+	NODES_OFFSET			= 20,
+	DATA_SIZE_OFFSET		= 24,
+	NODE_TABLE_OFFSET		= 28,
+
+	RECORD_TYPE				= 0,
+
+	PARAMETER_PARENT		= sizeof (int),
+	PARAMETER_NAME			= PARAMETER_PARENT + sizeof (Count),
+	PARAMETER_COMMENT		= PARAMETER_NAME + sizeof (Count),
+	PARAMETER_MODES			= PARAMETER_COMMENT + sizeof (Count),
+	PARAMETER_BODY			= PARAMETER_MODES + Parameter::TOTAL_LOCAL_MODES,
+	AGGREGATE_COUNT			= PARAMETER_BODY,
+	AGGREGATE_EXTENT		= AGGREGATE_COUNT + sizeof (Count),
+	AGGREGATE_RECORD_SIZE	= AGGREGATE_EXTENT + sizeof (Count),
+
+	VALUE_UNITS				= sizeof (int),
+	VALUE_DIGITS			= VALUE_UNITS + sizeof (Count),
+	VALUE_BASE				= VALUE_DIGITS + sizeof (int),
+	VALUE_DATUM				= VALUE_BASE + sizeof (int),
+	INTEGER_SIGNED			= VALUE_DATUM + sizeof (Value::Integer_type),
+	INTEGER_RECORD_SIZE		= INTEGER_SIGNED + 1,
+	REAL_FORMAT_FLAGS		= VALUE_DATUM + sizeof (Value::Real_type),
+	REAL_RECORD_SIZE		= REAL_FORMAT_FLAGS + sizeof (unsigned int),
+	STRING_RECORD_SIZE		= VALUE_DATUM + sizeof (Count),
+	ARRAY_COUNT				= VALUE_DATUM,
+	ARRAY_EXTENT			= ARRAY_COUNT + sizeof (Count),
+	ARRAY_RECORD_SIZE		= ARRAY_EXTENT + sizeof (Count)
+	};
+
+};		//	End of Binary class.
+
+}		//	namespace PVL
+}		//	namespace idaeim
+#endif	//	idaeim_PVL_Binary_hh
@@ -0,0 +1,509 @@
+/*	Diff
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"Diff.hh"
+#include	"PVL_Exceptions.hh"
+
+#include	<string>
+#include	<vector>
+#include	<unordered_map>
+#include	<algorithm>
+#include	<sstream>
+using std::string;
+using std::vector;
+using std::endl;
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Diff
+*/
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Diff::ID =
+		"idaeim::PVL::Diff (1.0 2026/10/18)";
+
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+//	No position.
+const unsigned int
+	NONE	= static_cast<unsigned int>(-1);
+
+//	The first position of each name in an Aggregate.
+typedef std::unordered_map<string, unsigned int>	Name_Positions;
+
+/*	Marks the longest increasing subsequence of the positions.
+
+	The positions equal to NONE are not part of any subsequence.
+*/
+void
+mark_increasing
+	(
+	const vector<unsigned int>&	positions,
+	vector<bool>&				increasing
+	)
+{
+//	Index of the smallest last position of a subsequence of each length.
+vector<unsigned int>
+	tails;
+//	Index of the preceding element in the subsequence of each element.
+vector<unsigned int>
+	previous (positions.size (), NONE);
+for (unsigned int
+		index = 0;
+		index < positions.size ();
+		index++)
+	{
+	if (positions[index] == NONE)
+		continue;
+	unsigned int
+		low = 0,
+		high = tails.size ();
+	while (low < high)
+		{
+		unsigned int
+			middle = (low + high) / 2;
+		if (positions[tails[middle]] < positions[index])
+			low = middle + 1;
+		else
+			high = middle;
+		}
+	if (low)
+		previous[index] = tails[low - 1];
+	if (low == tails.size ())
+		tails.push_back (index);
+	else
+		tails[low] = index;
+	}
+increasing.assign (positions.size (), false);
+for (unsigned int
+		index = tails.empty () ? NONE : tails.back ();
+		index != NONE;
+		index = previous[index])
+	increasing[index] = true;
+}
+
+Diff::Edit
+make_edit
+	(
+	Diff::Operation						kind,
+	const vector<unsigned int>&			path,
+	unsigned int						index,
+	const Parameter&					parameter
+	)
+{
+Diff::Edit
+	edit;
+edit.Kind = kind;
+edit.Path = path;
+edit.Index = index;
+edit.Destination = index;
+edit.Pathname = parameter.pathname ();
+return edit;
+}
+
+string
+path_description
+	(
+	const vector<unsigned int>&	path
+	)
+{
+std::ostringstream
+	description;
+description << '[';
+for (unsigned int
+		index = 0;
+		index < path.size ();
+		index++)
+	{
+	if (index)
+		description << ", ";
+	description << path[index];
+	}
+description << ']';
+return description.str ();
+}
+
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+/*==============================================================================
+	Constructors
+*/
+Diff::Diff
+	(
+	const Aggregate&	from,
+	const Aggregate&	to
+	)
+{
+vector<unsigned int>
+	path;
+if (from.structural_hash () != to.structural_hash ())
+	align (from, to, path);
+}
+
+/*==============================================================================
+	Alignment
+*/
+void
+Diff::align
+	(
+	const Aggregate&		from,
+	const Aggregate&		to,
+	vector<unsigned int>&	path
+	)
+{
+const unsigned int
+	from_size = from.size (),
+	to_size = to.size ();
+
+/*	Chain the original positions of the Parameters with the same name,
+	first to last. Aggregates and Assignments are chained separately.
+*/
+Name_Positions
+	assignments,
+	aggregates;
+assignments.reserve (from_size);
+vector<unsigned int>
+	next (from_size, NONE);
+for (unsigned int
+		index = from_size;
+		index-- > 0;)
+	{
+	const Parameter
+		&parameter = from[index];
+	std::pair<Name_Positions::iterator, bool>
+		entry = (parameter.is_Aggregate () ? aggregates : assignments)
+			.emplace (parameter.name_symbol ().str (), index);
+	if (! entry.second)
+		{
+		next[index] = entry.first->second;
+		entry.first->second = index;
+		}
+	}
+
+//	Take the next original position with the name of each Parameter.
+vector<unsigned int>
+	source (to_size, NONE);
+vector<bool>
+	matched (from_size, false);
+for (unsigned int
+		index = 0;
+		index < to_size;
+		index++)
+	{
+	const Parameter
+		&parameter = to[index];
+	Name_Positions
+		&positions = parameter.is_Aggregate () ? aggregates : assignments;
+	Name_Positions::iterator
+		entry = positions.find (parameter.name_symbol ().str ());
+	if (entry != positions.end () &&
+		entry->second != NONE)
+		{
+		source[index] = entry->second;
+		matched[entry->second] = true;
+		entry->second = next[entry->second];
+		}
+	}
+
+//	Parameters without a match are removed.
+for (unsigned int
+		index = 0;
+		index < from_size;
+		index++)
+	if (! matched[index])
+		Edits.push_back (make_edit (REMOVE, path, index, from[index]));
+
+//	Parameters out of the longest run in the original order are moved.
+vector<bool>
+	in_order;
+mark_increasing (source, in_order);
+for (unsigned int
+		index = 0;
+		index < to_size;
+		index++)
+	{
+	if (source[index] != NONE &&
+		! in_order[index])
+		{
+		Edits.push_back (make_edit (MOVE, path, source[index], to[index]));
+		Edits.back ().Destination = index;
+		}
+	}
+
+//	New Parameters are added.
+for (unsigned int
+		index = 0;
+		index < to_size;
+		index++)
+	{
+	if (source[index] == NONE)
+		{
+		Edits.push_back (make_edit (ADD, path, index, to[index]));
+		Edits.back ().Content.reset (to[index].clone ());
+		}
+	}
+
+//	Corresponding Parameters that differ are changed.
+for (unsigned int
+		index = 0;
+		index < to_size;
+		index++)
+	{
+	if (source[index] == NONE)
+		continue;
+	const Parameter
+		&original = from[source[index]],
+		&parameter = to[index];
+	if (original.structural_hash () == parameter.structural_hash ())
+		continue;
+	if (parameter.is_Aggregate ())
+		{
+		if (original.type () != parameter.type ())
+			{
+			Edits.push_back (make_edit (CHANGE, path, index, parameter));
+			Edits.back ().Content.reset
+				(new Aggregate (parameter.name (), parameter.type ()));
+			}
+		path.push_back (index);
+		align (static_cast<const Aggregate&>(original),
+			static_cast<const Aggregate&>(parameter), path);
+		path.pop_back ();
+		}
+	else
+		{
+		Edits.push_back (make_edit (CHANGE, path, index, parameter));
+		Edits.back ().Content.reset (parameter.clone ());
+		}
+	}
+}
+
+/*==============================================================================
+	Patch
+*/
+void
+Diff::apply
+	(
+	Aggregate&	aggregate
+	)
+	const
+{
+Edit_Script::const_iterator
+	first = Edits.begin (),
+	last;
+while (first != Edits.end ())
+	{
+	//	Find the edited Aggregate.
+	Aggregate
+		*target = &aggregate;
+	for (unsigned int
+			index = 0;
+			index < first->Path.size ();
+			index++)
+		{
+		if (first->Path[index] >= target->size () ||
+			! (*target)[first->Path[index]].is_Aggregate ())
+			throw Invalid_Argument
+				(
+				string ("The Diff Edit path ") + path_description (first->Path)
+				+ "\n  for " + first->Pathname
+				+ "\n  does not lead to an Aggregate in "
+				+ aggregate.pathname () + '.',
+				ID
+				);
+		target = static_cast<Aggregate*>(&(*target)[first->Path[index]]);
+		}
+
+	//	The REMOVE, MOVE and ADD Edits of an Aggregate are applied together.
+	last = first + 1;
+	if (first->Kind != CHANGE)
+		while (last != Edits.end () &&
+				last->Kind != CHANGE &&
+				last->Path == first->Path)
+			++last;
+	edit (*target, first, last);
+	first = last;
+	}
+}
+
+
+void
+Diff::edit
+	(
+	Aggregate&					aggregate,
+	Edit_Script::const_iterator	first,
+	Edit_Script::const_iterator	last
+	)
+	const
+{
+const unsigned int
+	size = aggregate.size ();
+if (first->Kind == CHANGE)
+	{
+	Parameter
+		*parameter = (first->Index < size) ? &aggregate[first->Index] : NULL;
+	if (! parameter ||
+		parameter->is_Aggregate () != first->Content->is_Aggregate ())
+		throw Invalid_Argument
+			(
+			string ("The Diff CHANGE Edit for ") + first->Pathname
+			+ "\n  does not fit the " + aggregate.pathname ()
+			+ " Aggregate.",
+			ID
+			);
+	if (parameter->is_Aggregate ())
+		parameter->type (first->Content->type ());
+	else
+		{
+		*parameter = first->Content->value ();
+		if (first->Content->is_Token ())
+			parameter->type (Parameter::TOKEN);
+		}
+	return;
+	}
+
+//	Check the Edits.
+enum {KEEP, DROP, TAKE};
+vector<char>
+	state (size, KEEP);
+unsigned int
+	removed = 0,
+	added = 0;
+Edit_Script::const_iterator
+	edit;
+for (edit = first;
+	 edit != last;
+	 ++edit)
+	{
+	if (edit->Kind == ADD)
+		++added;
+	else
+		{
+		if (edit->Index >= size ||
+			state[edit->Index] != KEEP)
+			break;
+		if (edit->Kind == REMOVE)
+			{
+			state[edit->Index] = DROP;
+			++removed;
+			}
+		else
+			state[edit->Index] = TAKE;
+		}
+	}
+unsigned int
+	total = 0;
+vector<const Edit*>
+	slots;
+if (edit == last)
+	{
+	total = size - removed + added;
+	slots.assign (total, NULL);
+	for (edit = first;
+		 edit != last;
+		 ++edit)
+		{
+		if (edit->Kind == REMOVE)
+			continue;
+		unsigned int
+			slot = (edit->Kind == MOVE) ? edit->Destination : edit->Index;
+		if (slot >= total ||
+			slots[slot] ||
+			(edit->Kind == ADD && ! edit->Content))
+			break;
+		slots[slot] = &*edit;
+		}
+	}
+if (edit != last)
+	throw Invalid_Argument
+		(
+		string ("The Diff Edit for ") + edit->Pathname
+		+ "\n  does not fit the " + aggregate.pathname ()
+		+ " Aggregate.",
+		ID
+		);
+
+/*	Rebuild the Parameter list: moved and added Parameters fill their
+	slots and the kept Parameters fill the others in their order.
+*/
+vector<Parameter*>
+	original (size);
+for (unsigned int
+		index = size;
+		index-- > 0;)
+	original[index] = aggregate.pull_back ();
+unsigned int
+	kept = 0;
+for (unsigned int
+		slot = 0;
+		slot < total;
+		slot++)
+	{
+	if (slots[slot])
+		{
+		if (slots[slot]->Kind == MOVE)
+			aggregate.poke_back (original[slots[slot]->Index]);
+		else
+			aggregate.poke_back (slots[slot]->Content->clone ());
+		}
+	else
+		{
+		while (state[kept] != KEEP)
+			++kept;
+		aggregate.poke_back (original[kept++]);
+		}
+	}
+for (unsigned int
+		index = 0;
+		index < size;
+		index++)
+	if (state[index] == DROP)
+		delete original[index];
+}
+
+/*==============================================================================
+	Functions
+*/
+std::ostream&
+operator<<
+	(
+	std::ostream&	out,
+	const Diff&		diff
+	)
+{
+static const char
+	OPERATION_MARKS[] = {'-', '>', '+', '~'};
+for (Diff::Edit_Script::const_iterator
+		edit = diff.edits ().begin ();
+		edit != diff.edits ().end ();
+		++edit)
+	out << OPERATION_MARKS[edit->Kind] << ' ' << edit->Pathname << endl;
+return out;
+}
+
+}		//	namespace PVL
+}		//	namespace idaeim
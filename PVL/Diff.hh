@@ -0,0 +1,262 @@
+/*	Diff
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#ifndef idaeim_PVL_Diff_hh
+#define idaeim_PVL_Diff_hh
+
+#include	"Parameter.hh"
+
+#include	<string>
+#include	<vector>
+#include	<memory>
+#include	<iostream>
+#include	<cstddef>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Diff
+*/
+/**	A <i>Diff</i> is an edit script that transforms the contents of one
+	Aggregate hierarchy into the contents of another.
+
+	The Parameters contained by each pair of corresponding Aggregates are
+	aligned by name: the first Parameter with a given name in one
+	Aggregate corresponds to the first Parameter with the same name in
+	the other Aggregate, the second to the second, and so on. An
+	Aggregate only corresponds to an Aggregate and an Assignment only to
+	an Assignment. Each pair of corresponding Parameters with the same
+	{@link Parameter::structural_hash() structural hash} is skipped
+	without further examination, so once the hashes of both hierarchies
+	have been saved the cost of a Diff is proportional to the number of
+	Parameters in the Aggregates that differ. The saved hashes are
+	discarded whenever a Parameter, or a Value it contains, is changed -
+	including changes made through the {@link Assignment::value() value}
+	reference of an Assignment - so a Diff never relies on an out of
+	date hash. Since the hashes are 64 bits, the chance that a
+	difference is missed because two different Parameters have the same
+	hash is negligible.
+
+	The edit script lists the differences as a sequence of {@link Edit
+	Edits}:
+
+<dl>
+<dt>REMOVE
+<dd>A Parameter without a corresponding Parameter in the other
+	Aggregate is removed.
+
+<dt>MOVE
+<dd>A Parameter that has a corresponding Parameter at a different
+	relative position is moved. The fewest Parameters are moved that
+	will leave all the others in their order.
+
+<dt>ADD
+<dd>A copy of a Parameter without a corresponding Parameter in the
+	original Aggregate is inserted.
+
+<dt>CHANGE
+<dd>The Value of an Assignment, or the Type of an Aggregate, is
+	replaced.
+</dl>
+
+	Corresponding Aggregates with different hashes are compared
+	recursively. Comments and syntax modes of corresponding Parameters
+	are not compared, and the Aggregates from which the Diff is made are
+	not themselves compared - only their contents.
+
+	A Diff is {@link apply(Aggregate&) const applied} to a copy of the
+	original Aggregate, or to any Aggregate with the same structure, to
+	patch it. The Diff holds copies of the Parameters it adds, so it
+	does not depend on the Aggregates from which it was made.
+
+	@version	1.0
+	@see	Parameter::equivalent(const Parameter&) const
+*/
+class Diff
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	The kinds of Edit.
+enum Operation
+	{
+	REMOVE,
+	MOVE,
+	ADD,
+	CHANGE
+	};
+
+/**	An <i>Edit</i> is one step of an edit script.
+
+	The Edits for the Parameters of each Aggregate are applied together:
+	The Index of a REMOVE or MOVE Edit is the position of the Parameter
+	in the Aggregate before any of its Edits are applied, and the
+	Destination of a MOVE Edit and the Index of an ADD or CHANGE Edit
+	are the position of the Parameter after they are all applied.
+*/
+struct Edit
+{
+//!	The kind of Edit.
+Operation
+	Kind;
+
+/**	The positions of the Aggregates, from the patched Aggregate down
+	to the Aggregate containing the edited Parameter, after their Edits
+	have been applied.
+*/
+std::vector<unsigned int>
+	Path;
+
+//!	The position of the edited Parameter.
+unsigned int
+	Index;
+
+//!	The final position of a moved Parameter.
+unsigned int
+	Destination;
+
+/**	The Parameter that is added, or a Parameter with the Value or Type
+	of a changed Parameter. NULL for a REMOVE or MOVE Edit.
+*/
+std::shared_ptr<const Parameter>
+	Content;
+
+/**	The pathname of the edited Parameter, for reference. This is the
+	pathname in the original Aggregate for a REMOVE Edit, and in the
+	other Aggregate for any other Edit.
+*/
+std::string
+	Pathname;
+};
+
+//!	An edit script.
+typedef std::vector<Edit>	Edit_Script;
+
+/*==============================================================================
+	Constants:
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Makes the edit script that transforms the contents of an Aggregate
+	into the contents of another Aggregate.
+
+	@param	from	The original Aggregate.
+	@param	to		The Aggregate with the contents to be produced.
+*/
+Diff (const Aggregate& from, const Aggregate& to);
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the edit script.
+
+	@return	The Edits in the order they are applied.
+*/
+const Edit_Script& edits () const
+	{return Edits;}
+
+/**	Gets the number of Edits.
+
+	@return	The size of the edit script.
+*/
+std::size_t size () const
+	{return Edits.size ();}
+
+/**	Tests if there are no differences.
+
+	@return	true if the edit script is empty; false otherwise.
+*/
+bool empty () const
+	{return Edits.empty ();}
+
+/*==============================================================================
+	Patch
+*/
+/**	Applies the edit script to an Aggregate.
+
+	Applying the Diff to a copy of the original Aggregate produces an
+	Aggregate whose contents are {@link Parameter::equivalent(const
+	Parameter&) const equivalent} to the other Aggregate; the
+	comments of the Parameters that were not added are unchanged.
+
+	<b>N.B.</b>: The Edits for each Aggregate are checked against it
+	before they are applied, but when an Edit that does not fit is
+	found the Edits that preceded it remain applied.
+
+	@param	aggregate	The Aggregate to be patched.
+	@throws	Invalid_Argument	If an Edit does not fit the Aggregate:
+		the Path does not lead to an Aggregate, a position is out of
+		range, or a changed Parameter is not the same kind of
+		Parameter as the Content.
+*/
+void apply (Aggregate& aggregate) const;
+
+/*==============================================================================
+	Private
+*/
+private:
+
+void align
+	(
+	const Aggregate&			from,
+	const Aggregate&			to,
+	std::vector<unsigned int>&	path
+	);
+
+void edit
+	(
+	Aggregate&					aggregate,
+	Edit_Script::const_iterator	first,
+	Edit_Script::const_iterator	last
+	)
+	const;
+
+Edit_Script
+	Edits;
+
+};		//	End of Diff class.
+
+/*==============================================================================
+	Functions
+*/
+/**	Lists an edit script on an output stream.
+
+	Each Edit is listed on a separate line as a character identifying
+	its Operation - '-' for REMOVE, '&gt;' for MOVE, '+' for ADD and
+	'~' for CHANGE - followed by the pathname of the edited Parameter.
+
+	@param	out	The ostream to receive the listing.
+	@param	diff	The Diff to be listed.
+	@return	The out ostream.
+*/
+std::ostream& operator<< (std::ostream& out, const Diff& diff);
+
+}		//	namespace PVL
+}		//	namespace idaeim
+#endif	//	idaeim_PVL_Diff_hh
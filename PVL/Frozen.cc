@@ -0,0 +1,452 @@
+/*	Frozen
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"Frozen.hh"
+#include	"Arena.hh"
+#include	"Parser.hh"
+
+#include	<string>
+#include	<vector>
+#include	<unordered_map>
+#include	<cctype>
+using std::string;
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Frozen
+*/
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Frozen::ID =
+		"idaeim::PVL::Frozen (1.0 2026/10/18)";
+
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+string
+uppercase
+	(
+	const string&	text
+	)
+{
+string
+	upper (text);
+for (string::iterator
+		character = upper.begin ();
+	 character != upper.end ();
+	 ++character)
+	*character = (char)toupper (*character);
+return upper;
+}
+
+inline bool
+same_character
+	(
+	char	character_1,
+	char	character_2,
+	bool	case_sensitive
+	)
+{
+return
+	character_1 == character_2 ||
+	(! case_sensitive && toupper (character_1) == toupper (character_2));
+}
+
+//	Tests if text ends with a suffix.
+bool
+ends_with
+	(
+	const string&	text,
+	const string&	suffix,
+	bool			case_sensitive
+	)
+{
+if (suffix.length () > text.length ())
+	return false;
+for (string::size_type
+		index = text.length () - suffix.length (),
+		suffix_index = 0;
+	 suffix_index < suffix.length ();
+	 ++index, ++suffix_index)
+	if (! same_character (text[index], suffix[suffix_index], case_sensitive))
+		return false;
+return true;
+}
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+/*==============================================================================
+	Snapshot
+*/
+/*	The frozen data.
+
+	The Root is a copy of the frozen Aggregate whose nodes were allocated
+	from an Arena. Each Parameter contained by the Root is entered, in
+	depth-first order, in the Parameters table along with its absolute
+	Pathname relative to the Root. The Relative form of the pathname is
+	what a relative pathname is matched against: the Root's name is
+	included unless it is the Parser::CONTAINER_NAME, just as
+	Parameter::at_pathname ascends to the Root but not to a
+	CONTAINER_NAME Aggregate. The index lists the table entries under
+	the uppercase Pathname and under the uppercase last segment of the
+	Parameter's name.
+
+	Nothing is modified once the constructor completes.
+*/
+struct Frozen::Snapshot
+{
+typedef std::unordered_map<string, std::vector<std::size_t> >	Map;
+
+Aggregate
+	*Root;
+char
+	Delimiter;
+std::vector<const Parameter*>
+	Parameters;
+std::vector<string>
+	Pathnames,
+	Relative;
+Map
+	Absolute_Index,
+	Name_Index;
+
+explicit Snapshot (const Aggregate& aggregate);
+
+~Snapshot ()
+	{delete Root;}
+
+void add (const Aggregate& aggregate, const string& path,
+	const string& relative);
+
+private:
+Snapshot (const Snapshot&);
+Snapshot& operator= (const Snapshot&);
+};
+
+
+Frozen::Snapshot::Snapshot
+	(
+	const Aggregate&	aggregate
+	)
+	:	Root (NULL),
+		Delimiter (Parameter::path_delimiter ())
+{
+Arena
+	*arena = new Arena;
+try
+	{
+	Arena::Scope
+		scope (arena);
+	Root = new Aggregate (aggregate);
+	}
+catch (...)
+	{
+	arena->release ();
+	throw;
+	}
+//	The Arena remains until all of its nodes have been deleted.
+arena->release ();
+
+try
+	{
+	string::size_type
+		total = Root->total_size ();
+	Parameters.reserve (total);
+	Pathnames.reserve (total);
+	Relative.reserve (total);
+	add (*Root, "",
+		(Root->name () == Parser::CONTAINER_NAME) ? "" : Root->name ());
+	}
+catch (...)
+	{
+	delete Root;
+	throw;
+	}
+}
+
+
+void
+Frozen::Snapshot::add
+	(
+	const Aggregate&	aggregate,
+	const string&		path,
+	const string&		relative
+	)
+{
+//	Readers must find the depth-first offsets already built.
+aggregate.build_depth_offsets ();
+for (Aggregate::const_iterator
+		element = aggregate.begin ();
+	 element != aggregate.end ();
+	 ++element)
+	{
+	const Parameter
+		*parameter = &(*element);
+	const string
+		&name = parameter->name_symbol ().str ();
+	string
+		pathname (path),
+		relative_pathname (relative);
+	pathname += Delimiter;
+	pathname += name;
+	relative_pathname += Delimiter;
+	relative_pathname += name;
+
+	std::size_t
+		entry = Parameters.size ();
+	Parameters.push_back (parameter);
+	Absolute_Index[uppercase (pathname)].push_back (entry);
+	Name_Index[uppercase (name.substr (name.rfind (Delimiter) + 1))]
+		.push_back (entry);
+	Pathnames.push_back (pathname);
+	Relative.push_back (relative_pathname);
+
+	if (parameter->is_Aggregate ())
+		add (static_cast<const Aggregate&>(*parameter),
+			pathname, relative_pathname);
+	else
+	if (parameter->value ().is_Array ())
+		static_cast<const Array&>(parameter->value ())
+			.build_depth_offsets ();
+	}
+}
+
+/*==============================================================================
+	Constructors
+*/
+Frozen::Frozen ()
+	:	Frozen_Snapshot (new Snapshot (Aggregate (Parser::CONTAINER_NAME)))
+{}
+
+
+Frozen::Frozen
+	(
+	const Aggregate&	aggregate
+	)
+	:	Frozen_Snapshot (new Snapshot (aggregate))
+{}
+
+/*==============================================================================
+	Accessors
+*/
+const Aggregate&
+Frozen::root () const
+{return *Frozen_Snapshot->Root;}
+
+
+char
+Frozen::path_delimiter () const
+{return Frozen_Snapshot->Delimiter;}
+
+
+std::size_t
+Frozen::size () const
+{return Frozen_Snapshot->Parameters.size ();}
+
+
+const Parameter&
+Frozen::operator[]
+	(
+	std::size_t	index
+	)
+	const
+{return *Frozen_Snapshot->Parameters[index];}
+
+
+const std::string&
+Frozen::pathname
+	(
+	std::size_t	index
+	)
+	const
+{return Frozen_Snapshot->Pathnames[index];}
+
+
+Frozen::const_iterator
+Frozen::begin () const
+{return Frozen_Snapshot->Parameters.begin ();}
+
+
+Frozen::const_iterator
+Frozen::end () const
+{return Frozen_Snapshot->Parameters.end ();}
+
+/*==============================================================================
+	Find
+*/
+template<typename Visitor>
+void
+Frozen::search
+	(
+	const std::string&				pathname,
+	bool							case_sensitive,
+	idaeim::PVL::Parameter::Type	type,
+	Visitor							visit
+	)
+	const
+{
+const Snapshot
+	&snapshot = *Frozen_Snapshot;
+if (pathname.empty ())
+	return;
+bool
+	absolute = pathname[0] == snapshot.Delimiter;
+string
+	key (uppercase (pathname));
+if (! absolute)
+	key.erase (0, key.rfind (snapshot.Delimiter) + 1);
+const Snapshot::Map
+	&index = absolute ? snapshot.Absolute_Index : snapshot.Name_Index;
+Snapshot::Map::const_iterator
+	candidates = index.find (key);
+if (candidates == index.end ())
+	return;
+
+for (std::vector<std::size_t>::const_iterator
+		candidate = candidates->second.begin ();
+	 candidate != candidates->second.end ();
+	 ++candidate)
+	{
+	const Parameter
+		*parameter = snapshot.Parameters[*candidate];
+	if (! parameter->is (type))
+		continue;
+	if (absolute)
+		{
+		//	An uppercase absolute pathname key is an exact match.
+		if (case_sensitive &&
+			snapshot.Pathnames[*candidate] != pathname)
+			continue;
+		}
+	else
+		{
+		/*	A relative pathname must end the Relative pathname, either
+			entirely or following a delimiter.
+		*/
+		const string
+			&relative = snapshot.Relative[*candidate];
+		if (! ends_with (relative, pathname, case_sensitive) ||
+			(relative.length () != pathname.length () &&
+			 relative[relative.length () - pathname.length () - 1]
+				!= snapshot.Delimiter))
+			continue;
+		}
+	if (! visit (parameter))
+		break;
+	}
+}
+
+
+const Parameter*
+Frozen::find
+	(
+	const std::string&				pathname,
+	bool							case_sensitive,
+	int								skip,
+	idaeim::PVL::Parameter::Type	type
+	)
+	const
+{
+if (skip < 0)
+	skip = 0;
+const Parameter
+	*found = NULL;
+search (pathname, case_sensitive, type,
+	[&found, &skip] (const Parameter* parameter)
+	{
+	if (skip--)
+		return true;
+	found = parameter;
+	return false;
+	});
+return found;
+}
+
+
+std::vector<const Parameter*>
+Frozen::find_all
+	(
+	const std::string&				pathname,
+	bool							case_sensitive,
+	idaeim::PVL::Parameter::Type	type
+	)
+	const
+{
+std::vector<const Parameter*>
+	found;
+search (pathname, case_sensitive, type,
+	[&found] (const Parameter* parameter)
+	{
+	found.push_back (parameter);
+	return true;
+	});
+return found;
+}
+
+
+int
+Frozen::find_count
+	(
+	const std::string&				pathname,
+	bool							case_sensitive,
+	idaeim::PVL::Parameter::Type	type
+	)
+	const
+{
+int
+	count = 0;
+search (pathname, case_sensitive, type,
+	[&count] (const Parameter*)
+	{
+	++count;
+	return true;
+	});
+return count;
+}
+
+
+void
+Frozen::select
+	(
+	Aggregate::Selection*	selections
+	)
+	const
+{
+//	The Conventions apply only to this thread.
+Parameter::Conventions
+	conventions (Frozen_Snapshot->Delimiter, Parameter::case_sensitive ());
+Frozen_Snapshot->Root->select (selections);
+}
+
+/*==============================================================================
+	Aggregate
+*/
+Frozen
+Aggregate::freeze () const
+{return Frozen (*this);}
+
+}		//	namespace PVL
+}		//	namespace idaeim
@@ -0,0 +1,295 @@
+/*	Frozen
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#ifndef idaeim_PVL_Frozen_hh
+#define idaeim_PVL_Frozen_hh
+
+#include	"Parameter.hh"
+
+#include	<string>
+#include	<vector>
+#include	<memory>
+#include	<cstddef>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Frozen
+*/
+/**	A <i>Frozen</i> Aggregate is an immutable snapshot of an Aggregate
+	hierarchy that may be read by any number of threads at the same
+	time.
+
+	A Frozen snapshot is made by {@link Aggregate::freeze() const
+	freezing} an Aggregate. The entire hierarchy is copied into a single
+	{@link Arena Arena}, so the snapshot's nodes are compact, and a
+	table of all the snapshot's Parameters, in depth-first order, and a
+	hash index of their pathnames are built at the same time. Nothing is
+	changed after that: the snapshot's Parameters are only accessible
+	as const objects, their addresses never change while any handle to
+	the snapshot exists, and no read method modifies any shared state.
+	In particular, unlike the {@link Aggregate::indexed(bool) pathname
+	index} of an Aggregate, the snapshot index is never rebuilt and is
+	read without any lock. Likewise, the depth-first offsets that
+	Depth_Iterators use to step through long Aggregate and Array lists
+	are all built with the snapshot, so a traversal never builds them.
+
+	The read methods are {@link find(const std::string&, bool, int,
+	Parameter::Type) const find}, {@link find_all(const std::string&,
+	bool, Parameter::Type) const find_all}, {@link select(Aggregate::Selection*)
+	const select}, iteration over the Parameter table and, through the
+	{@link root() const root} Aggregate, Depth_Iterator traversal and
+	listing with a Lister. None of them takes a lock. Each thread must,
+	of course, use its own iterators and Lister.
+
+	Pathnames are always interpreted with the {@link path_delimiter()
+	const pathname delimiter} that was in effect when the snapshot was
+	made, regardless of the current thread's {@link
+	Parameter::Conventions conventions}.
+
+	A Frozen object is a handle to the snapshot: copying it does not
+	copy the snapshot, and the snapshot is deleted when its last handle
+	is destroyed. The reference count is atomic, so handles to the same
+	snapshot may be copied and destroyed by different threads.
+
+	<b>Memory ordering</b>: The snapshot is completely built before
+	freeze returns and is never written afterwards. A reader thread
+	needs only a happens-before relation with the completion of freeze,
+	which is provided by any of the usual ways of handing the handle to
+	the thread: passing it to the std::thread constructor, storing it
+	under a mutex that the reader also locks, or a release store paired
+	with an acquire load of a std::atomic pointer to the handle. After
+	that the reader's loads need no ordering at all. A single Frozen
+	handle object is no more thread safe than a std::shared_ptr: it may
+	be read by many threads, but a thread that assigns a new snapshot to
+	a handle must not do so while other threads are reading the same
+	handle object.
+
+	@version	1.0
+	@see	Aggregate::freeze() const
+*/
+class Frozen
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Iterator over the snapshot's Parameter table.
+typedef std::vector<const Parameter*>::const_iterator	const_iterator;
+
+/*==============================================================================
+	Constants:
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs a snapshot of an empty Aggregate.
+*/
+Frozen ();
+
+/**	Constructs a snapshot of an Aggregate hierarchy.
+
+	@param	aggregate	The Aggregate to be copied. It is not modified.
+	@see	Aggregate::freeze() const
+*/
+explicit Frozen (const Aggregate& aggregate);
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the root of the snapshot.
+
+	@return	A reference to the snapshot's copy of the frozen Aggregate.
+*/
+const Aggregate& root () const;
+
+/**	Gets the pathname delimiter of the snapshot.
+
+	@return	The pathname delimiter character that was in effect when
+		the snapshot was made.
+*/
+char path_delimiter () const;
+
+/**	Gets the number of Parameters in the snapshot.
+
+	@return	The number of Parameters contained, at any depth, by the
+		{@link root() const root} Aggregate.
+*/
+std::size_t size () const;
+
+/**	Gets a Parameter from the snapshot's Parameter table.
+
+	@param	index	The depth-first order index of the Parameter. This
+		must be less than the {@link size() const size} of the snapshot.
+	@return	A reference to the Parameter.
+*/
+const Parameter& operator[] (std::size_t index) const;
+
+/**	Gets the pathname of a Parameter in the snapshot's Parameter table.
+
+	@param	index	The depth-first order index of the Parameter. This
+		must be less than the {@link size() const size} of the snapshot.
+	@return	The absolute pathname of the Parameter relative to the
+		root of the snapshot.
+*/
+const std::string& pathname (std::size_t index) const;
+
+/**	Gets an iterator at the beginning of the Parameter table.
+
+	The Parameter table lists every Parameter in the snapshot in
+	depth-first order; the same order as an Aggregate::Depth_Iterator
+	over the {@link root() const root} Aggregate.
+
+	@return	A const_iterator to the first Parameter pointer.
+*/
+const_iterator begin () const;
+
+/**	Gets an iterator at the end of the Parameter table.
+
+	@return	A const_iterator past the last Parameter pointer.
+*/
+const_iterator end () const;
+
+/*==============================================================================
+	Find
+*/
+/**	Find a named Parameter.
+
+	The Parameters are matched using the same criteria as {@link
+	Aggregate::find(const std::string&, bool, int, Parameter::Type)
+	const Aggregate::find}, in the same order. However, the candidates
+	are always obtained from the snapshot index, which lists every
+	Parameter under its uppercase absolute pathname and its uppercase
+	name.
+
+	@param	pathname	The pathname of the parameter to find.
+	@param	case_sensitive	If true, the name search is case
+		sensitive; case insensitive otherwise.
+	@param	skip		The number of parameters that match the
+		criteria to skip before selecting a matching parameter. A
+		value less than or equal to zero selects the first match.
+	@param	type		A Type code that specifies the type of Parameter
+		that is to be selected. By default any Type (ASSIGNMENT or
+		AGGREGATE) will be acceptable.
+	@return	A pointer to the matching parameter, or NULL if a match
+		could not be found.
+*/
+const Parameter*
+find
+	(
+	const std::string&				pathname,
+	bool							case_sensitive = false,
+	int								skip = 0,
+	idaeim::PVL::Parameter::Type	type
+		= (Parameter::Type)(Parameter::ASSIGNMENT | Parameter::AGGREGATE)
+	)
+	const;
+
+/**	Find all the Parameters at a pathname.
+
+	@param	pathname	The pathname of the Parameters to find.
+	@param	case_sensitive	If true, the name search is case
+		sensitive; case insensitive otherwise.
+	@param	type		A Type code that specifies the type of Parameter
+		that is to be selected. By default any Type (ASSIGNMENT or
+		AGGREGATE) will be acceptable.
+	@return	A vector of pointers to the matching Parameters in
+		depth-first order.
+	@see	find(const std::string&, bool, int, Parameter::Type) const
+*/
+std::vector<const Parameter*>
+find_all
+	(
+	const std::string&				pathname,
+	bool							case_sensitive = false,
+	idaeim::PVL::Parameter::Type	type
+		= (Parameter::Type)(Parameter::ASSIGNMENT | Parameter::AGGREGATE)
+	)
+	const;
+
+/**	Count the Parameters at a pathname.
+
+	@param	pathname	The pathname of the Parameters to count.
+	@param	case_sensitive	If true, the name search is case
+		sensitive; case insensitive otherwise.
+	@param	type		A Type code that specifies the type of Parameter
+		that is to be counted. By default any Type (ASSIGNMENT or
+		AGGREGATE) will be counted.
+	@return	The number of Parameters that {@link find_all(const
+		std::string&, bool, Parameter::Type) const find_all} would
+		obtain.
+*/
+int
+find_count
+	(
+	const std::string&				pathname,
+	bool							case_sensitive = false,
+	idaeim::PVL::Parameter::Type	type
+		= (Parameter::Type)(Parameter::ASSIGNMENT | Parameter::AGGREGATE)
+	)
+	const;
+
+/**	Select Parameter values.
+
+	The selections are resolved by the {@link root() const root}
+	Aggregate's {@link Aggregate::select(Aggregate::Selection*) const
+	select} method with the snapshot's pathname delimiter in effect for
+	the current thread.
+
+	@param	selections	An array of Selection structures terminated
+		by an empty Selection.
+*/
+void select (Aggregate::Selection* selections) const;
+
+/*==============================================================================
+	Private
+*/
+private:
+
+struct Snapshot;
+
+/*	Applies a visitor to each matching Parameter, in depth-first order,
+	until the visitor returns false.
+*/
+template<typename Visitor>
+void search
+	(
+	const std::string&				pathname,
+	bool							case_sensitive,
+	idaeim::PVL::Parameter::Type	type,
+	Visitor							visit
+	)
+	const;
+
+std::shared_ptr<const Snapshot>
+	Frozen_Snapshot;
+
+};		//	End of Frozen class.
+
+}		//	namespace PVL
+}		//	namespace idaeim
+#endif	//	idaeim_PVL_Frozen_hh
@@ -70,16 +70,17 @@ Lister::Lister
 	(
 	std::ostream&	out
 	)
-	:	Strict_NL_Characters (Default_Strict_NL_Characters),
-		Informal_NL_Characters (Default_Informal_NL_Characters),
-		Page_Width (Default_Page_Width),
-		Indent_Width (Default_Indent_Width),
+	:	Strict_NL_Characters (defaults ().Strict_NL_Characters),
+		Informal_NL_Characters (defaults ().Informal_NL_Characters),
+		Page_Width (defaults ().Page_Width),
+		Indent_Width (defaults ().Indent_Width),
 		Assign_Align_Depth (0),
+		Compact (defaults ().Compact),
 		Output (&out),
 		Total_Written (0)
 {
 strict (STRICT);
-modes (modes (DEFAULT_MODE_SET));
+modes (NULL, LOCAL_MODE_SET);
 }
 
 
@@ -87,6 +88,7 @@ Lister::Lister
 	(
 	const Lister& lister
 	)
+	:	Compact (lister.Compact)
 {
 //	Copy the syntax modes.
 modes (lister.modes ());
@@ -95,23 +97,49 @@ modes (lister.modes ());
 /*==============================================================================
 	Syntax modes
 */
-int
-	Lister::Default_Page_Width			= PAGE_WIDTH,
-	Lister::Default_Indent_Width		= INDENT_WIDTH;
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+/*	The new-line sequence is identified by comparing its address with
+	those of the strict and informal sequences.
+*/
+const char
+	INFORMAL_NL[]	= INFORMAL_NL_STRING,
+	STRICT_NL[]		= STRICT_NL_STRING;
 
-bool
-	Lister::Default_Modes[TOTAL_MODES]	=
+thread_local Lister::Defaults
+	*Current_Defaults = NULL;
+}
+#endif
+
+Lister::Default_Settings
+	Lister::Process_Defaults =
 		{
-		BEGIN_AGGREGATES,
-		UPPERCASE_AGGREGATES,
-		NAME_END_AGGREGATES,
-		ASSIGN_ALIGN,
-		ARRAY_INDENTING,
-		USE_STATEMENT_DELIMITER,
-		SINGLE_LINE_COMMENTS,
-		LIST_VERBATIM_STRINGS
+			{
+			BEGIN_AGGREGATES,
+			UPPERCASE_AGGREGATES,
+			NAME_END_AGGREGATES,
+			ASSIGN_ALIGN,
+			ARRAY_INDENTING,
+			USE_STATEMENT_DELIMITER,
+			SINGLE_LINE_COMMENTS,
+			LIST_VERBATIM_STRINGS
+			},
+		STRICT ? STRICT_NL : INFORMAL_NL,
+		STRICT_NL,
+		INFORMAL_NL,
+		PAGE_WIDTH,
+		INDENT_WIDTH,
+		COMPACT_LISTING
 		};
 
+std::atomic<int>
+	&Lister::Default_Page_Width			= Process_Defaults.Page_Width,
+	&Lister::Default_Indent_Width		= Process_Defaults.Indent_Width;
+
+std::atomic<bool>
+	(&Lister::Default_Modes)[TOTAL_MODES]	= Process_Defaults.Modes;
+
 const bool
 	Lister::STRICT_MODES[TOTAL_MODES]	=
 		{
@@ -129,13 +157,46 @@ const Lister::Which_Mode
 	Lister::DEFAULT_MODE_SET			= {0},
 	Lister::LOCAL_MODE_SET				= {1};
 	
-const char
-	*Lister::Default_Informal_NL_Characters	= INFORMAL_NL_STRING,
-	*Lister::Default_Strict_NL_Characters	= STRICT_NL_STRING,
-	*Lister::Default_New_Line				=
-		STRICT ?
-			Default_Strict_NL_Characters :
-			Default_Informal_NL_Characters;
+std::atomic<const char*>
+	&Lister::Default_Informal_NL_Characters	=
+		Process_Defaults.Informal_NL_Characters,
+	&Lister::Default_Strict_NL_Characters		=
+		Process_Defaults.Strict_NL_Characters,
+	&Lister::Default_New_Line					=
+		Process_Defaults.New_Line;
+
+
+Lister::Default_Settings&
+Lister::defaults ()
+{
+return Current_Defaults ?
+	Current_Defaults->Settings : Process_Defaults;
+}
+
+/*------------------------------------------------------------------------------
+	Defaults
+*/
+Lister::Defaults::Defaults ()
+	:	Previous (Current_Defaults)
+{
+const Default_Settings
+	&settings = defaults ();
+for (int selection = 0;
+		 selection < TOTAL_MODES;
+		 selection++)
+	Settings.Modes[selection] = settings.Modes[selection].load ();
+Settings.New_Line = settings.New_Line.load ();
+Settings.Strict_NL_Characters = settings.Strict_NL_Characters.load ();
+Settings.Informal_NL_Characters = settings.Informal_NL_Characters.load ();
+Settings.Page_Width = settings.Page_Width.load ();
+Settings.Indent_Width = settings.Indent_Width.load ();
+Settings.Compact = settings.Compact.load ();
+Current_Defaults = this;
+}
+
+
+Lister::Defaults::~Defaults ()
+{Current_Defaults = Previous;}
 
 
 Lister&
@@ -148,30 +209,68 @@ Lister::modes
 if (mode_set)
 	{
 	//	Apply the user's mode set.
-	bool
-		*set = (which == LOCAL_MODE_SET) ? Modes : Default_Modes;
-	for (int selection = 0;
-			 selection < TOTAL_MODES;
-			 selection++)
-		set[selection] = mode_set[selection];
+	if (which == LOCAL_MODE_SET)
+		for (int selection = 0;
+				 selection < TOTAL_MODES;
+				 selection++)
+			Modes[selection] = mode_set[selection];
+	else
+		{
+		std::atomic<bool>
+			*set = defaults ().Modes;
+		for (int selection = 0;
+				 selection < TOTAL_MODES;
+				 selection++)
+			set[selection] = mode_set[selection];
+		}
 	}
 else if (which == LOCAL_MODE_SET)
+	{
 	//	Apply the default modes to the local modes.
+	const std::atomic<bool>
+		*set = defaults ().Modes;
 	for (int selection = 0;
 			 selection < TOTAL_MODES;
 			 selection++)
-		Modes[selection] = Default_Modes[selection];
+		Modes[selection] = set[selection];
+	}
 else
+	{
 	//	Apply the built-in modes to the default modes.
+	std::atomic<bool>
+		*set = defaults ().Modes;
 	for (int selection = 0;
 			 selection < TOTAL_MODES;
 			 selection++)
-		Default_Modes[selection] = (STRICT) ?
+		set[selection] = (STRICT) ?
 			STRICT_MODES[selection] : ! STRICT_MODES[selection];
+	}
 return *this;
 }
 
 
+const bool*
+Lister::modes
+	(
+	const Which_Mode&	which
+	)
+	const
+{
+if (which == LOCAL_MODE_SET)
+	return Modes;
+//	The atomic default modes are copied for the caller.
+thread_local bool
+	default_modes[TOTAL_MODES];
+const std::atomic<bool>
+	*set = defaults ().Modes;
+for (int selection = 0;
+		 selection < TOTAL_MODES;
+		 selection++)
+	default_modes[selection] = set[selection];
+return default_modes;
+}
+
+
 Lister&
 Lister::strict
 	(
@@ -200,13 +299,15 @@ Lister::default_strict
 	const bool	enabled
 	)
 {
+Default_Settings
+	&settings = defaults ();
 for (int selection = 0;
 		 selection < TOTAL_MODES;
 		 selection++)
-	Default_Modes[selection] = enabled ?
+	settings.Modes[selection] = enabled ?
 		STRICT_MODES[selection] : ! STRICT_MODES[selection];
-Default_New_Line = (enabled ?
-	Default_Strict_NL_Characters : Default_Informal_NL_Characters);
+settings.New_Line = (enabled ?
+	settings.Strict_NL_Characters : settings.Informal_NL_Characters).load ();
 }
 
 bool
@@ -229,12 +330,14 @@ return New_Line == Strict_NL_Characters;
 bool
 Lister::default_strict ()
 {
+const Default_Settings
+	&settings = defaults ();
 for (int selection = 0;
 		 selection < TOTAL_MODES;
 		 selection++)
-	if (Default_Modes[selection] != STRICT_MODES[selection])
+	if (settings.Modes[selection] != STRICT_MODES[selection])
 		return false;
-return Default_New_Line == Default_Strict_NL_Characters;
+return settings.New_Line == settings.Strict_NL_Characters;
 }
 
 
@@ -260,9 +363,11 @@ Lister::default_NL
 	const char*			new_line_characters
 	)
 {
-Default_New_Line = default_strict () ?
-	(Default_Strict_NL_Characters = new_line_characters) :
-	(Default_Informal_NL_Characters = new_line_characters);
+Default_Settings
+	&settings = defaults ();
+settings.New_Line = default_strict () ?
+	(settings.Strict_NL_Characters = new_line_characters) :
+	(settings.Informal_NL_Characters = new_line_characters);
 }
 
 Lister&
@@ -282,11 +387,13 @@ if ((which == LOCAL_MODE_SET))
 	}
 else
 	{
+	Default_Settings
+		&settings = defaults ();
 	const char
-		*characters = Default_Informal_NL_Characters;
-	Default_Informal_NL_Characters = new_line_characters;
-	if (Default_New_Line == characters)
-		Default_New_Line = Default_Informal_NL_Characters;
+		*characters = settings.Informal_NL_Characters;
+	settings.Informal_NL_Characters = new_line_characters;
+	if (settings.New_Line == characters)
+		settings.New_Line = new_line_characters;
 	}
 return *this;
 }
@@ -308,11 +415,13 @@ if ((which == LOCAL_MODE_SET))
 	}
 else
 	{
+	Default_Settings
+		&settings = defaults ();
 	const char
-		*characters = Default_Strict_NL_Characters;
-	Default_Strict_NL_Characters = new_line_characters;
-	if (Default_New_Line == characters)
-		Default_New_Line = Default_Strict_NL_Characters;
+		*characters = settings.Strict_NL_Characters;
+	settings.Strict_NL_Characters = new_line_characters;
+	if (settings.New_Line == characters)
+		settings.New_Line = new_line_characters;
 	}
 return *this;
 }
@@ -337,6 +446,75 @@ transform (characters.begin (), characters.end (),
 	characters.begin (), toupper);
 return characters;
 }
+
+
+/*	Tests if a string has characters that translate_to_escape_sequences
+	would change: special characters, backslashes and quotes.
+*/
+bool
+has_escapable_characters
+	(
+	const std::string&	characters
+	)
+{
+for (string::const_iterator
+		character = characters.begin ();
+		character != characters.end ();
+		++character)
+	if (*character < 32 ||
+		*character > 126 ||
+		*character == '\\' ||
+		*character == Parser::TEXT_DELIMITER ||
+		*character == Parser::SYMBOL_DELIMITER)
+		return true;
+return false;
+}
+
+
+//	The form of a Parameter name in a listing.
+string
+listed_name
+	(
+	const std::string&	name,
+	bool				verbatim
+	)
+{
+string
+	the_name (name);
+string::size_type
+	index;
+
+if (! verbatim &&
+	has_escapable_characters (the_name))
+	translate_to_escape_sequences (the_name);
+if (the_name.empty ())
+	{
+	if (verbatim)
+		throw Invalid_Syntax
+			(
+			string ("Empty Parameter name to list."),
+			0,
+			Lister::ID
+			);
+	//	Use an empty quoted string.
+	the_name.append (2, Parser::TEXT_DELIMITER);
+	}
+else if ((index = the_name.find_first_of (Parser::RESERVED_CHARACTERS)) != EOS)
+	{
+	//	There's a reserved character in the String.
+	if (verbatim)
+		throw Reserved_Character
+			(
+			string ("In Parameter name \"") + the_name + "\".",
+			index,
+			Parameter::ID
+			);
+	//	Add quotes to protect the reserved characters.
+	the_name.insert ((size_type)0, 1, Parser::TEXT_DELIMITER)
+		.append (1, Parser::TEXT_DELIMITER);
+	}
+return the_name;
+}
 }	//	local namespace
 #endif	//	DOXYGEN_PROCESSING
 
@@ -411,6 +589,173 @@ return level;
 /*------------------------------------------------------------------------------
 	Formatting
 */
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+/*	A section of the character buffer that is being wrapped.
+
+	The section is a range of the character buffer preceded by a prefix
+	- the indenting and leading string of a wrapped line - that is not
+	in the buffer. The characters are accessed by their index in the
+	section, as if it were a single string. Erasing characters from the
+	front of the section only advances the start of the range, and the
+	characters are written directly from the buffer, so a section is
+	wrapped in time proportional to its length.
+*/
+class Section
+{
+public:
+
+Section
+	(
+	string&		buffer,
+	size_type	first,
+	size_type	last
+	)
+	:	Buffer (buffer),
+		First (first),
+		Last (last)
+	{}
+
+size_type length () const
+	{return Prefix.length () + Last - First;}
+
+char& operator[] (size_type index)
+	{return (index < Prefix.length ()) ?
+		Prefix[index] : Buffer[First + index - Prefix.length ()];}
+
+char at (size_type index) const
+	{return (index < Prefix.length ()) ?
+		Prefix[index] : Buffer[First + index - Prefix.length ()];}
+
+//	Equivalents of the std::string searches.
+size_type
+find_first_of
+	(
+	const char*	characters,
+	size_type	index,
+	bool		in_set = true
+	)
+	const
+{
+for (size_type
+		end = length ();
+		index < end;
+		index++)
+	if (is_one_of (at (index), characters) == in_set)
+		return index;
+return EOS;
+}
+
+size_type find_first_not_of (const char* characters, size_type index) const
+	{return find_first_of (characters, index, false);}
+
+size_type
+find_last_of
+	(
+	const char*	characters,
+	size_type	index = EOS,
+	bool		in_set = true
+	)
+	const
+{
+if (! length ())
+	return EOS;
+if (index >= length ())
+	index = length () - 1;
+while (true)
+	{
+	if (is_one_of (at (index), characters) == in_set)
+		return index;
+	if (! index--)
+		return EOS;
+	}
+}
+
+size_type find_last_not_of (const char* characters, size_type index = EOS)
+	const
+	{return find_last_of (characters, index, false);}
+
+//	Erases characters from the front of the section.
+void
+erase_front
+	(
+	size_type	amount
+	)
+{
+if (amount <= Prefix.length ())
+	Prefix.erase (0, amount);
+else
+	{
+	First += amount - Prefix.length ();
+	Prefix.erase ();
+	}
+}
+
+//	Erases the characters beyond the amount at the front of the section.
+void
+truncate
+	(
+	size_type	amount
+	)
+{
+if (amount <= Prefix.length ())
+	{
+	Prefix.erase (amount);
+	Last = First;
+	}
+else
+	Last = First + amount - Prefix.length ();
+}
+
+//	Inserts characters at the front of the section.
+void insert_front (const string& characters)
+	{Prefix.insert (0, characters);}
+
+//	Writes characters from the front of the section.
+void
+write
+	(
+	ostream&	out,
+	size_type	amount
+	)
+	const
+{
+if (amount <= Prefix.length ())
+	out.write (Prefix.data (), amount);
+else
+	{
+	out.write (Prefix.data (), Prefix.length ());
+	out.write (Buffer.data () + First, amount - Prefix.length ());
+	}
+}
+
+//	Replaces the contents of the buffer with the section.
+void
+retain ()
+{
+Buffer.erase (Last);
+Buffer.replace (0, First, Prefix);
+}
+
+private:
+
+static bool is_one_of (char character, const char* characters)
+	{return character && std::strchr (characters, character);}
+
+string
+	&Buffer;
+size_type
+	First,
+	Last;
+string
+	Prefix;
+};
+
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+
 unsigned int
 Lister::write
 	(
@@ -425,14 +770,11 @@ if (Character_Buffer.empty ())
 	}
 unsigned int
 	total_written = 0;
-string
-	section;
 bool
 	terminated_section = true;
 int
 	wrap_at = page_width ();
 size_type
-	leading_length = leading.length (),
 	trailing_length = trailing.length ();
 if (wrap_depth < 0)
 	wrap_depth = 0;
@@ -441,7 +783,9 @@ size_type
 	max_width = page_width () - NL_length,
 	wrap_point,
 	wrap_index,
-	index;
+	index,
+	position = 0,
+	section_end;
 
 if (wrap_at >= 0)
 	{
@@ -451,22 +795,23 @@ if (wrap_at >= 0)
 	}
 wrap_point = (size_type)wrap_at;
 
-while (! Character_Buffer.empty ())
+//	The indenting and leading string of each wrapped section.
+string
+	wrapped_prefix (wrap_depth, ' ');
+wrapped_prefix += leading;
+
+while (position < Character_Buffer.length ())
 	{
-	if ((index = Character_Buffer.find ('\n')) == EOS)
+	if ((section_end = Character_Buffer.find ('\n', position)) == EOS)
 		{
 		//	Wrap the remaining characters.
-		index = Character_Buffer.length ();
-		section = Character_Buffer;
+		section_end = Character_Buffer.length ();
 		terminated_section = false;
 		}
-	else
-		{
-		//	Extract the next section (sans '\n') from the buffer.
-		section = Character_Buffer.substr (0, index++);
-		}
-	//	Erase the section from the buffer.
-	Character_Buffer.erase (0, index);
+	//	The next section (sans '\n') of the buffer.
+	Section
+		section (Character_Buffer, position, section_end);
+	position = section_end + 1;
 
 	while (section.length () > max_width)
 		{
@@ -499,7 +844,7 @@ while (! Character_Buffer.empty ())
 						//	Erase this section.
 						index = wrap_index;
 					}
-				section.erase (0, index);
+				section.erase_front (index);
 				continue;
 				}
 			else
@@ -539,7 +884,7 @@ while (! Character_Buffer.empty ())
 			}
 
 		//	Output the section.
-		*Output << section.substr (0, wrap_index);
+		section.write (*Output, wrap_index);
 		total_written += wrap_index;
 
 		if (trailing_length)
@@ -555,11 +900,11 @@ while (! Character_Buffer.empty ())
 			{
 			//	Nothing left; last section.
 			if (terminated_section)
-				section.erase ();
+				section.truncate (0);
 			break;
 			}
 		//	Erase the section and the remainder of the break gap.
-		section.erase (0, index);
+		section.erase_front (index);
 
 		//	Add the NL to complete the previous section.
 		*Output << NL ();
@@ -568,16 +913,10 @@ while (! Character_Buffer.empty ())
 		/*......................................................................
 			Wrapped section
 		*/
-		if (wrap_depth)
-			{
-			//	Indent the next wrapped section.
-			section.insert ((size_type)0, wrap_depth, ' ');
-			}
-
-		if (leading_length)
+		if (! wrapped_prefix.empty ())
 			{
-			//	Add the leading string.
-			section.insert (wrap_depth, leading);
+			//	Indent the next wrapped section and add the leading string.
+			section.insert_front (wrapped_prefix);
 			}
 		}
 	/*..........................................................................
@@ -591,13 +930,13 @@ while (! Character_Buffer.empty ())
 			index = (size_type)-1;	//	Erase from the beginning of the section.
 		if (++index != section.length ())
 			{
-			section.erase (index);
+			section.truncate (index);
 			}
 
 		if (index)
 			{
 			//	Output the remainder of the section.
-			*Output << section;
+			section.write (*Output, index);
 			total_written += index;
 			}
 
@@ -608,10 +947,12 @@ while (! Character_Buffer.empty ())
 	else
 		{
 		//	Incomplete last section; put it back in the buffer.
-		Character_Buffer = section;
+		section.retain ();
 		break;
 		}
 	}
+if (terminated_section)
+	Character_Buffer.erase ();
 Total_Written += total_written;
 return total_written;
 }
@@ -751,6 +1092,8 @@ Lister::flush
 	int		wrap_depth
 	)
 {
+if (compact ())
+	return compact_flush ();
 unsigned int
 	total_written =  write (wrap_depth),
 	more = Character_Buffer.length ();
@@ -799,6 +1142,13 @@ Lister::write
 	int					wrap_depth
 	)
 {
+if (compact ())
+	{
+	compact_parameter (the_Aggregate);
+	compact_flush ();
+	return *this;
+	}
+
 //	Comment.
 write_comment (the_Aggregate.comment (), wrap_depth);
 
@@ -919,6 +1269,12 @@ Lister::write
 	int					wrap_depth
 	)
 {
+if (compact ())
+	{
+	compact_parameter (the_Assignment);
+	compact_flush ();
+	return *this;
+	}
 
 //	Comment.
 write_comment (the_Assignment.comment (), wrap_depth);
@@ -1009,38 +1365,7 @@ Lister::parameter_name
 	)
 {
 string
-	the_name (name);
-string::size_type
-	index;
-
-if (! verbatim)
-	translate_to_escape_sequences (the_name);
-if (the_name.empty ())
-	{
-	if (verbatim)
-		throw Invalid_Syntax
-			(
-			string ("Empty Parameter name to list."),
-			0,
-			Lister::ID
-			);
-	//	Use an empty quoted string.
-	the_name.append (2, Parser::TEXT_DELIMITER);
-	}
-else if ((index = the_name.find_first_of (Parser::RESERVED_CHARACTERS)) != EOS)
-	{
-	//	There's a reserved character in the String.
-	if (verbatim)
-		throw Reserved_Character
-			(
-			string ("In Parameter name \"") + the_name + "\".",
-			index,
-			Parameter::ID
-			);
-	//	Add quotes to protect the reserved characters.
-	the_name.insert ((size_type)0, 1, Parser::TEXT_DELIMITER)
-		.append (1, Parser::TEXT_DELIMITER);
-	}
+	the_name (listed_name (name, verbatim));
 write (the_name);
 return the_name.length ();
 }
@@ -1072,6 +1397,11 @@ Lister::write
 	int				wrap_depth
 	)
 {
+if (compact ())
+	{
+	compact_value (the_Array);
+	return *this;
+	}
 bool
 	indented = indenting () && wrap_depth >= 0;
 if (wrap_depth < 0 &&
@@ -1145,6 +1475,11 @@ Lister::write
 	int				wrap_depth
 	)
 {
+if (compact ())
+	{
+	compact_value (the_Integer);
+	return *this;
+	}
 Value::Integer_type
 	value = the_Integer;
 int
@@ -1179,6 +1514,11 @@ Lister::write
 	int				wrap_depth
 	)
 {
+if (compact ())
+	{
+	compact_value (the_Real);
+	return *this;
+	}
 write (Value::real_to_string
 	(static_cast<Value::Real_type>(the_Real),
 		the_Real.format_flags (), the_Real.digits ()));
@@ -1196,6 +1536,11 @@ Lister::write
 	int				wrap_depth
 	)
 {
+if (compact ())
+	{
+	compact_value (the_String);
+	return *this;
+	}
 switch (the_String.type ())
 	{
 	case Value::TEXT:
@@ -1242,5 +1587,263 @@ if (units.length ())
 return *this;
 }
 
+/*------------------------------------------------------------------------------
+	Compact listing
+*/
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+//	The amount of compact listing buffered before it is written.
+const size_type
+	COMPACT_BUFFER_SIZE = 65536;
+
+/*	Appends the decimal representation of an integer.
+
+	The representation is the same as that of Value::integer_to_string
+	for base 10.
+*/
+void
+append_decimal
+	(
+	string&				characters,
+	Value::Integer_type	value,
+	bool				is_signed,
+	int					digits
+	)
+{
+char
+	representation[3 * sizeof (Value::Integer_type) + 1],
+	*first = representation + sizeof (representation);
+Value::Unsigned_Integer_type
+	number = value;
+bool
+	negative = is_signed && value < 0;
+if (negative)
+	number = -number;
+do
+	{
+	*--first = '0' + number % 10;
+	number /= 10;
+	}
+	while (number);
+if (negative)
+	*--first = '-';
+int
+	length = representation + sizeof (representation) - first;
+if (length < digits)
+	//	Zero-padding.
+	characters.append (digits - length, '0');
+characters.append (first, length);
+}
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+
+void
+Lister::compact_parameter
+	(
+	const Parameter&	the_Parameter
+	)
+{
+string
+	comment (the_Parameter.comment ());
+if (! comment.empty ())
+	{
+	//	Write the comment on its own lines without wrapping.
+	compact_flush ();
+	int
+		width = Page_Width;
+	Page_Width = -1;
+	write_comment (comment);
+	Page_Width = width;
+	}
+
+if (the_Parameter.is_Aggregate ())
+	{
+	const Aggregate
+		&the_Aggregate = static_cast<const Aggregate&>(the_Parameter);
+	string
+		name (the_Aggregate.name ()),
+		type_name;
+	bool
+		container = name == Parser::CONTAINER_NAME;
+	if (! container)
+		{
+		//	Aggregate Type specification and name.
+		if (begin_aggregates ())
+			type_name = "Begin_";
+		type_name += the_Aggregate.type_name ();
+		if (uppercase_aggregates ())
+			uppercase (type_name);
+		Character_Buffer += type_name;
+		Character_Buffer += Parser::PARAMETER_NAME_DELIMITER;
+		Character_Buffer +=
+			listed_name (name, the_Aggregate.verbatim_strings ());
+		if (use_statement_delimiter ())
+			Character_Buffer += Parser::STATEMENT_END_DELIMITER;
+		Character_Buffer += NL ();
+		}
+
+	//	Aggregate List.
+	for (Aggregate::Parameter_List::const_iterator
+			parameter = the_Aggregate.begin ();
+			parameter != the_Aggregate.end ();
+		  ++parameter)
+		compact_parameter (*parameter);
+
+	//	The END.
+	if (! container)
+		{
+		type_name = "End_";
+		type_name += the_Aggregate.type_name ();
+		if (uppercase_aggregates ())
+			uppercase (type_name);
+		Character_Buffer += type_name;
+		if (name_end_aggregates ())
+			{
+			Character_Buffer += Parser::PARAMETER_NAME_DELIMITER;
+			Character_Buffer +=
+				listed_name (name, the_Aggregate.verbatim_strings ());
+			}
+		}
+	else
+		Character_Buffer += "END";
+	}
+else
+	{
+	Character_Buffer +=
+		listed_name (the_Parameter.name (), the_Parameter.verbatim_strings ());
+	if (! the_Parameter.is_Token ())
+		{
+		Character_Buffer += Parser::PARAMETER_NAME_DELIMITER;
+		compact_value (the_Parameter.value ());
+		}
+	}
+
+//	PVL statement termination.
+if (use_statement_delimiter ())
+	Character_Buffer += Parser::STATEMENT_END_DELIMITER;
+Character_Buffer += NL ();
+compact_flush (COMPACT_BUFFER_SIZE);
+}
+
+
+void
+Lister::compact_value
+	(
+	const Value&	the_Value
+	)
+{
+if (the_Value.is_Integer ())
+	{
+	const Integer
+		&the_Integer = static_cast<const Integer&>(the_Value);
+	Value::Integer_type
+		value = the_Integer;
+	int
+		base = the_Integer.base ();
+	if (base == 10)
+		append_decimal (Character_Buffer,
+			value, the_Integer.is_signed (), the_Integer.digits ());
+	else
+		{
+		if (the_Integer.is_signed () && value < 0)
+			{
+			base = -base;
+			value = -value;
+			}
+		Character_Buffer += Value::integer_to_string (base);
+		Character_Buffer += Parser::NUMBER_BASE_DELIMITER;
+		Character_Buffer += Value::integer_to_string (value,
+			Value::UNSIGNED, base, the_Integer.digits ());
+		Character_Buffer += Parser::NUMBER_BASE_DELIMITER;
+		}
+	}
+else if (the_Value.is_Real ())
+	{
+	const Real
+		&the_Real = static_cast<const Real&>(the_Value);
+	Character_Buffer += Value::real_to_string
+		(static_cast<Value::Real_type>(the_Real),
+			the_Real.format_flags (), the_Real.digits ());
+	}
+else if (the_Value.is_String ())
+	{
+	switch (the_Value.type ())
+		{
+		case Value::TEXT:
+			Character_Buffer += Parser::TEXT_DELIMITER;
+			Character_Buffer += static_cast<Value::String_type>(the_Value);
+			Character_Buffer += Parser::TEXT_DELIMITER;
+			break;
+		case Value::SYMBOL:
+			Character_Buffer += Parser::SYMBOL_DELIMITER;
+			Character_Buffer += static_cast<Value::String_type>(the_Value);
+			Character_Buffer += Parser::SYMBOL_DELIMITER;
+			break;
+		default:
+			Character_Buffer += static_cast<Value::String_type>(the_Value);
+		}
+	}
+else
+	{
+	const Array
+		&the_Array = static_cast<const Array&>(the_Value);
+	switch (the_Array.type ())
+		{
+		case Value::SET:
+			Character_Buffer += Parser::SET_START_DELIMITER; break;
+		case Value::SEQUENCE:
+			Character_Buffer += Parser::SEQUENCE_START_DELIMITER; break;
+		default: break;
+		}
+	for (Array::Value_List::const_iterator
+			value = the_Array.begin ();
+			value != the_Array.end ();
+		  ++value)
+		{
+		if (value != the_Array.begin ())
+			Character_Buffer += Parser::PARAMETER_VALUE_DELIMITER;
+		compact_value (*value);
+		compact_flush (COMPACT_BUFFER_SIZE);
+		}
+	switch (the_Array.type ())
+		{
+		case Value::SET:
+			Character_Buffer += Parser::SET_END_DELIMITER; break;
+		case Value::SEQUENCE:
+			Character_Buffer += Parser::SEQUENCE_END_DELIMITER; break;
+		default: break;
+		}
+	}
+
+string
+	units (the_Value.units ());
+if (! units.empty ())
+	{
+	Character_Buffer += Parser::UNITS_START_DELIMITER;
+	Character_Buffer += units;
+	Character_Buffer += Parser::UNITS_END_DELIMITER;
+	}
+}
+
+
+unsigned int
+Lister::compact_flush
+	(
+	std::string::size_type	amount
+	)
+{
+unsigned int
+	total_written = Character_Buffer.length ();
+if (! total_written ||
+	total_written < amount)
+	return 0;
+Output->write (Character_Buffer.data (), total_written);
+Character_Buffer.erase ();
+Total_Written += total_written;
+return total_written;
+}
+
 }		//	namespace PVL
 }		//	namespace idaeim
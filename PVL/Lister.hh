@@ -28,6 +28,7 @@ CVS ID: Lister.hh,v 1.28 2013/02/24 00:50:49 castalia Exp
 
 #include	<string>
 #include	<iosfwd>
+#include	<atomic>
 
 
 namespace idaeim
@@ -213,9 +214,42 @@ static const Which_Mode
 
 protected:
 
-//!	Default (static) mode states.
-static bool
-	Default_Modes[TOTAL_MODES];
+/**	A complete set of default settings.
+
+	Each setting is atomic so the process wide defaults may be changed
+	by one thread while other threads are using them. A change of
+	several settings - e.g. by {@link default_strict(bool)
+	default_strict} - is not seen by other threads as a single change.
+*/
+struct Default_Settings
+	{
+	std::atomic<bool>
+		Modes[TOTAL_MODES];
+	std::atomic<const char*>
+		New_Line,
+		Strict_NL_Characters,
+		Informal_NL_Characters;
+	std::atomic<int>
+		Page_Width,
+		Indent_Width;
+	std::atomic<bool>
+		Compact;
+	};
+
+//!	The process wide default settings.
+static Default_Settings
+	Process_Defaults;
+
+/**	Gets the default settings that apply to the current thread.
+
+	@return	The settings of the current thread's {@link Defaults}
+		scope, if any, or the #Process_Defaults.
+*/
+static Default_Settings& defaults ();
+
+//!	Process wide default (static) mode states.
+static std::atomic<bool>
+	(&Default_Modes)[TOTAL_MODES];
 
 //!	Local (object) mode states.
 bool
@@ -228,6 +262,46 @@ static const bool
 
 public:
 
+/**	A <i>Defaults</i> scope provides the Lister default settings for
+	the current thread while the scope exists.
+
+	Without a Defaults scope the process wide defaults apply to all
+	threads. While a Defaults scope exists the default settings used by
+	new Listers, and all of the functions that get or set the default
+	settings - e.g. {@link default_strict(bool) default_strict} and
+	{@link default_NL(const char*) default_NL} - apply to the settings
+	of the scope; other threads are not affected. Thus threads that
+	list Parameters with different conventions may do so at the same
+	time without any synchronization.
+
+	Scopes nest: when a Defaults scope is destroyed the defaults that
+	applied when it was constructed apply again.
+*/
+class Defaults
+{
+public:
+/**	Provides default settings for this thread.
+
+	The scope starts with a copy of the defaults that apply when it is
+	constructed.
+*/
+Defaults ();
+
+//!	Restores the previous defaults.
+~Defaults ();
+
+private:
+friend class Lister;
+
+Defaults (const Defaults&);
+Defaults& operator= (const Defaults&);
+
+Default_Settings
+	Settings;
+Defaults
+	*Previous;
+};
+
 /**	Sets the state of a mode.
 
 	@param	selection	The selected #MODE.
@@ -240,12 +314,12 @@ Lister& mode
 	(const MODE selection, const bool enabled,
 		const Which_Mode& which = LOCAL_MODE_SET)
 	{(which == LOCAL_MODE_SET) ?
-		(Modes[selection] = enabled) : (Default_Modes[selection] = enabled);
+		(Modes[selection] = enabled) : (defaults ().Modes[selection] = enabled);
 	return *this;}
 
 //!	Convenience function for static setting of default modes.
 static void default_mode (const MODE selection, const bool enabled)
-	{Default_Modes[selection] = enabled;}
+	{defaults ().Modes[selection] = enabled;}
 
 /**	Gets the state of a mode.
 
@@ -257,11 +331,11 @@ static void default_mode (const MODE selection, const bool enabled)
 bool mode
 	(const MODE selection, const Which_Mode& which = LOCAL_MODE_SET) const
 	{return (which == LOCAL_MODE_SET) ?
-		Modes[selection] : Default_Modes[selection];}
+		Modes[selection] : defaults ().Modes[selection].load ();}
 
 //!	Convenience function for static testing of default modes.
 static bool default_mode (const MODE selection)
-	{return Default_Modes[selection];}
+	{return defaults ().Modes[selection];}
 
 /**	Gets the array of syntax mode states.
 
@@ -271,12 +345,14 @@ static bool default_mode (const MODE selection)
 	@param	which	If #DEFAULT_MODE_SET, use the #Default_Modes;
 		if #LOCAL_MODE_SET use the local #Modes.
 	@return	A pointer to the array of mode states.
-		<b>N.B.</b>: The pointer only remains valid for the life of the
-		Lister object from which it is obtained.
+		<b>N.B.</b>: The pointer to the local #Modes only remains valid
+		for the life of the Lister object from which it is obtained.
+		The default mode states are copied to an array that belongs to
+		the current thread; the pointer to it remains valid until the
+		default mode states are obtained again by the same thread.
 */
 const bool* modes
-	(const Which_Mode& which = LOCAL_MODE_SET) const
-	{return (which == LOCAL_MODE_SET) ? Modes : Default_Modes;}
+	(const Which_Mode& which = LOCAL_MODE_SET) const;
 
 /**	Sets the state of all syntax modes.
 
@@ -309,7 +385,7 @@ Lister& begin_aggregates
 
 //!	Convenience function for static setting of default modes.
 static void default_begin_aggregates (const bool enabled)
-	{Default_Modes[Begin_Aggregates] = enabled;}
+	{defaults ().Modes[Begin_Aggregates] = enabled;}
 
 /**	Test if the BEGIN annotation for Aggregates is enabled.
 
@@ -324,7 +400,7 @@ bool begin_aggregates
 
 //!	Convenience function for static testing of default modes.
 static bool default_begin_aggregates ()
-	{return Default_Modes[Begin_Aggregates];}
+	{return defaults ().Modes[Begin_Aggregates];}
 
 
 /**	Enable or disable uppercase of Aggregate identifiers.
@@ -347,7 +423,7 @@ Lister& uppercase_aggregates
 
 //!	Convenience function for static setting of default modes.
 static void default_uppercase_aggregates (const bool enabled)
-	{Default_Modes[Uppercase_Aggregates] = enabled;}
+	{defaults ().Modes[Uppercase_Aggregates] = enabled;}
 
 /**	Test if the uppercase of Aggregate identifiers is enabled.
 
@@ -362,7 +438,7 @@ bool uppercase_aggregates
 
 //!	Convenience function for static testing of default modes.
 static bool default_uppercase_aggregates ()
-	{return Default_Modes[Uppercase_Aggregates];}
+	{return defaults ().Modes[Uppercase_Aggregates];}
 
 
 /**	Enable or disable the use of the Aggregate name in its end identifier.
@@ -383,7 +459,7 @@ Lister& name_end_aggregates
 
 //!	Convenience function for static setting of default modes.
 static void default_name_end_aggregates (const bool enabled)
-	{Default_Modes[Name_End_Aggregates] = enabled;}
+	{defaults ().Modes[Name_End_Aggregates] = enabled;}
 
 /**	Test if the use of the Aggregate name in its end identifier is enabled.
 
@@ -398,7 +474,7 @@ bool name_end_aggregates
 
 //!	Convenience function for static testing of default modes.
 static bool default_name_end_aggregates ()
-	{return Default_Modes[Name_End_Aggregates];}
+	{return defaults ().Modes[Name_End_Aggregates];}
 
 
 /**	Enable or disable Assignment alignment.
@@ -428,7 +504,7 @@ Lister& assign_align
 
 //!	Convenience function for static setting of default modes.
 static void default_assign_align (const bool enabled)
-	{Default_Modes[Assign_Align] = enabled;}
+	{defaults ().Modes[Assign_Align] = enabled;}
 
 /**	Test if Assignment alignment is enabled.
 
@@ -443,7 +519,7 @@ bool assign_align
 
 //!	Convenience function for static testing of default modes.
 static bool default_assign_align ()
-	{return Default_Modes[Assign_Align];}
+	{return defaults ().Modes[Assign_Align];}
 
 
 /**	Enable or disable indenting of Assignment Array Values.
@@ -467,7 +543,7 @@ Lister& array_indenting
 
 //!	Convenience function for static setting of default modes.
 static void default_array_indenting (const bool enabled)
-	{Default_Modes[Array_Indenting] = enabled;}
+	{defaults ().Modes[Array_Indenting] = enabled;}
 
 /**	Test if indenting of Array Values is enabled.
 
@@ -482,7 +558,7 @@ bool array_indenting
 
 //!	Convenience function for static testing of default modes.
 static bool default_array_indenting ()
-	{return Default_Modes[Array_Indenting];}
+	{return defaults ().Modes[Array_Indenting];}
 
 
 /**	Enable or disable the use of the statement end delimiter.
@@ -502,7 +578,7 @@ Lister& use_statement_delimiter
 
 //!	Convenience function for static setting of default modes.
 static void default_use_statement_delimiter (const bool enabled)
-	{Default_Modes[Use_Statement_Delimiter] = enabled;}
+	{defaults ().Modes[Use_Statement_Delimiter] = enabled;}
 
 /**	Test if the statement end delimiter character will be used.
 
@@ -517,7 +593,7 @@ bool use_statement_delimiter
 
 //!	Convenience function for static testing of default modes.
 static bool default_use_statement_delimiter ()
-	{return Default_Modes[Use_Statement_Delimiter];}
+	{return defaults ().Modes[Use_Statement_Delimiter];}
 
 
 /**	Enable or disable single line comments.
@@ -534,7 +610,7 @@ Lister& single_line_comments
 
 //!	Convenience function for static setting of default modes.
 static void default_single_line_comments (const bool enabled)
-	{Default_Modes[Single_Line_Comments] = enabled;}
+	{defaults ().Modes[Single_Line_Comments] = enabled;}
 
 /**	Test if single line comments will be used.
 
@@ -549,7 +625,7 @@ bool single_line_comments
 
 //!	Convenience function for static testing of default modes.
 static bool default_single_line_comments ()
-	{return Default_Modes[Single_Line_Comments];}
+	{return defaults ().Modes[Single_Line_Comments];}
 
 
 /**	Enable or disable verbatim quoted strings.
@@ -581,7 +657,7 @@ Lister& verbatim_strings
 
 //!	Convenience function for static setting of default modes.
 static void default_verbatim_strings (const bool enabled)
-	{Default_Modes[Verbatim_Strings] = enabled;}
+	{defaults ().Modes[Verbatim_Strings] = enabled;}
 
 /**	Test if quoted strings will be written verbatim.
 
@@ -596,7 +672,7 @@ bool verbatim_strings
 
 //!	Convenience function for static testing of default modes.
 static bool default_verbatim_strings ()
-	{return Default_Modes[Verbatim_Strings];}
+	{return defaults ().Modes[Verbatim_Strings];}
 
 
 /**	Enables or disables strict PVL syntax rules.
@@ -649,25 +725,26 @@ const char
 	*Strict_NL_Characters,
 	*Informal_NL_Characters;
 
-static const char
-	*Default_New_Line;
+//!	Process wide default NL (new-line) characters.
+static std::atomic<const char*>
+	&Default_New_Line;
 
 
 public:
 
-//!	Default informal (non-strict) NL (new-line) characters.
+//!	Process wide default informal (non-strict) NL (new-line) characters.
 #ifndef INFORMAL_NL_STRING
 #define INFORMAL_NL_STRING		"\n"
 #endif
-static const char*
-	Default_Informal_NL_Characters;
+static std::atomic<const char*>
+	&Default_Informal_NL_Characters;
 	
-//!	Default strict mode NL (new-line) characters.
+//!	Process wide default strict mode NL (new-line) characters.
 #ifndef STRICT_NL_STRING
 #define STRICT_NL_STRING		"\r\n"
 #endif
-static const char*
-	Default_Strict_NL_Characters;
+static std::atomic<const char*>
+	&Default_Strict_NL_Characters;
 
 /**	Sets the new-line (end-of-line) character sequence.
 
@@ -697,11 +774,12 @@ static void default_NL (const char* new_line_characters);
 */
 const char* NL
 	(const Which_Mode& which = LOCAL_MODE_SET) const
-	{return (which == LOCAL_MODE_SET) ? New_Line : Default_New_Line;}
+	{return (which == LOCAL_MODE_SET) ?
+		New_Line : defaults ().New_Line.load ();}
 
 //!	Convenience function for static getting of default values.
 static const char* default_NL ()
-	{return Default_New_Line;}
+	{return defaults ().New_Line;}
 
 /**	Sets the informal (strict = false) new-line character sequence.
 
@@ -729,7 +807,7 @@ Lister& informal_NL
 const char* informal_NL
 	(const Which_Mode& which = LOCAL_MODE_SET) const
 	{return (which == LOCAL_MODE_SET) ?
-		Informal_NL_Characters : Default_Informal_NL_Characters;}
+		Informal_NL_Characters : defaults ().Informal_NL_Characters.load ();}
 
 /**	Gets the strict (strict = true) new-line character sequence.
 
@@ -742,7 +820,7 @@ const char* informal_NL
 const char* strict_NL
 	(const Which_Mode& which = LOCAL_MODE_SET) const
 	{return (which == LOCAL_MODE_SET) ?
-		Strict_NL_Characters : Default_Strict_NL_Characters;}
+		Strict_NL_Characters : defaults ().Strict_NL_Characters.load ();}
 
 /**	Sets the strict (strict = true) new-line character sequence.
 
@@ -776,14 +854,18 @@ int
 int
 	Assign_Align_Depth;
 
+//!	Compact listing.
+bool
+	Compact;
+
 public:
 
-//!	Default page width.
+//!	Process wide default page width.
 #ifndef PAGE_WIDTH
 #define PAGE_WIDTH				80
 #endif
-static int
-	Default_Page_Width;
+static std::atomic<int>
+	&Default_Page_Width;
 
 /**	Sets the page width.
 
@@ -803,12 +885,12 @@ Lister& page_width
 	(const int width, const Which_Mode& which = LOCAL_MODE_SET)
 	{(which == LOCAL_MODE_SET) ?
 		(Page_Width = width) :
-		(Default_Page_Width = width);
+		(defaults ().Page_Width = width);
 	return *this;}
 
 //!	Convenience function for static setting of default modes.
 static void default_page_width (const int width)
-	{Default_Page_Width = width;}
+	{defaults ().Page_Width = width;}
 
 /**	Gets the page width.
 
@@ -818,21 +900,22 @@ static void default_page_width (const int width)
 */
 int page_width
 	(const Which_Mode& which = LOCAL_MODE_SET) const
-	{return (which == LOCAL_MODE_SET) ? Page_Width : Default_Page_Width;}
+	{return (which == LOCAL_MODE_SET) ?
+		Page_Width : defaults ().Page_Width.load ();}
 
 //!	Convenience function for static getting of default values.
 static int default_page_width ()
-	{return Default_Page_Width;}
+	{return defaults ().Page_Width;}
 
 /*..............................................................................
 	Indenting:
 */
-//!	Default indent width.
+//!	Process wide default indent width.
 #ifndef INDENT_WIDTH
 #define INDENT_WIDTH			4
 #endif
-static int
-	Default_Indent_Width;
+static std::atomic<int>
+	&Default_Indent_Width;
 
 /**	Sets the indenting width.
 
@@ -848,12 +931,12 @@ Lister& indent_width
 	(const int width, const Which_Mode& which = LOCAL_MODE_SET)
 	{(which == LOCAL_MODE_SET) ?
 		(Indent_Width = width) :
-		(Default_Indent_Width = width);
+		(defaults ().Indent_Width = width);
 	return *this;}
 
 //!	Convenience function for static setting of default modes.
 static void default_indent_width (const int width)
-	{Default_Indent_Width = width;}
+	{defaults ().Indent_Width = width;}
 
 /**	Gets the indenting width.
 
@@ -863,11 +946,12 @@ static void default_indent_width (const int width)
 */
 int indent_width
 	(const Which_Mode& which = LOCAL_MODE_SET) const
-	{return (which == LOCAL_MODE_SET) ? Indent_Width : Default_Indent_Width;}
+	{return (which == LOCAL_MODE_SET) ?
+		Indent_Width : defaults ().Indent_Width.load ();}
 
 //!	Convenience function for static getting of default values.
 static int default_indent_width ()
-	{return Default_Indent_Width;}
+	{return defaults ().Indent_Width;}
 
 /**	Calculates the character depth of an indent level.
 
@@ -885,6 +969,69 @@ unsigned int indent_depth (int level) const;
 bool indenting () const
 	{return Indent_Width > NO_INDENT;} 
 
+/*..............................................................................
+	Compact listing:
+*/
+//!	Process wide default compact listing.
+#ifndef COMPACT_LISTING
+#define COMPACT_LISTING			false
+#endif
+
+/**	Enable or disable compact listing.
+
+	A compact listing is intended for transfer of PVL between programs
+	rather than for reading. Each PVL statement is written on a single
+	line with no whitespace other than what separates the statement
+	from the next one: there is no #page_width wrapping, no
+	#indenting, no #assign_align alignment and no #array_indenting.
+	The remaining syntax modes - the form of the Aggregate
+	identifiers, the #use_statement_delimiter, the #verbatim_strings
+	and the #NL sequence - apply as usual, so the listing is valid PVL
+	that a Parser reads back to the same Parameters.
+
+	Comments are written on their own lines before their Parameter, as
+	they are in a formatted listing but without wrapping.
+
+	The characters of a compact listing are collected in the pending
+	characters buffer and written to the {@link output_stream() output
+	stream} in large blocks. The listing of a Parameter is completely
+	written when the Parameter has been written; the listing of a Value
+	remains pending until the Lister is {@link flush(int) flush}ed.
+
+	@param	enabled	true if compact listing is enabled; false if disabled.
+	@param	which	If #DEFAULT_MODE_SET, use the default setting;
+		if #LOCAL_MODE_SET use the local setting.
+	@return	This Lister.
+	@see	write(const Parameter&, int)
+	@see	write(const Value&, int)
+*/
+Lister& compact
+	(const bool enabled, const Which_Mode& which = LOCAL_MODE_SET)
+	{(which == LOCAL_MODE_SET) ?
+		(Compact = enabled) :
+		(defaults ().Compact = enabled);
+	return *this;}
+
+//!	Convenience function for static setting of default modes.
+static void default_compact (const bool enabled)
+	{defaults ().Compact = enabled;}
+
+/**	Test if compact listing is enabled.
+
+	@param	which	If #DEFAULT_MODE_SET, use the default setting;
+		if #LOCAL_MODE_SET use the local setting.
+	@return	true if compact listing is enabled; false if disabled.
+	@see	compact(bool, const Which_Mode&)
+*/
+bool compact
+	(const Which_Mode& which = LOCAL_MODE_SET) const
+	{return (which == LOCAL_MODE_SET) ?
+		Compact : defaults ().Compact.load ();}
+
+//!	Convenience function for static testing of default modes.
+static bool default_compact ()
+	{return defaults ().Compact;}
+
 /*==============================================================================
 	I/O
 */
@@ -981,6 +1128,11 @@ std::string pending_characters () const
 */
 /**	Writes a Parameter.
 
+	In {@link compact(bool, const Which_Mode&) compact} mode the
+	Parameter is written without formatting and the wrap_depth is
+	ignored; this also applies to the Assignment and Aggregate write
+	methods.
+
 	@param	parameter	The Parameter to be written.
 	@param	wrap_depth	The indent depth for any wrapped lines.
 	@return	This Lister.
@@ -1167,6 +1319,10 @@ int parameter_name (const std::string& name, bool verbatim = false);
 */
 /**	Writes a Value.
 
+	In {@link compact(bool, const Which_Mode&) compact} mode the Value
+	is written without formatting and the wrap_depth is ignored; this
+	also applies to the Integer, Real, String and Array write methods.
+
 	@param	value	The Value to be written.
 	@param	wrap_depth	The indent depth for any wrapped lines.
 	@return	This Lister.
@@ -1361,6 +1517,9 @@ unsigned int write (int wrap_to = 0,
 	{@link write(int, const std::string&, const std::string&) write}
 	operations may result in apparently improper line wrapping.
 
+	In {@link compact(bool, const Which_Mode&) compact} mode the
+	pending characters are written as they are, without wrapping.
+
 	@param	wrap_depth	The indent depth for any wrapped lines.
 	@return	The number of characters written.
 	@see	write(std::string,
@@ -1379,6 +1538,11 @@ void clear ()
 */
 private:
 
+//	Compact listing.
+void compact_parameter (const Parameter& parameter);
+void compact_value (const Value& value);
+unsigned int compact_flush (std::string::size_type amount = 0);
+
 //!	The output stream for writing characters.
 std::ostream
 	*Output;
@@ -0,0 +1,161 @@
+/*	Memory_Usage
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#ifndef idaeim_PVL_Memory_Usage_hh
+#define idaeim_PVL_Memory_Usage_hh
+
+#include	<cstddef>
+#include	<string>
+#include	<functional>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Memory_Usage
+*/
+/**	A <i>Memory_Usage</i> is an account of the memory used by a
+	Parameter or Value hierarchy, by category.
+
+	Each category is a number of bytes. The amounts are those requested
+	from the allocators; the bookkeeping of the heap itself is not
+	known and is not included. The memory of the table of {@link
+	Symbol::intern(const std::string&) interned Symbols} is shared by
+	all Symbols and is not included either.
+
+	@version	1.0
+	@see	Parameter::memory_usage() const
+	@see	Value::memory_usage() const
+*/
+struct Memory_Usage
+{
+/**	The node objects: the Parameter and Value objects themselves.
+*/
+std::size_t
+	Nodes;
+
+/**	The header and alignment padding of each node that was allocated
+	by the Parameter or Value classes from an Arena. Heap nodes have no
+	overhead.
+*/
+std::size_t
+	Node_Overhead;
+
+/**	The part of the Nodes and Node_Overhead that is in {@link Arena
+	Arena} memory.
+
+	This is not a separate category; it is not included in the
+	{@link total() total}.
+*/
+std::size_t
+	Arena_Nodes;
+
+/**	The heap storage of the strings: Parameter names and comments,
+	Value units and String data.
+
+	The entry of a Parameter name or Value units {@link Symbol Symbol}
+	that is not interned is included. Short comments and String data
+	that are stored within their node are part of the Nodes.
+*/
+std::size_t
+	Strings;
+
+/**	The occupied pointer storage of the Aggregate and Array lists.
+*/
+std::size_t
+	Lists;
+
+/**	The unused pointer capacity of the Aggregate and Array lists.
+*/
+std::size_t
+	Slack;
+
+/**	The pathname index and depth offset tables that are built on
+	demand for Aggregates and Arrays.
+*/
+std::size_t
+	Indices;
+
+/**	The warnings held by a Parser.
+*/
+std::size_t
+	Warnings;
+
+//!	Constructs a Memory_Usage with all categories zero.
+Memory_Usage ()
+	:	Nodes (0),
+		Node_Overhead (0),
+		Arena_Nodes (0),
+		Strings (0),
+		Lists (0),
+		Slack (0),
+		Indices (0),
+		Warnings (0)
+	{}
+
+/**	Gets the total memory usage.
+
+	@return	The sum of all the categories except the Arena_Nodes.
+*/
+std::size_t total () const
+	{return Nodes + Node_Overhead + Strings + Lists + Slack + Indices
+		+ Warnings;}
+
+/**	Adds another Memory_Usage to this Memory_Usage.
+
+	@param	usage	The Memory_Usage to be added.
+	@return	This Memory_Usage.
+*/
+Memory_Usage& operator+= (const Memory_Usage& usage)
+	{
+	Nodes += usage.Nodes;
+	Node_Overhead += usage.Node_Overhead;
+	Arena_Nodes += usage.Arena_Nodes;
+	Strings += usage.Strings;
+	Lists += usage.Lists;
+	Slack += usage.Slack;
+	Indices += usage.Indices;
+	Warnings += usage.Warnings;
+	return *this;
+	}
+
+/**	Gets the heap storage used by a string.
+
+	@param	text	The string to examine.
+	@return	The size of the string's heap storage, including the
+		terminating null. This is zero for a short string that is stored
+		within the string object itself.
+*/
+static std::size_t string_size (const std::string& text)
+	{
+	const char
+		*object = reinterpret_cast<const char*>(&text);
+	if (std::less_equal<const char*> ()(object, text.data ()) &&
+		std::less<const char*> ()(text.data (), object + sizeof (text)))
+		return 0;
+	return text.capacity () + 1;
+	}
+};
+
+}		//	namespace PVL
+}		//	namespace idaeim
+#endif	//	idaeim_PVL_Memory_Usage_hh
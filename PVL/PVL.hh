@@ -26,7 +26,14 @@ CVS ID: PVL.hh,v 1.13 2013/02/24 00:50:49 castalia Exp
 #include	"PVL/Parameter.hh"
 #include	"PVL/Value.hh"
 #include	"PVL/Parser.hh"
+#include	"PVL/Query.hh"
 #include	"PVL/Lister.hh"
+#include	"PVL/Shared.hh"
+#include	"PVL/Frozen.hh"
+#include	"PVL/Binary.hh"
+#include	"PVL/Aggregate_View.hh"
+#include	"PVL/Diff.hh"
+#include	"PVL/Parallel.hh"
 #include	"PVL/PVL_Exceptions.hh"
 
 #endif
@@ -0,0 +1,383 @@
+/*	Parallel
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"Parallel.hh"
+
+#include	<algorithm>
+#include	<memory>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Thread_Pool
+*/
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Thread_Pool::ID =
+		"idaeim::PVL::Thread_Pool (1.0 2026/10/18)";
+
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+//	The minimum number of entries in each part of a parallel traversal.
+const std::size_t
+	PARALLEL_PART_MINIMUM = 4096;
+
+//	The number of parts for each thread of a parallel traversal.
+const std::size_t
+	PARALLEL_PARTS_PER_THREAD = 4;
+
+//	Size of the default Thread_Pool; zero for the hardware threads.
+unsigned int
+	Default_Size = 0;
+
+//	The default Thread_Pool.
+std::unique_ptr<Thread_Pool>
+	Default_Pool;
+
+std::mutex
+	Default_Lock;
+
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+//	A job being run.
+struct Thread_Pool::Job
+{
+const std::function<void (std::size_t)>
+	*Task;
+std::size_t
+	Tasks,
+	Next,
+	Done;
+std::exception_ptr
+	Failure;
+};
+
+/*==============================================================================
+	Constructors
+*/
+Thread_Pool::Thread_Pool
+	(
+	unsigned int	threads
+	)
+	:	Stopping (false)
+{
+if (! threads)
+	threads = std::thread::hardware_concurrency ();
+while (threads-- > 1)
+	{
+	try {Workers.emplace_back (&Thread_Pool::work, this);}
+	catch (...)
+		{
+		//	No more threads; the pool makes do with those it has.
+		break;
+		}
+	}
+}
+
+
+Thread_Pool::~Thread_Pool ()
+{
+	{
+	std::lock_guard<std::mutex>
+		lock (Lock);
+	Stopping = true;
+	}
+Jobs_Ready.notify_all ();
+for (std::size_t
+		worker = 0;
+		worker < Workers.size ();
+		worker++)
+	Workers[worker].join ();
+}
+
+/*==============================================================================
+	Accessors
+*/
+Thread_Pool&
+Thread_Pool::default_pool ()
+{
+std::lock_guard<std::mutex>
+	lock (Default_Lock);
+if (! Default_Pool)
+	Default_Pool.reset (new Thread_Pool (Default_Size));
+return *Default_Pool;
+}
+
+
+bool
+Thread_Pool::default_size
+	(
+	unsigned int	threads
+	)
+{
+std::lock_guard<std::mutex>
+	lock (Default_Lock);
+if (Default_Pool)
+	return false;
+Default_Size = threads;
+return true;
+}
+
+/*==============================================================================
+	Jobs
+*/
+void
+Thread_Pool::run
+	(
+	std::size_t									tasks,
+	const std::function<void (std::size_t)>&	task
+	)
+{
+if (! tasks)
+	return;
+if (Workers.empty () ||
+	tasks == 1)
+	{
+	for (std::size_t
+			index = 0;
+			index < tasks;
+			index++)
+		task (index);
+	return;
+	}
+
+Job
+	job;
+job.Task = &task;
+job.Tasks = tasks;
+job.Next = 0;
+job.Done = 0;
+std::unique_lock<std::mutex>
+	lock (Lock);
+Jobs.push_back (&job);
+Jobs_Ready.notify_all ();
+
+//	Take tasks from this job until they have all been taken.
+while (job.Next < job.Tasks)
+	{
+	std::size_t
+		index = job.Next++;
+	if (job.Next == job.Tasks)
+		Jobs.erase (std::find (Jobs.begin (), Jobs.end (), &job));
+	if (! job.Failure)
+		{
+		lock.unlock ();
+		try {task (index);}
+		catch (...)
+			{
+			lock.lock ();
+			if (! job.Failure)
+				job.Failure = std::current_exception ();
+			lock.unlock ();
+			}
+		lock.lock ();
+		}
+	++job.Done;
+	}
+
+//	Wait for the tasks taken by the pool threads.
+Job_Done.wait (lock, [&job] () {return job.Done == job.Tasks;});
+if (job.Failure)
+	std::rethrow_exception (job.Failure);
+}
+
+
+void
+Thread_Pool::work ()
+{
+std::unique_lock<std::mutex>
+	lock (Lock);
+while (true)
+	{
+	Jobs_Ready.wait (lock, [this] () {return Stopping || ! Jobs.empty ();});
+	if (Jobs.empty ())
+		break;
+	Job
+		*job = Jobs.front ();
+	std::size_t
+		index = job->Next++;
+	if (job->Next == job->Tasks)
+		Jobs.pop_front ();
+	//	The tasks of a job that has failed are skipped.
+	if (! job->Failure)
+		{
+		lock.unlock ();
+		try {(*job->Task) (index);}
+		catch (...)
+			{
+			lock.lock ();
+			if (! job->Failure)
+				job->Failure = std::current_exception ();
+			lock.unlock ();
+			}
+		lock.lock ();
+		}
+	if (++job->Done == job->Tasks)
+		Job_Done.notify_all ();
+	}
+}
+
+/*******************************************************************************
+	Subtree ranges
+*/
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+std::size_t
+subtree_span
+	(
+	const Parameter&	parameter
+	)
+{
+return parameter.is_Aggregate () ?
+	static_cast<const Aggregate&>(parameter).total_size () + 1 : 1;
+}
+
+std::size_t
+subtree_span
+	(
+	const Value&	value
+	)
+{
+return value.is_Array () ?
+	static_cast<const Array&>(value).total_size () + 1 : 1;
+}
+
+bool
+is_branch
+	(
+	const Parameter&	parameter
+	)
+{return parameter.is_Aggregate ();}
+
+bool
+is_branch
+	(
+	const Value&	value
+	)
+{return value.is_Array ();}
+
+/*	Divides a list into ranges of about the part size.
+
+	Consecutive subtrees are grouped until they reach the part size.
+	A subtree that is larger than the part size is divided: its own
+	entry is a range by itself and its contents are divided in turn.
+*/
+template <typename Container>
+void
+divide
+	(
+	const Container&					list,
+	std::size_t							part_size,
+	std::vector<Subtree_Range<Container> >&	ranges
+	)
+{
+std::size_t
+	first = 0,
+	amount = 0;
+for (std::size_t
+		index = 0;
+		index < list.size ();
+		index++)
+	{
+	std::size_t
+		span = subtree_span (list[index]);
+	if (span > part_size &&
+		is_branch (list[index]))
+		{
+		if (first < index)
+			ranges.push_back
+				(Subtree_Range<Container> {&list, first, index, true});
+		ranges.push_back
+			(Subtree_Range<Container> {&list, index, index + 1, false});
+		divide (static_cast<const Container&>(list[index]), part_size, ranges);
+		first = index + 1;
+		amount = 0;
+		}
+	else if ((amount += span) >= part_size)
+		{
+		ranges.push_back
+			(Subtree_Range<Container> {&list, first, index + 1, true});
+		first = index + 1;
+		amount = 0;
+		}
+	}
+if (first < list.size ())
+	ranges.push_back
+		(Subtree_Range<Container> {&list, first, list.size (), true});
+}
+
+template <typename Container>
+void
+partition
+	(
+	const Container&					container,
+	const Thread_Pool&					pool,
+	std::vector<Subtree_Range<Container> >&	ranges
+	)
+{
+ranges.clear ();
+if (container.empty ())
+	return;
+std::size_t
+	total = container.total_size (),
+	part_size = total / (pool.size () * PARALLEL_PARTS_PER_THREAD);
+if (part_size < PARALLEL_PART_MINIMUM)
+	part_size = PARALLEL_PART_MINIMUM;
+if (pool.size () < 2 ||
+	total < part_size * 2)
+	ranges.push_back
+		(Subtree_Range<Container> {&container, 0, container.size (), true});
+else
+	divide (container, part_size, ranges);
+}
+
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+
+void
+subtree_ranges
+	(
+	const Aggregate&						aggregate,
+	const Thread_Pool&						pool,
+	std::vector<Subtree_Range<Aggregate> >&	ranges
+	)
+{partition (aggregate, pool, ranges);}
+
+
+void
+subtree_ranges
+	(
+	const Array&						array,
+	const Thread_Pool&					pool,
+	std::vector<Subtree_Range<Array> >&	ranges
+	)
+{partition (array, pool, ranges);}
+
+}		//	namespace PVL
+}		//	namespace idaeim
@@ -0,0 +1,515 @@
+/*	Parallel
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#ifndef idaeim_PVL_Parallel_hh
+#define idaeim_PVL_Parallel_hh
+
+#include	"PVL/Parameter.hh"
+#include	"PVL/Value.hh"
+
+#include	<vector>
+#include	<deque>
+#include	<thread>
+#include	<mutex>
+#include	<condition_variable>
+#include	<functional>
+#include	<exception>
+#include	<type_traits>
+#include	<cstddef>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Thread_Pool
+*/
+/**	A <i>Thread_Pool</i> is a fixed set of threads that run the parts
+	of a parallel job.
+
+	A job is {@link run(std::size_t, const std::function<void (std::size_t)>&)
+	run} by giving it a number of tasks and a function that performs a
+	task given its index. The tasks are taken, in index order, by the
+	pool threads and by the thread that runs the job, which returns only
+	when all of the tasks are done. Because the thread that runs a job
+	also performs its tasks, a task may itself run a job on the same
+	Thread_Pool without any risk of deadlock, and jobs run by different
+	threads at the same time share the pool threads.
+
+	The parallel tree algorithms - {@link parallel_for_each(const
+	Aggregate&, Function, Thread_Pool*) parallel_for_each}, {@link
+	parallel_transform_reduce(const Aggregate&, T, Reduce, Transform,
+	Thread_Pool*) parallel_transform_reduce} and {@link
+	parallel_count_if(const Aggregate&, Predicate, Thread_Pool*)
+	parallel_count_if} - use the {@link default_pool() default
+	Thread_Pool} unless another is provided.
+
+	@version	1.0
+*/
+class Thread_Pool
+{
+public:
+/*==============================================================================
+	Constants:
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs a Thread_Pool.
+
+	@param	threads	The number of threads that perform the tasks of a
+		job, including the thread that runs the job; thus one less pool
+		thread is started. If zero the number of hardware threads is
+		used. If a thread can not be started the pool has fewer
+		threads; its {@link size() const size} is the number that
+		were started plus one.
+*/
+explicit Thread_Pool (unsigned int threads = 0);
+
+/**	Destroys the Thread_Pool.
+
+	The pool threads are stopped after any jobs being run have been
+	completed.
+*/
+~Thread_Pool ();
+
+private:
+//	Thread_Pools are not copied.
+Thread_Pool (const Thread_Pool&);
+Thread_Pool& operator= (const Thread_Pool&);
+
+public:
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the number of threads that perform the tasks of a job.
+
+	@return	The number of pool threads plus one for the thread that
+		runs the job.
+*/
+unsigned int size () const
+	{return Workers.size () + 1;}
+
+/**	Gets the default Thread_Pool.
+
+	The default Thread_Pool is constructed when it is first used with
+	the number of threads that was last set by {@link
+	default_size(unsigned int) default_size}; the number of hardware
+	threads if none was set.
+
+	@return	A reference to the default Thread_Pool.
+*/
+static Thread_Pool& default_pool ();
+
+/**	Sets the size of the default Thread_Pool.
+
+	This only has an effect if the default Thread_Pool has not yet
+	been used.
+
+	@param	threads	The number of threads for the default Thread_Pool.
+		If zero the number of hardware threads is used.
+	@return	true if the size will be applied; false if the default
+		Thread_Pool already exists.
+*/
+static bool default_size (unsigned int threads);
+
+/*==============================================================================
+	Jobs
+*/
+/**	Runs a job.
+
+	The task function is called once for each task index from zero up
+	to, but not including, the number of tasks. The calls are made by
+	several threads at the same time.
+
+	@param	tasks	The number of tasks in the job.
+	@param	task	The function that performs a task. Its argument is
+		the index of the task.
+	@throws	std::exception	The first exception thrown by the task
+		function is rethrown after the tasks being performed are done;
+		the tasks that had not been started are skipped.
+*/
+void run (std::size_t tasks, const std::function<void (std::size_t)>& task);
+
+/*==============================================================================
+	Private
+*/
+private:
+
+struct Job;
+
+void work ();
+
+std::vector<std::thread>
+	Workers;
+std::deque<Job*>
+	Jobs;
+std::mutex
+	Lock;
+std::condition_variable
+	Jobs_Ready,
+	Job_Done;
+bool
+	Stopping;
+
+};		//	End of Thread_Pool class.
+
+/*******************************************************************************
+	Subtree ranges
+*/
+#ifndef DOXYGEN_PROCESSING
+/*	A Subtree_Range is a part of a parallel tree traversal: the entries
+	from First up to, but not including, Last of a Parameter or Value
+	list, either with all the entries they contain (Deep) or alone.
+*/
+template <typename Container>
+struct Subtree_Range
+{
+const Container
+	*List;
+std::size_t
+	First,
+	Last;
+bool
+	Deep;
+};
+
+/*	Divides the contents of an Aggregate or Array into Subtree_Ranges
+	in depth-first order that are each about the size of one part for
+	each of the Thread_Pool threads. A single range is produced if the
+	contents are too small to be worth dividing.
+*/
+void subtree_ranges (const Aggregate& aggregate, const Thread_Pool& pool,
+	std::vector<Subtree_Range<Aggregate> >& ranges);
+void subtree_ranges (const Array& array, const Thread_Pool& pool,
+	std::vector<Subtree_Range<Array> >& ranges);
+
+//	Visits a Parameter and, if it is an Aggregate, all the Parameters it contains.
+template <typename Function>
+void
+visit_subtree
+	(
+	const Parameter&	parameter,
+	Function&			function
+	)
+{
+function (parameter);
+if (parameter.is_Aggregate ())
+	{
+	const Aggregate
+		&aggregate = static_cast<const Aggregate&>(parameter);
+	for (Aggregate::size_type
+			index = 0;
+			index < aggregate.size ();
+			index++)
+		visit_subtree (aggregate[index], function);
+	}
+}
+
+//	Visits a Value and, if it is an Array, all the Values it contains.
+template <typename Function>
+void
+visit_subtree
+	(
+	const Value&	value,
+	Function&		function
+	)
+{
+function (value);
+if (value.is_Array ())
+	{
+	const Array
+		&array = static_cast<const Array&>(value);
+	for (Array::size_type
+			index = 0;
+			index < array.size ();
+			index++)
+		visit_subtree (array[index], function);
+	}
+}
+
+//	Visits each entry of a Subtree_Range.
+template <typename Container, typename Function>
+void
+visit_range
+	(
+	const Subtree_Range<Container>&	range,
+	Function&						function
+	)
+{
+for (std::size_t
+		index = range.First;
+		index < range.Last;
+		index++)
+	{
+	if (range.Deep)
+		visit_subtree ((*range.List)[index], function);
+	else
+		function ((*range.List)[index]);
+	}
+}
+
+template <typename Container, typename Function>
+void
+parallel_visit
+	(
+	const Container&	container,
+	Function&			function,
+	Thread_Pool*		pool
+	)
+{
+if (! pool)
+	pool = &Thread_Pool::default_pool ();
+std::vector<Subtree_Range<Container> >
+	ranges;
+subtree_ranges (container, *pool, ranges);
+pool->run (ranges.size (), [&ranges, &function] (std::size_t part)
+	{visit_range (ranges[part], function);});
+}
+
+template <typename Container, typename T, typename Reduce, typename Transform>
+T
+parallel_reduce
+	(
+	const Container&	container,
+	T					init,
+	Reduce				reduce,
+	Transform			transform,
+	Thread_Pool*		pool
+	)
+{
+if (! pool)
+	pool = &Thread_Pool::default_pool ();
+std::vector<Subtree_Range<Container> >
+	ranges;
+subtree_ranges (container, *pool, ranges);
+//	Each part is reduced from its first transformed entry.
+std::vector<T>
+	partial (ranges.size (), init);
+pool->run (ranges.size (),
+	[&ranges, &partial, &reduce, &transform] (std::size_t part)
+	{
+	bool
+		first = true;
+	auto
+		accumulate = [&] (const typename std::remove_reference
+			<decltype ((*ranges[part].List)[0])>::type& entry)
+		{
+		if (first)
+			{
+			partial[part] = transform (entry);
+			first = false;
+			}
+		else
+			partial[part] = reduce (partial[part], transform (entry));
+		};
+	visit_range (ranges[part], accumulate);
+	});
+//	The parts are combined in depth-first order.
+for (std::size_t
+		part = 0;
+		part < partial.size ();
+		part++)
+	init = reduce (init, partial[part]);
+return init;
+}
+#endif	//	DOXYGEN_PROCESSING
+
+/*=*****************************************************************************
+	Parallel tree algorithms
+*/
+/**	Applies a function to every Parameter in an Aggregate hierarchy
+	using multiple threads.
+
+	Every Parameter that a Depth_Iterator from the Aggregate would
+	visit - all of the Parameters it contains, at every depth, but not
+	the Aggregate itself - is given to the function exactly once. The
+	hierarchy is divided into parts made of whole child subtrees,
+	balanced using the {@link Aggregate::total_size() total size} of
+	each subtree, and the parts are traversed by the threads of the
+	Thread_Pool. The order in which the Parameters are visited is not
+	defined.
+
+	<b>N.B.</b>: The same function object is called by several threads
+	at the same time. It must not modify the Aggregate hierarchy, and
+	any state it changes must be safe for concurrent use.
+
+	@param	aggregate	The Aggregate whose Parameters are to be visited.
+	@param	function	A function taking a const Parameter&.
+	@param	pool	The Thread_Pool to use. If NULL the {@link
+		Thread_Pool::default_pool() default Thread_Pool} is used.
+	@throws	std::exception	The first exception thrown by the function
+		is rethrown after the traversal has stopped.
+*/
+template <typename Function>
+void
+parallel_for_each
+	(
+	const Aggregate&	aggregate,
+	Function			function,
+	Thread_Pool*		pool = NULL
+	)
+{parallel_visit (aggregate, function, pool);}
+
+/**	Applies a function to every Value in an Array hierarchy using
+	multiple threads.
+
+	@param	array	The Array whose Values are to be visited.
+	@param	function	A function taking a const Value&.
+	@param	pool	The Thread_Pool to use. If NULL the default
+		Thread_Pool is used.
+	@throws	std::exception	The first exception thrown by the function
+		is rethrown after the traversal has stopped.
+	@see	parallel_for_each(const Aggregate&, Function, Thread_Pool*)
+*/
+template <typename Function>
+void
+parallel_for_each
+	(
+	const Array&	array,
+	Function		function,
+	Thread_Pool*	pool = NULL
+	)
+{parallel_visit (array, function, pool);}
+
+/**	Transforms every Parameter in an Aggregate hierarchy and reduces
+	the results using multiple threads.
+
+	The Parameters are visited as for {@link parallel_for_each(const
+	Aggregate&, Function, Thread_Pool*) parallel_for_each}. Each part of
+	the hierarchy is reduced by a single thread in depth-first order,
+	and the results of the parts are then reduced, in depth-first order,
+	with the initial value. Thus the reduce function must be
+	associative, but it need not be commutative, and the initial value
+	is used only once.
+
+	@param	aggregate	The Aggregate whose Parameters are to be reduced.
+	@param	init	The initial value of the result.
+	@param	reduce	A function that combines two T values into one.
+	@param	transform	A function that produces a T value from a const
+		Parameter&.
+	@param	pool	The Thread_Pool to use. If NULL the default
+		Thread_Pool is used.
+	@return	The reduction of the initial value and the transformed
+		Parameters. This is the initial value if the Aggregate is empty.
+	@throws	std::exception	The first exception thrown by a function
+		is rethrown after the traversal has stopped.
+*/
+template <typename T, typename Reduce, typename Transform>
+T
+parallel_transform_reduce
+	(
+	const Aggregate&	aggregate,
+	T					init,
+	Reduce				reduce,
+	Transform			transform,
+	Thread_Pool*		pool = NULL
+	)
+{return parallel_reduce (aggregate, init, reduce, transform, pool);}
+
+/**	Transforms every Value in an Array hierarchy and reduces the
+	results using multiple threads.
+
+	@param	array	The Array whose Values are to be reduced.
+	@param	init	The initial value of the result.
+	@param	reduce	A function that combines two T values into one.
+	@param	transform	A function that produces a T value from a const
+		Value&.
+	@param	pool	The Thread_Pool to use. If NULL the default
+		Thread_Pool is used.
+	@return	The reduction of the initial value and the transformed
+		Values.
+	@see	parallel_transform_reduce(const Aggregate&, T, Reduce,
+		Transform, Thread_Pool*)
+*/
+template <typename T, typename Reduce, typename Transform>
+T
+parallel_transform_reduce
+	(
+	const Array&	array,
+	T				init,
+	Reduce			reduce,
+	Transform		transform,
+	Thread_Pool*	pool = NULL
+	)
+{return parallel_reduce (array, init, reduce, transform, pool);}
+
+/**	Counts the Parameters in an Aggregate hierarchy that satisfy a
+	predicate using multiple threads.
+
+	@param	aggregate	The Aggregate whose Parameters are to be counted.
+	@param	predicate	A function taking a const Parameter& that
+		returns true for the Parameters to be counted.
+	@param	pool	The Thread_Pool to use. If NULL the default
+		Thread_Pool is used.
+	@return	The number of Parameters for which the predicate is true.
+	@see	parallel_transform_reduce(const Aggregate&, T, Reduce,
+		Transform, Thread_Pool*)
+*/
+template <typename Predicate>
+std::size_t
+parallel_count_if
+	(
+	const Aggregate&	aggregate,
+	Predicate			predicate,
+	Thread_Pool*		pool = NULL
+	)
+{
+return parallel_reduce (aggregate, std::size_t (0),
+	std::plus<std::size_t> (),
+	[&predicate] (const Parameter& parameter) -> std::size_t
+		{return predicate (parameter) ? 1 : 0;},
+	pool);
+}
+
+/**	Counts the Values in an Array hierarchy that satisfy a predicate
+	using multiple threads.
+
+	@param	array	The Array whose Values are to be counted.
+	@param	predicate	A function taking a const Value& that returns
+		true for the Values to be counted.
+	@param	pool	The Thread_Pool to use. If NULL the default
+		Thread_Pool is used.
+	@return	The number of Values for which the predicate is true.
+*/
+template <typename Predicate>
+std::size_t
+parallel_count_if
+	(
+	const Array&	array,
+	Predicate		predicate,
+	Thread_Pool*	pool = NULL
+	)
+{
+return parallel_reduce (array, std::size_t (0),
+	std::plus<std::size_t> (),
+	[&predicate] (const Value& value) -> std::size_t
+		{return predicate (value) ? 1 : 0;},
+	pool);
+}
+
+}		//	namespace PVL
+}		//	namespace idaeim
+#endif	//	idaeim_PVL_Parallel_hh
@@ -38,6 +38,10 @@ using std::ostream;
 using std::ostringstream;
 #include	<iomanip>
 using std::endl;
+#include	<unordered_map>
+#include	<map>
+#include	<vector>
+#include	<mutex>
 
 
 
@@ -78,7 +82,8 @@ Parameter::Parameter
 	)
 	:	Parent (NULL),
 		Name (name),
-		Comment ("")
+		Comment (""),
+		Structural_Hash (0)
 {
 //	Reset the local syntax modes.
 mode_state (NULL);
@@ -95,7 +100,22 @@ Parameter::Parameter
 	)
 	:	Parent (NULL),	// Never inherit the parent.
 		Name (parameter.Name),
-		Comment (parameter.Comment)
+		Comment (parameter.Comment),
+		Structural_Hash (0)
+{
+//	Copy the local syntax modes.
+mode_state (parameter.mode_state ());
+}
+
+Parameter::Parameter
+	(
+	Parameter&&			parameter
+	)
+	noexcept
+	:	Parent (NULL),	// Never inherit the parent.
+		Name (std::move (parameter.Name)),
+		Comment (std::move (parameter.Comment)),
+		Structural_Hash (0)
 {
 //	Copy the local syntax modes.
 mode_state (parameter.mode_state ());
@@ -134,6 +154,32 @@ throw Invalid_Argument
 /*------------------------------------------------------------------------------
 	Name and Parent
 */
+Parameter&
+Parameter::name
+	(
+	const std::string&	name
+	)
+{
+Name = name;
+invalidate_hash ();
+if (Parent)
+	Parent->invalidate_index ();
+return *this;
+}
+
+Parameter&
+Parameter::name
+	(
+	const Symbol&		name
+	)
+{
+Name = name;
+invalidate_hash ();
+if (Parent)
+	Parent->invalidate_index ();
+return *this;
+}
+
 string
 Parameter::pathname
 	(
@@ -145,7 +191,7 @@ if (Parent == root ||
 	//	Special case: CONTAINER_NAME qualifies as default root.
 	(! root && Parent->name () == Parser::CONTAINER_NAME))
 	{
-	return string (1, Path_Delimiter) + Name;
+	return string (1, path_delimiter ()) + Name.str ();
 	}
 else if (! Parent)
 	//	The root_parent is not a parent of the Parameter.
@@ -158,7 +204,7 @@ else if (! Parent)
 		);
 else
 	{
-	return Parent->pathname (root) + Path_Delimiter + Name;
+	return Parent->pathname (root) + path_delimiter () + Name.str ();
 	}
 }
 
@@ -171,7 +217,7 @@ Parameter::pathname_to
 {
 string
 	path = pathname (root);
-return path.substr (0, path.rfind (Path_Delimiter) + 1);
+return path.substr (0, path.rfind (path_delimiter ()) + 1);
 }
 
 #ifndef DOXYGEN_PROCESSING
@@ -190,49 +236,114 @@ for (char* character = const_cast<char*>(a_string.c_str ());
 	*character = (char)toupper (*character);
 return a_string;
 }
+
+inline bool
+same_character
+	(
+	char	character_1,
+	char	character_2,
+	bool	case_sensitive
+	)
+{
+return
+	character_1 == character_2 ||
+	(! case_sensitive && toupper (character_1) == toupper (character_2));
+}
 }	//	Local namespace
 #endif	//	DOXYGEN_PROCESSING
 
 bool
 Parameter::at_pathname
 	(
-	std::string			pathname,
+	const std::string&	pathname,
 	bool				case_sensitive,
 	const Parameter		*root
 	)
 	const
 {
-string
-	this_pathname;
-if (! case_sensitive)
-	to_uppercase (pathname);
-if (pathname.empty () || pathname[0] != Path_Delimiter)
-	{
-	//	Relative path.
-	this_pathname = this->pathname ();
-	if (! case_sensitive)
-		to_uppercase (this_pathname);
-	return
-		this_pathname.length () > pathname.length () &&
-		this_pathname[this_pathname.length () - pathname.length () - 1]
-			== Path_Delimiter &&
-		this_pathname.substr (this_pathname.length () - pathname.length ())\
-			== pathname;
-	}
-//	Absolute path.
-try {this_pathname = this->pathname (root);}
-catch (Invalid_Argument exception)
+char
+	delimiter = path_delimiter ();
+bool
+	absolute = ! pathname.empty () && pathname[0] == delimiter;
+if (! absolute)
+	//	A relative pathname may end anywhere in the full pathname.
+	root = NULL;
+
+/*	The pathname is matched from its end against the pathname of this
+	Parameter, which is produced in reverse, a name at a time, by
+	ascending the Parent chain.
+*/
+string::size_type
+	remaining = pathname.length ();
+const Parameter
+	*parameter = this;
+while (true)
 	{
-	return false;
+	const string
+		&name = parameter->Name.str ();
+	string::size_type
+		index = name.length ();
+	while (index)
+		{
+		if (! remaining)
+			//	A relative pathname may end after a delimiter in a name.
+			return ! absolute &&
+				same_character (delimiter, name[index - 1], case_sensitive);
+		if (! same_character
+				(name[--index], pathname[--remaining], case_sensitive))
+			return false;
+		}
+	if (! remaining)
+		/*
+			A relative pathname has been matched and the name is
+			preceeded by a delimiter. An absolute pathname is shorter
+			than the Parameter pathname.
+		*/
+		return ! absolute;
+	if (! same_character
+			(delimiter, pathname[--remaining], case_sensitive))
+		return false;
+
+	if (parameter->Parent == root ||
+		//	Special case: CONTAINER_NAME qualifies as default root.
+		(! root && parameter->Parent->Name.str () == Parser::CONTAINER_NAME))
+		break;
+	if (! parameter->Parent)
+		//	The root is not a parent of the Parameter.
+		return false;
+	parameter = parameter->Parent;
 	}
-if (! case_sensitive)
-	to_uppercase (this_pathname);
-return this_pathname == pathname;
+/*
+	The entire Parameter pathname has been matched. An absolute
+	pathname must have been entirely matched; a relative pathname must
+	be shorter than the Parameter pathname.
+*/
+return absolute && ! remaining;
 }
 
 
+std::atomic<char>
+	Parameter::Path_Delimiter (DEFAULT_PATHNAME_DELIMITER);
+
+std::atomic<bool>
+	Parameter::Case_Sensitive (DEFAULT_CASE_SENSITIVITY);
+
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+thread_local Parameter::Conventions
+	*Current_Conventions = NULL;
+}
+#endif
+
 char
-	Parameter::Path_Delimiter = DEFAULT_PATHNAME_DELIMITER;
+Parameter::path_delimiter ()
+{
+return Current_Conventions ?
+	Current_Conventions->Delimiter :
+	Path_Delimiter.load (std::memory_order_relaxed);
+}
+
 
 char
 Parameter::path_delimiter
@@ -240,15 +351,23 @@ Parameter::path_delimiter
 	const char	delimiter
 	)
 {
+if (! Current_Conventions)
+	return Path_Delimiter.exchange (delimiter);
 char
-	previous_delimiter = Path_Delimiter;
-Path_Delimiter = delimiter;
+	previous_delimiter = Current_Conventions->Delimiter;
+Current_Conventions->Delimiter = delimiter;
 return previous_delimiter;
 }
 
 
 bool
-	Parameter::Case_Sensitive = DEFAULT_CASE_SENSITIVITY;
+Parameter::case_sensitive ()
+{
+return Current_Conventions ?
+	Current_Conventions->Case_Sensitive :
+	Case_Sensitive.load (std::memory_order_relaxed);
+}
+
 
 bool
 Parameter::case_sensitive
@@ -256,12 +375,38 @@ Parameter::case_sensitive
 	bool	enable
 	)
 {
+if (! Current_Conventions)
+	return Case_Sensitive.exchange (enable);
 bool
-	previous_state = Case_Sensitive;
-Case_Sensitive = enable;
+	previous_state = Current_Conventions->Case_Sensitive;
+Current_Conventions->Case_Sensitive = enable;
 return previous_state;
 }
 
+/*------------------------------------------------------------------------------
+	Conventions
+*/
+Parameter::Conventions::Conventions ()
+	:	Delimiter (path_delimiter ()),
+		Case_Sensitive (case_sensitive ()),
+		Previous (Current_Conventions)
+{Current_Conventions = this;}
+
+
+Parameter::Conventions::Conventions
+	(
+	char	delimiter,
+	bool	case_sensitive
+	)
+	:	Delimiter (delimiter),
+		Case_Sensitive (case_sensitive),
+		Previous (Current_Conventions)
+{Current_Conventions = this;}
+
+
+Parameter::Conventions::~Conventions ()
+{Current_Conventions = Previous;}
+
 
 string
 basename
@@ -498,6 +643,172 @@ switch (which)
 return *this;
 }
 
+/*==============================================================================
+	Structural hash
+*/
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+//	FNV-1a 64-bit offset basis and prime.
+const std::uint64_t
+	HASH_BASIS	= 0xCBF29CE484222325ULL,
+	HASH_PRIME	= 0x100000001B3ULL;
+
+//	The SplitMix64 finalizer.
+std::uint64_t
+mix
+	(
+	std::uint64_t	hash
+	)
+{
+hash ^= hash >> 30;
+hash *= 0xBF58476D1CE4E5B9ULL;
+hash ^= hash >> 27;
+hash *= 0x94D049BB133111EBULL;
+hash ^= hash >> 31;
+return hash;
+}
+
+//	Order sensitive combination of a hash with another hash.
+void
+combine
+	(
+	std::uint64_t&	hash,
+	std::uint64_t	value
+	)
+{hash = mix (hash ^ (value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2)));}
+
+std::uint64_t
+string_hash
+	(
+	const std::string&	characters
+	)
+{
+std::uint64_t
+	hash = HASH_BASIS;
+for (std::string::const_iterator
+		character = characters.begin ();
+	 character != characters.end ();
+	 ++character)
+	{
+	hash ^= static_cast<unsigned char>(*character);
+	hash *= HASH_PRIME;
+	}
+return hash;
+}
+
+std::uint64_t
+value_hash
+	(
+	const Value&	value
+	)
+{
+std::uint64_t
+	hash = HASH_BASIS;
+combine (hash, static_cast<std::uint64_t>(value.type ()));
+combine (hash, string_hash (value.units ()));
+if (value.is_Integer ())
+	{
+	combine (hash, static_cast<std::uint64_t>
+		(static_cast<Value::Integer_type>(value)));
+	combine (hash, value.is_signed () ? 1 : 0);
+	}
+else if (value.is_Real ())
+	{
+	//	The hash of a long double must not include its padding bytes.
+	double
+		datum = static_cast<double>(static_cast<Value::Real_type>(value));
+	if (datum == 0.0)
+		//	Negative zero equals zero.
+		datum = 0.0;
+	std::uint64_t
+		bits = 0;
+	std::memcpy (&bits, &datum, std::min (sizeof (bits), sizeof (datum)));
+	combine (hash, bits);
+	}
+else if (value.is_String ())
+	combine (hash, string_hash (static_cast<Value::String_type>(value)));
+else if (value.is_Array ())
+	{
+	const Array&
+		array = static_cast<const Array&>(value);
+	combine (hash, array.size ());
+	for (Array::const_iterator
+			element = array.begin ();
+		 element != array.end ();
+		 ++element)
+		combine (hash, value_hash (*element));
+	}
+return hash;
+}
+
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+
+std::uint64_t
+Parameter::structural_hash () const
+{
+std::uint64_t
+	hash = Structural_Hash.load (std::memory_order_acquire);
+if (hash)
+	return hash;
+
+hash = HASH_BASIS;
+combine (hash, static_cast<std::uint64_t>(type ()));
+combine (hash, string_hash (Name.str ()));
+if (is_Aggregate ())
+	{
+	const Aggregate&
+		aggregate = static_cast<const Aggregate&>(*this);
+	combine (hash, aggregate.size ());
+	for (Aggregate::const_iterator
+			parameter = aggregate.begin ();
+		 parameter != aggregate.end ();
+		 ++parameter)
+		combine (hash, parameter->structural_hash ());
+	}
+else if (! is_Token ())
+	//	Consistent with compare, the Value of a TOKEN is not included.
+	combine (hash, value_hash (value ()));
+
+if (! hash)
+	//	Zero marks no saved hash.
+	hash = 1;
+Structural_Hash.store (hash, std::memory_order_release);
+return hash;
+}
+
+
+void
+Parameter::invalidate_hash ()
+{
+/*	A saved hash is only computed after the hashes of all the
+	Parameters it contains have been saved. So once a Parameter
+	without a saved hash is reached, none of its parents has one.
+*/
+Parameter
+	*parameter = this;
+while (parameter &&
+		parameter->Structural_Hash.exchange (0, std::memory_order_acq_rel))
+	parameter = parameter->Parent;
+}
+
+
+bool
+Parameter::equivalent
+	(
+	const Parameter&	parameter
+	)
+	const
+{
+if (this == &parameter)
+	return true;
+if (structural_hash () != parameter.structural_hash ())
+	return false;
+return compare (parameter) == 0;
+}
+
 /*******************************************************************************
 	Assignment
 */
@@ -510,7 +821,7 @@ Assignment::Assignment
 	:	Parameter (name),
 		The_Value (new Parameter::Default_Value ()),
 		Subtype (ASSIGNMENT)
-{}
+{The_Value->Owner = this;}
 
 //		from Parser
 Assignment::Assignment
@@ -518,17 +829,20 @@ Assignment::Assignment
 	Parser&				parser,
 	const std::string	name
 	)
+	:	The_Value (NULL)
 {
 Parameter
 	*parameter = parser.get_parameter (true /* Assignment Only */);
 if (parameter)
 	{
-	*this = *parameter;
+	//	Take over the parsed Value.
+	*this = std::move (*parameter);
 	delete parameter;
 	}
 else
 	{
 	The_Value = new Parameter::Default_Value ();
+	The_Value->Owner = this;
 	Subtype = TOKEN;
 	}
 if (! name.empty ())
@@ -541,9 +855,24 @@ Assignment::Assignment
 	const Assignment&	assignment
 	)
 	:	Parameter (assignment),
-		The_Value (assignment.The_Value->clone ()),
+		The_Value (assignment.value ().clone ()),
+		Subtype (assignment.Subtype)
+{The_Value->Owner = this;}
+
+//		Move
+Assignment::Assignment
+	(
+	Assignment&&		assignment
+	)
+	noexcept
+	:	Parameter (std::move (assignment)),
+		The_Value (assignment.The_Value),
 		Subtype (assignment.Subtype)
-{}
+{
+if (The_Value)
+	The_Value->Owner = this;
+assignment.The_Value = NULL;
+}
 
 //		Copy virtual
 Assignment::Assignment
@@ -554,7 +883,8 @@ Assignment::Assignment
 {
 if (parameter.is_Assignment ())
 	{
-	The_Value = static_cast<const Assignment&>(parameter).The_Value->clone ();
+	The_Value = parameter.value ().clone ();
+	The_Value->Owner = this;
 	Subtype = parameter.type ();
 	}
 else
@@ -586,7 +916,7 @@ if (type_code == static_cast<int>(Parameter::ASSIGNMENT) ||
 else
 	{
 	//	Try passing it on to the Value.
-	try {The_Value->type (static_cast<const Value::Type>(type_code));}
+	try {value ().type (static_cast<const Value::Type>(type_code));}
 	catch (Invalid_Argument& exception)
 		{
 		exception.add_message
@@ -595,6 +925,7 @@ else
 		throw;
 		}
 	}
+invalidate_hash ();
 return *this;
 }
 
@@ -615,13 +946,60 @@ if (this != &parameter)
 	if (parameter.is_Assignment ())
 		{
 		//	DO NOT assign the Parent!
-		Name = parameter.name ();
+		Name = parameter.name_symbol ();
 		Comment = parameter.comment ();
 		//	Copy the local syntax modes.
 		mode_state (parameter.mode_state ());
+		Value
+			*value = parameter.value ().clone ();
 		delete The_Value;
-		The_Value = static_cast<const Assignment&>(parameter).The_Value->clone ();
+		The_Value = value;
+		The_Value->Owner = this;
+		Subtype = parameter.type ();
+		invalidate_hash ();
+		if (Parent)
+			Parent->invalidate_index ();
+		}
+	else
+		throw Invalid_Argument
+			(
+			type_name () + " Parameter " + name ()
+			+ "\n  can't be assigned the " + parameter.type_name ()
+			+ " Parameter " + parameter.name () + '.',
+			ID
+			);
+	}
+return *this;
+}
+
+Assignment&
+Assignment::operator=
+	(
+	Parameter&&			parameter
+	)
+{
+if (this != &parameter)
+	{
+	if (parameter.is_Assignment ())
+		{
+		//	DO NOT assign the Parent!
+		Name = std::move (parameter.Name);
+		Comment = std::move (parameter.Comment);
+		//	Copy the local syntax modes.
+		mode_state (parameter.mode_state ());
+		//	Exchange the Values; the source will delete this one.
+		Assignment
+			&source = static_cast<Assignment&>(parameter);
+		std::swap (The_Value, source.The_Value);
+		if (The_Value)
+			The_Value->Owner = this;
+		if (source.The_Value)
+			source.The_Value->Owner = &source;
+		parameter.invalidate_hash ();
 		Subtype = parameter.type ();
+		invalidate_hash ();
+		if (Parent)
+			Parent->invalidate_index ();
 		}
 	else
 		throw Invalid_Argument
@@ -645,11 +1023,62 @@ if (The_Value != &value)
 	{
 	delete The_Value;
 	The_Value = value.clone ();
+	The_Value->Owner = this;
+	Subtype = ASSIGNMENT;
+	invalidate_hash ();
+	}
+return *this;
+}
+
+/*------------------------------------------------------------------------------
+	Value
+*/
+Value&
+Assignment::default_value () const
+{
+The_Value = new Parameter::Default_Value ();
+The_Value->Owner = const_cast<Assignment*>(this);
+return *The_Value;
+}
+
+
+Assignment&
+Assignment::value
+	(
+	Value*		value
+	)
+{
+if (value &&
+	value != The_Value)
+	{
+	delete The_Value;
+	The_Value = value;
+	The_Value->Owner = this;
 	Subtype = ASSIGNMENT;
+	invalidate_hash ();
 	}
 return *this;
 }
 
+/*------------------------------------------------------------------------------
+	Memory usage
+*/
+void
+Assignment::add_memory_usage
+	(
+	Memory_Usage&	usage
+	)
+	const
+{
+Parameter::add_memory_usage (usage);
+usage.Nodes += sizeof (Assignment);
+if (The_Value)
+	{
+	The_Value->add_memory_usage (usage);
+	Arena::node_usage (The_Value, usage);
+	}
+}
+
 /*------------------------------------------------------------------------------
 	Compare
 */
@@ -663,7 +1092,7 @@ Assignment::compare
 if (this == &parameter)
 	return 0;
 int
-	comparison = Name.compare (parameter.name ());
+	comparison = Name.compare (parameter.name_symbol ());
 if (comparison == 0)
 	{
 	if (parameter.is_Aggregate ())
@@ -679,8 +1108,7 @@ if (comparison == 0)
 		}
 
 	//	Compare Values.
-	return The_Value->compare
-		(*static_cast<const Assignment&>(parameter).The_Value);
+	return value ().compare (parameter.value ());
 	}
 return comparison;
 }
@@ -738,6 +1166,31 @@ if (parameter)
 /*******************************************************************************
 	Aggregate
 */
+/*	Depth-first offsets.
+
+	The offset of each Parameter in the list is the number of
+	Parameters that precede it in a depth-first traversal of the
+	Aggregate; an extra offset for the end of the list is the total
+	size of the Aggregate. The offsets are only kept for lists that
+	are long enough for a binary search to pay; they are rebuilt when
+	next needed after the hierarchy has changed.
+*/
+struct Aggregate::Depth_Offsets
+{
+std::vector<size_type>
+	Offsets;
+std::atomic<bool>
+	Valid;
+std::mutex
+	Lock;
+
+Depth_Offsets ()
+	:	Valid (false)
+	{}
+
+void build (const Aggregate& aggregate);
+};
+
 //	Constructors
 
 Aggregate::Aggregate
@@ -745,7 +1198,10 @@ Aggregate::Aggregate
 	const std::string	name,
 	const Type			type_code
 	)
-	:	Parameter (name)
+	:	Parameter (name),
+		Index (NULL),
+		Total_Size (0),
+		Offsets (NULL)
 {
 type (type_code);
 }
@@ -757,8 +1213,12 @@ Aggregate::Aggregate
 	)
 	:	Parameter (aggregate),
 		Vectal<Parameter> (),
-		Subtype (aggregate.Subtype)
+		Subtype (aggregate.Subtype),
+		Index (NULL),
+		Total_Size (0),
+		Offsets (NULL)
 {
+indexed (aggregate.indexed ());
 /*	Copy in the new Parameter List.
 
 	This is done, rather than using the Parameter_List copy method,
@@ -776,11 +1236,31 @@ while (element != stop)
 	}
 }
 
+//		Move
+Aggregate::Aggregate
+	(
+	Aggregate&&			aggregate
+	)
+	:	Parameter (std::move (aggregate)),
+		Vectal<Parameter> (),
+		Subtype (aggregate.Subtype),
+		Index (NULL),
+		Total_Size (0),
+		Offsets (NULL)
+{
+indexed (aggregate.indexed ());
+//	Take over the Parameters; the Parent of each is reset.
+move_in (aggregate);
+}
+
 //		Copy virtual
 Aggregate::Aggregate
 	(
 	const Parameter&	parameter
 	)
+	:	Index (NULL),
+		Total_Size (0),
+		Offsets (NULL)
 {
 if (parameter.is_Aggregate ())
 	*this = parameter;
@@ -799,13 +1279,18 @@ Aggregate::Aggregate
 	const std::string	name
 	)
 	:	Parameter (name),
-		Subtype (Default_Subtype)
+		Subtype (Default_Subtype),
+		Index (NULL),
+		Total_Size (0),
+		Offsets (NULL)
 {parser.add_parameters (*this);}
 
 //	Destructor
 Aggregate::~Aggregate ()
 {
 clear ();
+indexed (false);
+delete Offsets.load ();
 }
 
 /*------------------------------------------------------------------------------
@@ -860,6 +1345,7 @@ else
 			<< ") is inappropriate for an Aggregate Parameter.";
 	throw Invalid_Argument (message.str (), Parameter::ID);
 	}
+invalidate_hash ();
 return *this;
 }
 
@@ -923,6 +1409,7 @@ if (this != &parameter)
 			 first != last;
 			 ++first)
 			delete *first;
+		invalidate_index ();
 		}
 	else
 		//	Append a copy of the Assignment to the Parameter_List.
@@ -931,6 +1418,49 @@ if (this != &parameter)
 return *this;
 }
 
+Aggregate&
+Aggregate::operator=
+	(
+	Parameter&&			parameter
+	)
+{
+if (this != &parameter)
+	{
+	if (parameter.is_Aggregate ())
+		{
+		//	DO NOT assign the Parent!
+		Comment = std::move (parameter.Comment);
+		Name = std::move (parameter.Name);
+		//	Copy the local syntax modes.
+		mode_state (parameter.mode_state ());
+		Subtype = parameter.type ();
+		/*
+			The old Parameter List is set-aside without deleting it in
+			case the parameter being moved is enclosed within this
+			Aggregate.
+		*/
+		std::vector<Parameter*>
+			list (vector_base ());
+		wipe ();
+		//	Take over the source Parameters (no clones).
+		move_in (static_cast<Aggregate&>(parameter));
+		//	Delete the old Parameters.
+		for (std::vector<Parameter*>::iterator
+				first = list.begin (),
+				last  = list.end ();
+			 first != last;
+			 ++first)
+			delete *first;
+		invalidate_index ();
+		}
+	else
+		//	Append the moved Assignment to the Parameter_List.
+		poke_back (new Assignment
+			(std::move (static_cast<Assignment&>(parameter))));
+	}
+return *this;
+}
+
 Aggregate&
 Aggregate::operator=
 	(
@@ -959,7 +1489,7 @@ if (this == &parameter)
 	return 0;
 	}
 int
-	comparison = Name.compare (parameter.name ());
+	comparison = Name.compare (parameter.name_symbol ());
 if (comparison != 0)
 	{
 	return comparison;
@@ -997,41 +1527,763 @@ return comparison;
 /*------------------------------------------------------------------------------
 	Find
 */
-Parameter*
-Aggregate::find
-	(
-	const std::string&				pathname,
-	bool							case_sensitive,
-	int								skip,
-	idaeim::PVL::Parameter::Type	type_code
-	)
-	const
+/*	Pathname index.
+
+	Each Parameter in the Aggregate hierarchy is listed, in depth-first
+	order, under the uppercase form of its absolute pathname relative
+	to the Aggregate and under the uppercase form of the last pathname
+	segment of its name; this is the entire name unless the name itself
+	contains a pathname delimiter. Any Parameter that matches a
+	pathname must be listed under the same key as the pathname, so only
+	the listed Parameters need to be examined.
+
+	The pathname keys depend on the pathname delimiter, which may be
+	different for each thread (see Parameter::Conventions). So a
+	separate set of tables is kept for each delimiter that is used; the
+	tables for one delimiter are never rebuilt, or removed, while
+	another delimiter is in use, only when the index is out of date.
+*/
+struct Aggregate::Pathname_Index
 {
+typedef std::unordered_map<std::string, std::vector<Parameter*> >	Map;
 
-if (skip < 0)
-	skip = 0;
-Aggregate::depth_iterator
-	parameter (*this),
-	aggregate_end = parameter.end_depth ();
-for (;
-	 parameter != aggregate_end;
-	 ++parameter)
-	{
-	if (parameter->at_pathname (pathname, case_sensitive, this) &&
-		parameter->is (type_code) &&
-		! skip--)
-		break;
-	}
-if (parameter == aggregate_end)
+struct Tables
 	{
-	return NULL;
-	}
-return &(*parameter);
+	Map
+		Pathnames,
+		Names;
+	};
+
+//	The tables for each pathname delimiter.
+std::map<char, Tables>
+	Delimited;
+bool
+	Valid;
+std::mutex
+	Lock;
+
+Pathname_Index ()
+	:	Valid (false)
+	{}
+
+const Tables& tables (const Aggregate& aggregate, char delimiter);
+void add (Tables& tables, char delimiter,
+	const Aggregate& aggregate, const std::string& path);
+};
+
+
+const Aggregate::Pathname_Index::Tables&
+Aggregate::Pathname_Index::tables
+	(
+	const Aggregate&	aggregate,
+	char				delimiter
+	)
+{
+//	Concurrent finds must not build the tables at the same time.
+std::lock_guard<std::mutex>
+	lock (Lock);
+if (! Valid)
+	{
+	Delimited.clear ();
+	Valid = true;
+	}
+std::map<char, Tables>::iterator
+	entry = Delimited.find (delimiter);
+if (entry == Delimited.end ())
+	{
+	entry = Delimited.insert (std::make_pair (delimiter, Tables ())).first;
+	add (entry->second, delimiter, aggregate, "");
+	}
+return entry->second;
+}
+
+
+void
+Aggregate::Pathname_Index::add
+	(
+	Tables&				tables,
+	char				delimiter,
+	const Aggregate&	aggregate,
+	const std::string&	path
+	)
+{
+for (const_iterator
+		element = aggregate.begin (),
+		last    = aggregate.end ();
+	 element != last;
+	 ++element)
+	{
+	Parameter
+		*parameter = aggregate.peek (element);
+	string
+		name (parameter->Name.str ());
+	to_uppercase (name);
+	string
+		pathname (path);
+	pathname += delimiter;
+	pathname += name;
+	tables.Pathnames[pathname].push_back (parameter);
+	tables.Names[name.substr (name.rfind (delimiter) + 1)]
+		.push_back (parameter);
+	if (parameter->is_Aggregate ())
+		add (tables, delimiter,
+			static_cast<const Aggregate&>(*parameter), pathname);
+	}
+}
+
+
+Aggregate&
+Aggregate::indexed
+	(
+	bool	enable
+	)
+{
+if (enable)
+	{
+	if (! Index)
+		Index = new Pathname_Index;
+	}
+else
+if (Index)
+	{
+	delete Index;
+	Index = NULL;
+	}
+return *this;
+}
+
+
+void
+Aggregate::invalidate_index ()
+{
+invalidate_hash ();
+for (Aggregate
+		*aggregate = this;
+	 aggregate;
+	 aggregate = aggregate->Parent)
+	{
+	if (aggregate->Index)
+		aggregate->Index->Valid = false;
+	Depth_Offsets
+		*offsets = aggregate->Offsets.load (std::memory_order_acquire);
+	if (offsets)
+		offsets->Valid = false;
+	}
+}
+
+
+const std::vector<Parameter*>*
+Aggregate::index_candidates
+	(
+	const std::string&	key,
+	bool				absolute
+	)
+	const
+{
+static const std::vector<Parameter*>
+	None;
+if (! Index)
+	return NULL;
+const Pathname_Index::Tables
+	&tables = Index->tables (*this, path_delimiter ());
+const Pathname_Index::Map
+	&map = absolute ? tables.Pathnames : tables.Names;
+Pathname_Index::Map::const_iterator
+	entry = map.find (key);
+return (entry == map.end ()) ? &None : &entry->second;
+}
+
+
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+/*	Tests if a Parameter matches a simple name.
+
+	The name is matched against the Parameter's name Symbol without
+	examining the Parameter's pathname. When the name is interned - the
+	name Symbol is not empty - and the Parameter's name Symbol is also
+	interned the comparison is a pointer comparison.
+*/
+bool
+name_matches
+	(
+	const Parameter&	parameter,
+	const Symbol&		name,
+	const std::string&	pathname,
+	bool				case_sensitive,
+	char				delimiter,
+	const Aggregate*	root
+	)
+{
+return
+	(name.empty () ?
+		parameter.name_symbol ().equals (pathname, case_sensitive) :
+		parameter.name_symbol ().equals (name, case_sensitive)) ||
+	//	A name containing a delimiter may end with the pathname.
+	(parameter.name_symbol ().str ().find (delimiter) != string::npos &&
+	 parameter.at_pathname (pathname, case_sensitive, root));
+}
+
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+
+//	The criteria shared by the copies of a Find_Iterator.
+struct Aggregate::Find_Iterator::Query
+{
+const Aggregate
+	*Root;
+std::string
+	Pathname;
+bool
+	Case_Sensitive;
+Parameter::Type
+	Type;
+char
+	Delimiter;
+bool
+	Absolute,
+	Simple_Name;
+Symbol
+	Name;
+
+Query
+	(
+	const Aggregate&	root,
+	const std::string&	pathname,
+	bool				case_sensitive,
+	Parameter::Type		type_code
+	)
+	:	Root (&root),
+		Pathname (pathname),
+		Case_Sensitive (case_sensitive),
+		Type (type_code),
+		Delimiter (path_delimiter ()),
+		Absolute
+			(! pathname.empty () && pathname[0] == Delimiter),
+		Simple_Name
+			(! pathname.empty () &&
+			pathname.find (Delimiter) == string::npos)
+{
+if (Simple_Name)
+	Name = Symbol::find (pathname);
+}
+};
+
+
+Parameter*
+Aggregate::find
+	(
+	const std::string&				pathname,
+	bool							case_sensitive,
+	int								skip,
+	idaeim::PVL::Parameter::Type	type_code
+	)
+	const
+{
+/*	The search is done directly, rather than with a Find_Iterator,
+	so that nothing is allocated for the search criteria.
+*/
+if (skip < 0)
+	skip = 0;
+char
+	delimiter = path_delimiter ();
+
+if (indexed ())
+	{
+	string
+		key (pathname);
+	to_uppercase (key);
+	bool
+		absolute = ! key.empty () && key[0] == delimiter;
+	const std::vector<Parameter*>
+		*candidates = index_candidates (absolute ?
+			key : key.substr (key.rfind (delimiter) + 1), absolute);
+	for (std::vector<Parameter*>::const_iterator
+			candidate = candidates->begin (),
+			last      = candidates->end ();
+		 candidate != last;
+		 ++candidate)
+		{
+		//	An uppercase absolute pathname key is an exact match.
+		if ((*candidate)->is (type_code) &&
+			((absolute && ! case_sensitive) ||
+				(*candidate)->at_pathname (pathname, case_sensitive, this)) &&
+			! skip--)
+			return *candidate;
+		}
+	return NULL;
+	}
+
+bool
+	simple_name =
+		! pathname.empty () &&
+		pathname.find (delimiter) == string::npos;
+Symbol
+	name;
+if (simple_name)
+	name = Symbol::find (pathname);
+for (Depth_Iterator
+		parameter (*this),
+		last = parameter.end_depth ();
+	 parameter != last;
+	 ++parameter)
+	if (parameter->is (type_code) &&
+		(simple_name ?
+			name_matches (*parameter, name, pathname, case_sensitive,
+				delimiter, this) :
+			parameter->at_pathname (pathname, case_sensitive, this)) &&
+		! skip--)
+		return &(*parameter);
+return NULL;
+}
+
+
+Aggregate::Find_Range
+Aggregate::find_all
+	(
+	const std::string&				pathname,
+	bool							case_sensitive,
+	idaeim::PVL::Parameter::Type	type_code
+	)
+	const
+{
+std::shared_ptr<Find_Iterator::Query>
+	query (new Find_Iterator::Query (*this, pathname, case_sensitive, type_code));
+return Find_Range (Find_Iterator (query));
+}
+
+
+int
+Aggregate::find_count
+	(
+	const std::string&				pathname,
+	bool							case_sensitive,
+	idaeim::PVL::Parameter::Type	type_code
+	)
+	const
+{
+Find_Range
+	found (find_all (pathname, case_sensitive, type_code));
+int
+	count = 0;
+for (Find_Iterator
+		parameter = found.begin (),
+		last      = found.end ();
+	 parameter != last;
+	 ++parameter)
+	++count;
+return count;
+}
+
+/*------------------------------------------------------------------------------
+	Find_Iterator
+*/
+
+Aggregate::Find_Iterator::Find_Iterator
+	(
+	const std::shared_ptr<const Query>&	query
+	)
+	:	Find_Query (query),
+		Candidates (NULL),
+		Candidate (0),
+		Current (NULL)
+{
+if (query->Root->indexed ())
+	{
+	string
+		key (query->Pathname);
+	to_uppercase (key);
+	Candidates = query->Root->index_candidates (query->Absolute ?
+		key : key.substr (key.rfind (query->Delimiter) + 1), query->Absolute);
+	}
+else
+	{
+	Position = Depth_Iterator (*query->Root);
+	End = Position.end_depth ();
+	}
+seek ();
+}
+
+
+Aggregate::Find_Iterator&
+Aggregate::Find_Iterator::operator++ ()
+{
+if (Candidates)
+	++Candidate;
+else
+	++Position;
+seek ();
+return *this;
+}
+
+
+void
+Aggregate::Find_Iterator::seek ()
+{
+if (Candidates)
+	{
+	for (;
+		 Candidate < Candidates->size ();
+		 ++Candidate)
+		if (matches ((*Candidates)[Candidate]))
+			{
+			Current = (*Candidates)[Candidate];
+			return;
+			}
+	}
+else
+	{
+	for (;
+		 Position != End;
+		 ++Position)
+		if (matches (&(*Position)))
+			{
+			Current = &(*Position);
+			return;
+			}
+	}
+Current = NULL;
+}
+
+
+bool
+Aggregate::Find_Iterator::matches
+	(
+	const Parameter*	parameter
+	) const
+{
+const Query
+	&query = *Find_Query;
+if (! parameter->is (query.Type))
+	return false;
+if (Candidates)
+	//	An uppercase absolute pathname key is an exact match.
+	return
+		(query.Absolute && ! query.Case_Sensitive) ||
+		parameter->at_pathname
+			(query.Pathname, query.Case_Sensitive, query.Root);
+if (query.Simple_Name)
+	return name_matches (*parameter, query.Name, query.Pathname,
+		query.Case_Sensitive, query.Delimiter, query.Root);
+return parameter->at_pathname
+	(query.Pathname, query.Case_Sensitive, query.Root);
+}
+
+/*------------------------------------------------------------------------------
+	Memory usage
+*/
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+/*	An estimate of the memory used by a pathname index map.
+
+	Each map entry is a node holding the next node pointer, the saved
+	hash code and the key and candidates pair.
+*/
+std::size_t
+index_map_usage
+	(
+	const std::unordered_map<std::string, std::vector<Parameter*> >&	map
+	)
+{
+std::size_t
+	amount = map.bucket_count () * sizeof (void*);
+for (std::unordered_map<std::string, std::vector<Parameter*> >::const_iterator
+		entry = map.begin (),
+		last  = map.end ();
+	 entry != last;
+	 ++entry)
+	amount +=
+		sizeof (void*) + sizeof (std::size_t) + sizeof (*entry)
+		+ Memory_Usage::string_size (entry->first)
+		+ entry->second.capacity () * sizeof (Parameter*);
+return amount;
+}
+
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+
+void
+Aggregate::add_memory_usage
+	(
+	Memory_Usage&	usage
+	)
+	const
+{
+Parameter::add_memory_usage (usage);
+usage.Nodes += sizeof (Aggregate);
+usage.Lists += size () * sizeof (Parameter*);
+usage.Slack += (capacity () - size ()) * sizeof (Parameter*);
+if (Index)
+	{
+	usage.Indices += sizeof (Pathname_Index);
+	for (std::map<char, Pathname_Index::Tables>::const_iterator
+			tables = Index->Delimited.begin (),
+			last   = Index->Delimited.end ();
+		 tables != last;
+		 ++tables)
+		usage.Indices += sizeof (*tables) + 4 * sizeof (void*)
+			+ index_map_usage (tables->second.Pathnames)
+			+ index_map_usage (tables->second.Names);
+	}
+Depth_Offsets
+	*offsets = Offsets.load (std::memory_order_acquire);
+if (offsets)
+	usage.Indices += sizeof (Depth_Offsets)
+		+ offsets->Offsets.capacity () * sizeof (size_type);
+for (const_iterator
+		parameter = begin (),
+		last      = end ();
+	 parameter != last;
+	 ++parameter)
+	{
+	parameter->add_memory_usage (usage);
+	Arena::node_usage (&*parameter, usage);
+	}
 }
 
 /*------------------------------------------------------------------------------
 	Select
 */
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+/*	Selection plan.
+
+	The pathnames of all the selections are entered, last name first,
+	into a trie keyed by case-insensitive names. A Parameter is matched
+	against every selection at once by following the trie from the
+	Parameter's name up through the names of its parents. Each trie node
+	lists the relative and the absolute pathname selections that end at
+	the node.
+*/
+struct Folded_Hash
+{
+std::size_t operator() (const string& name) const
+{
+std::size_t
+	hash = 0;
+for (string::const_iterator
+		character = name.begin ();
+	 character != name.end ();
+	 ++character)
+	hash = hash * 31 + toupper (*character);
+return hash;
+}
+};
+
+struct Folded_Equal
+{
+bool operator() (const string& name_1, const string& name_2) const
+{
+if (name_1.length () != name_2.length ())
+	return false;
+for (string::size_type
+		index = 0;
+	 index < name_1.length ();
+	 index++)
+	if (! same_character (name_1[index], name_2[index], false))
+		return false;
+return true;
+}
+};
+
+struct Selection_Node
+{
+typedef std::unordered_map<string, int, Folded_Hash, Folded_Equal>
+	Children_Map;
+
+Children_Map
+	Children;
+std::vector<int>
+	Relative,
+	Absolute;
+};
+
+class Selection_Plan
+{
+public:
+
+explicit Selection_Plan (int selections)
+	:	Nodes (1),
+		Pathnames (selections),
+		Matches (selections, static_cast<Parameter*>(NULL)),
+		Unresolved (0)
+	{}
+
+void
+add
+	(
+	int				selection,
+	const string&	pathname
+	)
+{
+char
+	delimiter = Parameter::path_delimiter ();
+bool
+	absolute = ! pathname.empty () && pathname[0] == delimiter;
+string::size_type
+	first = absolute ? 1 : 0,
+	last = pathname.length (),
+	start;
+int
+	node = 0;
+while (true)
+	{
+	//	The next name, from the end of the pathname.
+	start = last ? pathname.rfind (delimiter, last - 1) : string::npos;
+	if (start == string::npos || start < first)
+		start = first;
+	else
+		++start;
+	string
+		name (pathname, start, last - start);
+	Selection_Node::Children_Map::iterator
+		child = Nodes[node].Children.find (name);
+	if (child == Nodes[node].Children.end ())
+		{
+		Nodes[node].Children[name] = static_cast<int>(Nodes.size ());
+		node = static_cast<int>(Nodes.size ());
+		Nodes.push_back (Selection_Node ());
+		}
+	else
+		node = child->second;
+	if (start == first)
+		break;
+	last = start - 1;
+	}
+if (absolute)
+	Nodes[node].Absolute.push_back (selection);
+else
+	Nodes[node].Relative.push_back (selection);
+Pathnames[selection] = &pathname;
+++Unresolved;
+}
+
+bool
+resolved () const
+{return ! Unresolved;}
+
+Parameter*
+match
+	(
+	int		selection
+	) const
+{return Matches[selection];}
+
+void
+match
+	(
+	Parameter*			parameter,
+	const Aggregate*	root
+	)
+{
+char
+	delimiter = Parameter::path_delimiter ();
+bool
+	relative = true,
+	absolute = true;
+int
+	node = 0;
+const Parameter
+	*ancestor = parameter;
+while (relative || absolute)
+	{
+	const string
+		&name = ancestor->name_symbol ().str ();
+	if (name.find (delimiter) != string::npos)
+		{
+		//	The trie can't follow a name containing a delimiter.
+		match_each (parameter, root);
+		return;
+		}
+	Selection_Node::Children_Map::const_iterator
+		child = Nodes[node].Children.find (name);
+	if (child == Nodes[node].Children.end ())
+		break;
+	node = child->second;
+
+	const Aggregate
+		*parent = ancestor->parent ();
+	if (relative)
+		{
+		resolve (Nodes[node].Relative, parameter);
+		//	Special case: CONTAINER_NAME qualifies as default root.
+		if (! parent ||
+			parent->name_symbol ().str () == Parser::CONTAINER_NAME)
+			relative = false;
+		}
+	if (absolute &&
+		parent == root)
+		{
+		resolve (Nodes[node].Absolute, parameter);
+		absolute = false;
+		}
+	if (! parent)
+		break;
+	ancestor = parent;
+	}
+}
+
+private:
+
+void
+resolve
+	(
+	const std::vector<int>&	selections,
+	Parameter*				parameter
+	)
+{
+for (std::vector<int>::const_iterator
+		selection = selections.begin ();
+	 selection != selections.end ();
+	 ++selection)
+	{
+	if (! Matches[*selection])
+		{
+		Matches[*selection] = parameter;
+		--Unresolved;
+		}
+	}
+}
+
+void
+match_each
+	(
+	Parameter*			parameter,
+	const Aggregate*	root
+	)
+{
+for (std::vector<const string*>::size_type
+		selection = 0;
+	 selection < Pathnames.size ();
+	 selection++)
+	{
+	if (Pathnames[selection] &&
+		! Matches[selection] &&
+		parameter->at_pathname (*Pathnames[selection], false, root))
+		{
+		Matches[selection] = parameter;
+		--Unresolved;
+		}
+	}
+}
+
+std::vector<Selection_Node>
+	Nodes;
+std::vector<const string*>
+	Pathnames;
+std::vector<Parameter*>
+	Matches;
+int
+	Unresolved;
+};
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+
 void
 Aggregate::select
 	(
@@ -1044,6 +2296,62 @@ if (! selections)
 	return;
 	}
 
+int
+	total = 0;
+while (selections[total].Type)
+	++total;
+
+/*	Resolve all the selections.
+
+	Each selection resolves to the first ASSIGNMENT Parameter, in
+	depth-first order, at its pathname. With the pathname index each
+	selection is found directly. Otherwise all the selections are
+	matched in a single traversal of the Aggregate hierarchy.
+*/
+std::vector<Parameter*>
+	matches (total, static_cast<Parameter*>(NULL));
+int
+	index;
+if (Index)
+	{
+	for (index = 0;
+		 index < total;
+		 index++)
+		if (selections[index].Variable &&
+			! (selections[index].Type & Value::ARRAY))
+			matches[index] = find
+				(
+				selections[index].Pathname,
+				false,	//	Not case sensitive.
+				0,		//	No parameter skipping.
+				ASSIGNMENT
+				);
+	}
+else
+	{
+	Selection_Plan
+		plan (total);
+	for (index = 0;
+		 index < total;
+		 index++)
+		if (selections[index].Variable &&
+			! (selections[index].Type & Value::ARRAY))
+			plan.add (index, selections[index].Pathname);
+	Aggregate::depth_iterator
+		parameter (*this),
+		aggregate_end = parameter.end_depth ();
+	for (;
+		 parameter != aggregate_end &&
+		 ! plan.resolved ();
+		 ++parameter)
+		if (parameter->is (ASSIGNMENT))
+			plan.match (&(*parameter), this);
+	for (index = 0;
+		 index < total;
+		 index++)
+		matches[index] = plan.match (index);
+	}
+
 Parameter
 	*parameter;
 Value
@@ -1055,7 +2363,9 @@ int
 	array_index,
 	amount;
 
-while (selections->Type)
+for (index = 0;
+	 index < total;
+	 index++, selections++)
 	{
 	if (! selections->Variable)
 		continue;
@@ -1073,13 +2383,7 @@ while (selections->Type)
 		throw Invalid_Argument (message.str (), Parameter::ID);
 		}
 
-	if ((parameter = find
-			(
-			selections->Pathname,
-			false,	//	Not case sensitive.
-			0,		//	No parameter skipping.
-			ASSIGNMENT
-			)))
+	if ((parameter = matches[index]))
 		{
 		if (parameter->value ().is_Array ())
 			{
@@ -1128,7 +2432,6 @@ while (selections->Type)
 				}
 			}
 		}
-	++selections;
 	}
 }
 
@@ -1212,30 +2515,44 @@ Aggregate::move_in
 {
 /*	Implementation note:
 
-	The code would be more compact if the parameter pointers were moved
-	in a peek, pull, poke_back loop. However, a pull instead of a
-	pull_back would be used to maintain the order of the original
-	parameters which would entail an unecessary and potentially
-	expensive shift-up of all the remaining pointers in the list after
-	each pull. To avoid this all the pointers are simply copied, wiped
-	from the source aggregate (which also avoids unecessary parent
-	pointer NULL-ing) and then poke_back is used to move the copied
-	pointers into this aggregate list.
+	The parameter pointers are spliced into this Parameter List as a
+	single range rather than being pulled and poked one at a time. The
+	path check, the total size adjustments and the index invalidations
+	that entering and removing would apply to each parameter are done
+	once for the whole list, and the parameters are re-parented in a
+	single pass.
 */
-//	Copy the new Parameter List (just the pointers).
-std::vector<Parameter*>
-	list (aggregate.vector_base ());
-//	Remove the pointers but don't delete the Parameters.
-aggregate.wipe ();
-//	Move the parameter pointers into this Parameter List.
-for (std::vector<Parameter*>::const_iterator
-		parameter = list.begin (),
-		last      = list.end ();
-	 parameter != last;
-	 ++parameter)
+if (&aggregate == this ||
+	aggregate.empty ())
+	return *this;
+//	None of the moved Parameters may be in this Aggregate's path.
+for (Parameter
+		*parameter = this;
+	 parameter;
+	 parameter = parameter->Parent)
 	{
-	poke_back (*parameter);	//	Poke it into the destination (Parent reset).
+	if (parameter->Parent == &aggregate)
+		throw Invalid_Argument
+			(
+			string ("Can't enter Parameter \"") + parameter->pathname () + "\"\n"
+			+ "  into the list of Aggregate \"" + pathname () + "\"\n"
+			+ "  because it is already in the Aggregate's path.",
+			Parameter::ID
+			);
 	}
+size_type
+	amount = aggregate.Total_Size;
+aggregate.total_size_change (amount, false);
+aggregate.invalidate_index ();
+for (iterator
+		parameter = aggregate.begin (),
+		last      = aggregate.end ();
+	 parameter != last;
+	 ++parameter)
+	parameter->Parent = this;
+splice_back (aggregate);
+total_size_change (amount, true);
+invalidate_index ();
 return *this;
 }
 
@@ -1308,6 +2625,79 @@ return NULL;
 /*------------------------------------------------------------------------------
 	Vectal related methods.
 */
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+//	The minimum list size for which depth-first offsets are kept.
+const Aggregate::size_type
+	DEPTH_OFFSETS_MINIMUM	= 16;
+
+//	The number of Parameters in a depth-first traversal of a Parameter.
+inline Aggregate::size_type
+depth_span
+	(
+	const Parameter*	parameter
+	)
+{
+return parameter->is_Aggregate () ?
+	(static_cast<const Aggregate*>(parameter)->total_size () + 1) : 1;
+}
+
+//	The object of an atomic pointer, created when first needed.
+template<typename Object>
+Object*
+depth_offsets
+	(
+	std::atomic<Object*>&	pointer
+	)
+{
+Object
+	*object = pointer.load (std::memory_order_acquire);
+if (! object)
+	{
+	Object
+		*created = new Object;
+	if (pointer.compare_exchange_strong
+			(object, created, std::memory_order_acq_rel))
+		object = created;
+	else
+		delete created;
+	}
+return object;
+}
+
+/*	The offsets of a list, built if they are not valid.
+
+	Once the offsets are valid they are read without the lock, so
+	offsets that were built before a list was shared - like those of a
+	Frozen snapshot - are read without modifying anything.
+*/
+template<typename Object, typename List>
+const Object*
+valid_depth_offsets
+	(
+	std::atomic<Object*>&	pointer,
+	const List&				list
+	)
+{
+Object
+	*offsets = pointer.load (std::memory_order_acquire);
+if (! offsets ||
+	! offsets->Valid.load (std::memory_order_acquire))
+	{
+	offsets = depth_offsets (pointer);
+	std::lock_guard<std::mutex>
+		lock (offsets->Lock);
+	if (! offsets->Valid.load (std::memory_order_relaxed))
+		offsets->build (list);
+	}
+return offsets;
+}
+
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+
 void
 Aggregate::entering
 	(
@@ -1329,6 +2719,8 @@ while (parent)
 	parent = parent->Parent;
 	}
 parameter->Parent = this;
+total_size_change (depth_span (parameter), true);
+invalidate_index ();
 }
 
 void
@@ -1338,25 +2730,130 @@ Aggregate::removing
 	)
 {
 parameter->Parent = NULL;
+total_size_change (depth_span (parameter), false);
+invalidate_index ();
+}
+
+void
+Aggregate::wipe ()
+{
+for (iterator
+		parameter = begin (),
+		last      = end ();
+	 parameter != last;
+	 ++parameter)
+	parameter->Parent = NULL;
+total_size_change (Total_Size, false);
+Parameter_List::wipe ();
+invalidate_index ();
+}
+
+void
+Aggregate::total_size_change
+	(
+	size_type	amount,
+	bool		increase
+	)
+{
+for (Aggregate
+		*aggregate = this;
+	 aggregate;
+	 aggregate = aggregate->Parent)
+	{
+	if (increase)
+		aggregate->Total_Size += amount;
+	else
+		aggregate->Total_Size -= amount;
+	}
+}
+
+void
+Aggregate::Depth_Offsets::build
+	(
+	const Aggregate&	aggregate
+	)
+{
+Offsets.resize (aggregate.size () + 1);
+size_type
+	offset = 0,
+	index = 0;
+for (const_iterator
+		parameter = aggregate.begin (),
+		last      = aggregate.end ();
+	 parameter != last;
+	 ++parameter)
+	{
+	Offsets[index++] = offset;
+	offset += depth_span (&*parameter);
+	}
+Offsets[index] = offset;
+Valid.store (true, std::memory_order_release);
 }
 
+
 Aggregate::size_type
-Aggregate::total_size ()
+Aggregate::depth_offset
+	(
+	size_type	index
+	)
+	const
 {
-int
-	total = 0;
-if (! empty ())
+if (index >= size ())
+	return Total_Size;
+if (size () < DEPTH_OFFSETS_MINIMUM)
 	{
-	for (iterator
-			first = begin (),
-			last  = end ();
-		first != last;
-		++first,
-		++total)
-		if (first->is_Aggregate ())
-			total += (static_cast<Aggregate&>(*first)).total_size ();
+	size_type
+		offset = 0;
+	for (const_iterator
+			parameter = begin (),
+			last      = begin () + index;
+		 parameter != last;
+		 ++parameter)
+		offset += depth_span (&*parameter);
+	return offset;
+	}
+const Depth_Offsets
+	*offsets = valid_depth_offsets (Offsets, *this);
+return offsets->Offsets[index];
+}
+
+
+Aggregate::size_type
+Aggregate::depth_index
+	(
+	size_type&	offset
+	)
+	const
+{
+if (size () < DEPTH_OFFSETS_MINIMUM)
+	{
+	size_type
+		index = 0,
+		span;
+	for (const_iterator
+			parameter = begin ();
+			offset >= (span = depth_span (&*parameter));
+			++parameter,
+			++index)
+		offset -= span;
+	return index;
 	}
-return total;
+const Depth_Offsets
+	*offsets = valid_depth_offsets (Offsets, *this);
+size_type
+	index = std::upper_bound
+		(offsets->Offsets.begin (), offsets->Offsets.end (), offset)
+		- offsets->Offsets.begin () - 1;
+offset -= offsets->Offsets[index];
+return index;
+}
+
+
+void
+Aggregate::build_depth_offsets () const
+{
+if (size () >= DEPTH_OFFSETS_MINIMUM)
+	valid_depth_offsets (Offsets, *this);
 }
 
 /*******************************************************************************
@@ -1386,7 +2883,23 @@ Aggregate::Depth_Iterator::Depth_Iterator
 	const Aggregate&	aggregate
 	)
 	:	Current_Position ((const_cast<Aggregate&>(aggregate)).begin ()),
-		Current_Aggregate (const_cast<Aggregate*>(&aggregate))
+		Current_Aggregate (const_cast<Aggregate*>(&aggregate)),
+		Depth (0),
+		Base (0),
+		Parent_Traversal (false)
+{
+}
+
+Aggregate::Depth_Iterator::Depth_Iterator
+	(
+	const Aggregate&	aggregate,
+	bool				parent_traversal
+	)
+	:	Current_Position ((const_cast<Aggregate&>(aggregate)).begin ()),
+		Current_Aggregate (const_cast<Aggregate*>(&aggregate)),
+		Depth (0),
+		Base (0),
+		Parent_Traversal (parent_traversal)
 {
 }
 
@@ -1395,7 +2908,10 @@ Aggregate::Depth_Iterator::Depth_Iterator
 	const Aggregate::iterator&	list_iterator
 	)
 	:	Current_Position (list_iterator),
-		Current_Aggregate ((*list_iterator).parent ())
+		Current_Aggregate ((*list_iterator).parent ()),
+		Depth (0),
+		Base (0),
+		Parent_Traversal (false)
 {
 }
 
@@ -1409,7 +2925,7 @@ if (! top)
 	throw Error
 		("Can't get the end of an invalid Depth_Iterator", Parameter::ID);
 Depth_Iterator
-	depth_iterator (*top);
+	depth_iterator (*top, Parent_Traversal);
 depth_iterator.Current_Position = depth_iterator.Current_Aggregate->end ();
 return depth_iterator;
 }
@@ -1426,27 +2942,21 @@ if (Current_Position != list_iterator)
 	if (Current_Aggregate->end () == list_iterator)
 		{
 		Current_Position = list_iterator;
-		if (! Previous_Position.empty ())
+		if (Depth)
 			{
 			if (Current_Aggregate->empty ())
 				{
 				//	Increment to a valid position.
 				do
 					{
-					/*	Ascend to the Previous_Position in the parent Aggregate.
+					/*	Ascend to the position in the parent Aggregate.
 						The pre-increment will then move to the next Parameter
 						in the parent Aggregate's Parameter_List.
 					*/
-					Current_Position = Previous_Position.back ();
-					Previous_Position.pop_back ();
-					if (! (Current_Aggregate = Current_Position->parent ()))
-						throw Error
-							(string ("Depth_Iterator increment found no parent for \"")
-							+ Current_Position->name () + "\".",
-							Parameter::ID);
+					ascend ("increment");
 					}
 					while (++Current_Position == Current_Aggregate->end () &&
-							! Previous_Position.empty ());
+							Depth);
 				}
 			else
 				//	Back off from the end.
@@ -1459,35 +2969,24 @@ if (Current_Position != list_iterator)
 		}
 	else
 		{
-		//	Try to find the list_iterator in the scope of this Depth_Iterator.
-		Depth_Iterator
-			position (*this);
-		try
-			{
-			while (--*this != list_iterator) ;
-			}
-		catch (Out_of_Range out_of_range)
+		//	Find the list_iterator in the scope of this Depth_Iterator.
+		size_type
+			position;
+		try {position = list_position (list_iterator);}
+		catch (Out_of_Range exception)
 			{
-			try
-				{
-				*this = position;
-				while (++*this != list_iterator) ;
-				}
-			catch (Out_of_Range exception)
-				{
-				*this = position;
-				throw Invalid_Argument
-					(
-					string ("Can't assign the Parameter iterator at ")
-					+ list_iterator->pathname () + '\n'
-					+ "  to the Depth_Iterator at "
-					+ Current_Position->pathname ()
-					+ " from " + root ()->pathname () + ".\n"
-					+ "  The former is not in the scope of the later.",
-					Parameter::ID
-					);
-				}
+			throw Invalid_Argument
+				(
+				string ("Can't assign the Parameter iterator at ")
+				+ list_iterator->pathname () + '\n'
+				+ "  to the Depth_Iterator at "
+				+ Current_Position->pathname ()
+				+ " from " + root ()->pathname () + ".\n"
+				+ "  The former is not in the scope of the later.",
+				Parameter::ID
+				);
 			}
+		depth_position (position);
 		}
 	}
 return *this;
@@ -1500,10 +2999,200 @@ return *this;
 Aggregate*
 Aggregate::Depth_Iterator::root () const
 {
-if (Previous_Position.empty ())
+if (! Depth)
 	return Current_Aggregate;
-else
+if (! Parent_Traversal)
 	return Previous_Position[0]->parent ();
+Aggregate
+	*aggregate = Current_Aggregate;
+for (unsigned int
+		level = Depth;
+		level && aggregate;
+		level--)
+	aggregate = aggregate->parent ();
+return aggregate;
+}
+
+//	Depth-first offset of the current position.
+Aggregate::size_type
+Aggregate::Depth_Iterator::depth_position () const
+{
+if (Parent_Traversal)
+	return Base + Current_Aggregate->depth_offset
+		(Current_Position - Current_Aggregate->begin ());
+Aggregate
+	*aggregate = root ();
+size_type
+	position = 0;
+for (Position_Stack::const_iterator
+		previous = Previous_Position.begin ();
+		previous != Previous_Position.end ();
+		++previous)
+	{
+	//	The offset of the enclosing Aggregate, and the Aggregate itself.
+	position += aggregate->depth_offset (*previous - aggregate->begin ()) + 1;
+	aggregate = static_cast<Aggregate*>(previous->operator-> ());
+	}
+return position
+	+ aggregate->depth_offset (Current_Position - aggregate->begin ());
+}
+
+//	Reposition at a depth-first offset.
+void
+Aggregate::Depth_Iterator::depth_position
+	(
+	size_type	position
+	)
+{
+Aggregate
+	*top = root ();
+Previous_Position.clear ();
+Depth = 0;
+Base = 0;
+Current_Aggregate = top;
+if (position >= top->total_size ())
+	{
+	Current_Position = top->end ();
+	return;
+	}
+while (true)
+	{
+	Current_Position = Current_Aggregate->begin ()
+		+ Current_Aggregate->depth_index (position);
+	if (! position)
+		break;
+	//	Descend into the Aggregate that contains the position.
+	descend ();
+	--position;
+	}
+}
+
+//	Depth-first offset of a list iterator position.
+Aggregate::size_type
+Aggregate::Depth_Iterator::list_position
+	(
+	const Aggregate::iterator&	list_iterator
+	)
+	const
+{
+Aggregate
+	*top = root (),
+	*aggregate;
+if (list_iterator == top->end ())
+	return top->total_size ();
+if (list_iterator == Current_Aggregate->end ())
+	aggregate = Current_Aggregate;
+else
+	aggregate = list_iterator->parent ();
+size_type
+	position = 0;
+if (aggregate)
+	position = aggregate->depth_offset (list_iterator - aggregate->begin ());
+while (aggregate &&
+		aggregate != top)
+	{
+	if (Parent_Traversal &&
+		aggregate == Current_Aggregate)
+		//	The offset of the current Aggregate's list is known.
+		return Base + position;
+	Aggregate
+		*parent = aggregate->parent ();
+	if (! parent)
+		break;
+	/*	The index of the Aggregate in its parent's list is taken from
+		the current path when it is there; otherwise it is searched for.
+	*/
+	Position_Stack::const_iterator
+		previous = Previous_Position.begin ();
+	while (previous != Previous_Position.end () &&
+			previous->operator-> () != aggregate)
+		++previous;
+	size_type
+		index = (previous != Previous_Position.end ()) ?
+			(*previous - parent->begin ()) :
+			(std::find (parent->vector_base ().begin (),
+				parent->vector_base ().end (), aggregate)
+				- parent->vector_base ().begin ());
+	position += parent->depth_offset (index) + 1;
+	aggregate = parent;
+	}
+if (aggregate != top)
+	throw Out_of_Range
+		(
+		string ("The Parameter iterator is not in the scope\n")
+		+ "  of the Depth_Iterator root Aggregate: " + top->pathname (),
+		Parameter::ID
+		);
+return position;
+}
+
+//	Descend into the Aggregate at the current position.
+void
+Aggregate::Depth_Iterator::descend ()
+{
+if (Parent_Traversal)
+	Base += Current_Aggregate->depth_offset
+		(Current_Position - Current_Aggregate->begin ()) + 1;
+else
+	Previous_Position.push_back (Current_Position);
+++Depth;
+Current_Aggregate =
+	static_cast<Aggregate*>(Current_Position.operator-> ());
+}
+
+//	Ascend to the position of the current Aggregate in its parent.
+void
+Aggregate::Depth_Iterator::ascend
+	(
+	const char*	operation
+	)
+{
+if (Parent_Traversal)
+	{
+	if (! Current_Aggregate->parent ())
+		throw Error
+			(string ("Depth_Iterator ") + operation
+			+ " found no parent for \"" + Current_Aggregate->name () + "\".",
+			Parameter::ID);
+	/*	The position of the current Aggregate in its parent's list is
+		found, without searching the list, by following the depth-first
+		offset of the Aggregate down from the root through the depth
+		offset tables of the Aggregates that contain it.
+	*/
+	Aggregate
+		*aggregate = root ();
+	size_type
+		offset = Base - 1,
+		base = 0,
+		element_offset,
+		index;
+	while (true)
+		{
+		element_offset = offset;
+		index = aggregate->depth_index (offset);
+		if (! offset)
+			//	The current Aggregate is at the index.
+			break;
+		//	Descend into the Aggregate that contains the current Aggregate.
+		base += element_offset - offset + 1;
+		aggregate = static_cast<Aggregate*>(aggregate->vector_base ()[index]);
+		--offset;
+		}
+	Current_Position = aggregate->begin () + index;
+	Current_Aggregate = aggregate;
+	Base = base;
+	}
+else
+	{
+	Current_Position = Previous_Position.back ();
+	Previous_Position.pop_back ();
+	if (! (Current_Aggregate = Current_Position->parent ()))
+		throw Error
+			(string ("Depth_Iterator ") + operation
+			+ " found no parent for \"" + Current_Position->name () + "\".",
+			Parameter::ID);
+	}
+--Depth;
 }
 
 /*------------------------------------------------------------------------------
@@ -1516,7 +3205,7 @@ Aggregate::Depth_Iterator::operator++ ()
 if (! Current_Aggregate)
 	throw Error
 		("Can't increment an invalid Depth_Iterator", Parameter::ID);
-if (! Previous_Position.empty () ||
+if (Depth ||
 	Current_Position != Current_Aggregate->end ())
 	{
 	if (Current_Position->is_Aggregate () &&
@@ -1526,29 +3215,21 @@ if (! Previous_Position.empty () ||
 			Save the current position, then
 			descend to the first Parameter in this Aggregate.
 		*/
-		Previous_Position.push_back (Current_Position);
-		Current_Aggregate =
-			static_cast<Aggregate*>(Current_Position.operator-> ());
+		descend ();
 		Current_Position = Current_Aggregate->begin ();
 		}
 	else
 		{
 		//	Pre-increment to the next position.
 		while (++Current_Position == Current_Aggregate->end () &&
-				! Previous_Position.empty ())
+				Depth)
 			{
 			/*	End of the current Parameter_List in a child Aggregate.
-				Ascend to the Previous_Position in the parent Aggregate.
+				Ascend to the position in the parent Aggregate.
 				The pre-increment will then move to the next Parameter
 				in the parent Aggregate's Parameter_List.
 			*/
-			Current_Position = Previous_Position.back ();
-			Previous_Position.pop_back ();
-			if (! (Current_Aggregate = Current_Position->parent ()))
-				throw Error
-					(string ("Depth_Iterator increment found no parent for \"")
-					+ Current_Position->name () + "\".",
-					Parameter::ID);
+			ascend ("increment");
 			}
 		}
 	return *this;
@@ -1568,25 +3249,19 @@ Aggregate::Depth_Iterator::next_sibling ()
 if (! Current_Aggregate)
 	throw Error
 		("No next siblilng for an invalid Depth_Iterator", Parameter::ID);
-if (! Previous_Position.empty () ||
+if (Depth ||
 	Current_Position != Current_Aggregate->end ())
 	{
 	//	Pre-increment to the next position.
 	while (++Current_Position == Current_Aggregate->end () &&
-			! Previous_Position.empty ())
+			Depth)
 		{
 		/*	End of the current Parameter_List in a child Aggregate.
-			Ascend to the Previous_Position in the parent Aggregate.
+			Ascend to the position in the parent Aggregate.
 			The pre-increment will then move to the next Parameter
 			in the parent Aggregate's Parameter_List.
 		*/
-		Current_Position = Previous_Position.back ();
-		Previous_Position.pop_back ();
-		if (! (Current_Aggregate = Current_Position->parent ()))
-			throw Error
-				(string ("Depth_Iterator next sibling found no parent for \"")
-				+ Current_Position->name () + "\".",
-				Parameter::ID);
+		ascend ("next sibling");
 		}
 	return *this;
 	}
@@ -1616,7 +3291,7 @@ Aggregate::Depth_Iterator::operator-- ()
 if (! Current_Aggregate)
 	throw Error
 		("Can't decrement an invalid Depth_Iterator", Parameter::ID);
-if (! Previous_Position.empty () ||
+if (Depth ||
 	Current_Position != Current_Aggregate->begin ())
 	{
 	if (Current_Position == Current_Aggregate->begin ())
@@ -1624,13 +3299,7 @@ if (! Previous_Position.empty () ||
 		/*	The current position is the beginning of a child aggregate.
 			Ascend to the previous position in the parent Aggregate.
 		*/
-		Current_Position = Previous_Position.back ();
-		Previous_Position.pop_back ();
-		if (! (Current_Aggregate = Current_Position->parent ()))
-			throw Error
-				(string ("Depth_Iterator decrement found no parent for \"")
-				+ Current_Position->name () + "\".",
-				Parameter::ID);
+		ascend ("decrement");
 		}
 	else
 		{
@@ -1644,9 +3313,7 @@ if (! Previous_Position.empty () ||
 				The pre-decrement will back to the last Parameter in the
 				Aggregate's Parameter_List.
 			*/
-			Previous_Position.push_back (Current_Position);
-			Current_Aggregate =
-				static_cast<Aggregate*>(Current_Position.operator-> ());
+			descend ();
 			Current_Position = Current_Aggregate->end ();
 			}
 		}
@@ -1667,21 +3334,13 @@ Aggregate::Depth_Iterator::previous_sibling ()
 if (! Current_Aggregate)
 	throw Error
 		("No previous sibling for an invalid Depth_Iterator", Parameter::ID);
-if (! Previous_Position.empty () ||
+if (Depth ||
 	Current_Position != Current_Aggregate->begin ())
 	{
 	//	Pre-decrement to the previous position.
 	while (Current_Position == Current_Aggregate->begin () &&
-			! Previous_Position.empty ())
-		{
-		Current_Position = Previous_Position.back ();
-		Previous_Position.pop_back ();
-		if (! (Current_Aggregate = Current_Position->parent ()))
-			throw Error (string
-				("Depth_Iterator previous sibling found no parent for \"")
-				+ Current_Position->name () + "\".",
-				Parameter::ID);
-		}
+			Depth)
+		ascend ("previous sibling");
 	return *this;
 	}
 throw Out_of_Range
@@ -1717,12 +3376,31 @@ Aggregate::Depth_Iterator::operator+=
 	int		distance
 	)
 {
-if (distance > 0)
-	while (distance--)
-		++*this;
-else
-	while (distance++)
-		--*this;
+if (! Current_Aggregate)
+	throw Error
+		("Can't offset an invalid Depth_Iterator", Parameter::ID);
+if (distance == 1)
+	return ++*this;
+if (distance == -1)
+	return --*this;
+if (distance)
+	{
+	size_type
+		position = depth_position ();
+	if ((distance < 0 &&
+			position < (size_type)-distance) ||
+		(distance > 0 &&
+			root ()->total_size () - position < (size_type)distance))
+		{
+		ostringstream
+			message;
+		message << "Can't offset a Depth_Iterator by " << distance
+				<< " from position " << position << '\n'
+				<< "  of its root Aggregate: " << root ()->pathname ();
+		throw Out_of_Range (message.str (), Parameter::ID);
+		}
+	depth_position (position + distance);
+	}
 return *this;
 }
 
@@ -1759,27 +3437,9 @@ Aggregate::Depth_Iterator::operator-
 	const Aggregate::iterator&	list_iterator
 	) const
 {
-int
-	distance;
-Depth_Iterator
-	position;
-try
-	{
-	for (distance = 0,
-		 position = *this;
-		 position != list_iterator;
-		 --position,
-		 ++distance) ;
-	}
-catch (Out_of_Range exception)
-	{
-	for (distance = 0,
-		 position = *this + 1;
-		 position != list_iterator;
-		 ++position,
-		 --distance) ;
-	}
-return distance;
+if (*this == list_iterator)
+	return 0;
+return (int)depth_position () - (int)list_position (list_iterator);
 }
 
 int
@@ -1787,7 +3447,11 @@ Aggregate::Depth_Iterator::operator-
 	(
 	const Depth_Iterator&	depth_iterator
 	) const
-{return operator- (depth_iterator.Current_Position);}
+{
+if (root () == depth_iterator.root ())
+	return (int)depth_position () - (int)depth_iterator.depth_position ();
+return operator- (depth_iterator.Current_Position);
+}
 
 /*------------------------------------------------------------------------------
 	Logical operators
@@ -1797,7 +3461,11 @@ Aggregate::Depth_Iterator::operator<
 	(
 	const Depth_Iterator& 	depth_iterator
 	) const
-{return *this < depth_iterator.Current_Position;}
+{
+if (root () == depth_iterator.root ())
+	return depth_position () < depth_iterator.depth_position ();
+return *this < depth_iterator.Current_Position;
+}
 
 bool
 Aggregate::Depth_Iterator::operator<
@@ -1807,56 +3475,86 @@ Aggregate::Depth_Iterator::operator<
 {
 if (*this == list_iterator)
 	return false;
-Depth_Iterator
-	position (*this);
-try
-	{
-	while (++position != list_iterator) ;
-	return true;
-	}
+try {return depth_position () < list_position (list_iterator);}
 catch (Out_of_Range exception) {return false;}
 }
 
 /*******************************************************************************
 	Utility functions
 */
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+bool
+parameter_less
+	(
+	const Parameter*	parameter_1,
+	const Parameter*	parameter_2
+	)
+{return *parameter_1 < *parameter_2;}
+
+
 void
-sort
+sort_parameters
 	(
 	Aggregate::iterator	first,
-	Aggregate::iterator	last
+	Aggregate::iterator	last,
+	unsigned int		threads
 	)
 {
 if (first == last)
-	{
 	return;
-	}
 Aggregate::Base_iterator
-	bubble,
-	this_parameter;
-Parameter
-	*parameter;
-for (--last;
-	 first != last;
-	 --last)
-	{
-	bubble = first;
-	do
-		{
-		this_parameter = bubble;
-		 ++bubble;
-		if (**bubble < **this_parameter)
-			{
-			//	Swap Value pointers.
-			parameter = *bubble;
-			*bubble = *this_parameter;
-			*this_parameter = parameter;
-			}
-		}
-		while (bubble != last);
-	}
+	begin = first,
+	end = last;
+if (threads == 1)
+	std::stable_sort (begin, end, parameter_less);
+else
+	parallel_stable_sort (begin, end, parameter_less, threads);
+//	The Parameter pointers were moved without the Vectal methods.
+if (first->parent ())
+	first->parent ()->invalidate_index ();
+}
+
+
+void
+sort_hierarchy
+	(
+	Aggregate&	aggregate
+	)
+{
+sort_parameters (aggregate.begin (), aggregate.end (), 1);
+for (Aggregate::iterator
+		parameter = aggregate.begin ();
+		parameter != aggregate.end ();
+		++parameter)
+	if (parameter->is_Aggregate ())
+		sort_hierarchy (static_cast<Aggregate&>(*parameter));
 }
 
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+
+void
+sort
+	(
+	Aggregate::iterator	first,
+	Aggregate::iterator	last
+	)
+{sort_parameters (first, last, 1);}
+
+
+void
+parallel_sort
+	(
+	Aggregate::iterator	first,
+	Aggregate::iterator	last,
+	unsigned int		threads
+	)
+{sort_parameters (first, last, threads);}
+
+
 void
 sort
 	(
@@ -1878,9 +3576,7 @@ sort (static_cast<Aggregate::iterator>(first),
 while (first != last)
 	{
 	if (first->is_Aggregate ())
-		sort (
-			(static_cast<Aggregate&>(*first)).begin (),
-			(static_cast<Aggregate&>(*first)).end ());
+		sort_hierarchy (static_cast<Aggregate&>(*first));
 	++first;
 	}
 }
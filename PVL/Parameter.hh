@@ -25,10 +25,13 @@ CVS ID: Parameter.hh,v 1.56 2014/04/16 02:49:06 castalia Exp
 
 #include	"PVL/Value.hh"
 #include	"PVL/Vectal.hh"
+#include	"PVL/Small_Stack.hh"
 
 #include	<string>
 #include	<iostream>	//	Needed for default cin and cout arguments.
 #include	<iterator>
+#include	<atomic>
+#include	<cstdint>
 
 
 namespace idaeim
@@ -42,6 +45,8 @@ class Assignment;
 class Aggregate;
 class Value;
 class Integer;
+class Query;
+class Frozen;
 
 /*=*****************************************************************************
 	Parameter
@@ -184,6 +189,16 @@ explicit Parameter (const std::string& name = "");
 */
 Parameter (const Parameter& parameter);
 
+/**	Parameter move constructor.
+
+	The name and comment strings are moved. The parent of the moved
+	Parameter will not be inherited; i.e. the new Parameter will have no
+	parent.
+
+	@param	parameter	The Parameter to be moved.
+*/
+Parameter (Parameter&& parameter) noexcept;
+
 /**	Creates a Parameter clone of the Parameter.
 
 	This method is required by the Aggregate Vectal.
@@ -194,6 +209,27 @@ virtual Parameter* clone () const = 0;
 virtual ~Parameter ()
 	{}
 
+/**	Allocates memory for a Parameter.
+
+	The memory is obtained from the {@link Arena::current() current
+	Arena}, if there is one, or the heap.
+
+	@param	size	The size of the Parameter object.
+	@return	A pointer to the memory for the Parameter.
+	@see	Arena::allocate_node(std::size_t)
+*/
+static void* operator new (std::size_t size)
+	{return Arena::allocate_node (size);}
+
+/**	Releases the memory for a Parameter.
+
+	@param	parameter	A pointer to the memory for the Parameter.
+	@param	size	The size of the Parameter object.
+	@see	Arena::release_node(void*, std::size_t)
+*/
+static void operator delete (void* parameter, std::size_t size)
+	{Arena::release_node (parameter, size);}
+
 /*==============================================================================
 	Accessors
 */
@@ -206,13 +242,13 @@ protected:
 Aggregate			*Parent;
 
 //!	The Parameter name.
-std::string			Name;
+Symbol				Name;
 
-//!	Delimter character for pathname components.
-static char			Path_Delimiter;
+//!	Process wide delimter character for pathname components.
+static std::atomic<char>	Path_Delimiter;
 
-//!	Default case sensitivity.
-static bool			Case_Sensitive;
+//!	Process wide default case sensitivity.
+static std::atomic<bool>	Case_Sensitive;
 
 public:
 
@@ -228,8 +264,24 @@ std::string name () const
 	@param	name	The name string.
 	@return	This Parameter.
 */
-Parameter& name (const std::string& name)
-	{Name = name; return *this;}
+Parameter& name (const std::string& name);
+
+/**	Gets the name Symbol of the Parameter.
+
+	@return	A reference to the Symbol for the name of the Parameter.
+*/
+const Symbol& name_symbol () const
+	{return Name;}
+
+/**	Sets the Parameter's name from a Symbol.
+
+	If the Symbol is {@link Symbol::intern(const std::string&) interned}
+	the Parameter name will be too.
+
+	@param	name	The name Symbol.
+	@return	This Parameter.
+*/
+Parameter& name (const Symbol& name);
 
 /**	Gets the Parameter's parent.
 
@@ -345,6 +397,11 @@ std::string pathname_to (const Parameter& root) const
 	preceded by a #path_delimiter character. The basic form of a relative
 	pathname is a simple name that contains no #path_delimiter character.
 
+	The pathname is matched from its end, one name at a time, against
+	the names of this Parameter and its parents. No pathname string is
+	constructed for the Parameter and case is folded character by
+	character, so no memory is allocated.
+
 	@param	pathname	The pathname string to be matched.
 	@param	case_sensitive	true if case sensitive string matching is
 		to be applied; false otherwise.
@@ -356,7 +413,7 @@ std::string pathname_to (const Parameter& root) const
 */
 bool at_pathname
 	(
-	std::string			pathname,
+	const std::string&	pathname,
 	bool				case_sensitive,
 	const Parameter		*root = NULL
 	) const;
@@ -374,7 +431,7 @@ bool at_pathname
 */
 bool at_pathname
 	(
-	std::string			pathname,
+	const std::string&	pathname,
 	bool				case_sensitive,
 	const Parameter&	root
 	) const
@@ -392,19 +449,21 @@ bool at_pathname
 	@see	at_pathname(string, bool, Parameter*)
 */
 bool at_pathname (std::string pathname) const
-	{return at_pathname (pathname, Case_Sensitive);}
+	{return at_pathname (pathname, case_sensitive ());}
 
 /**	Gets the current Path_Name delimiter.
 
-	@return	The delimiter char used for constructing pathnames.
+	@return	The delimiter char used for constructing pathnames. This is
+		the delimiter of the current thread's {@link Conventions}, if
+		any, or the process wide delimiter.
 */
-static char path_delimiter ()
-	{return Path_Delimiter;}
+static char path_delimiter ();
 
 /**	Sets the pathname delimiter.
 
-	<b>Note</b>: The delimiter is a static class variable that applies
-	to all Parameters.
+	<b>Note</b>: The delimiter applies to all Parameters. If a {@link
+	Conventions} scope exists for the current thread only the delimiter
+	of the scope is set; otherwise the process wide delimiter is set.
 
 	@param	delimiter	The delimiter char.
 	@return	The previous delimiter character.
@@ -414,19 +473,79 @@ static char path_delimiter (const char delimiter);
 /**	Gets the default case sensitivity state.
 
 	@return	true, if the default state is case sensitive; false otherwise.
+		This is the state of the current thread's {@link Conventions},
+		if any, or the process wide state.
 	@see	case_sensitive(bool)
 */
-static bool case_sensitive ()
-	{return Case_Sensitive;}
+static bool case_sensitive ();
 
 /**	Sets the default case sensitivity state.
 
+	If a {@link Conventions} scope exists for the current thread only
+	the state of the scope is set; otherwise the process wide state is
+	set.
+
 	@param	enable	true, if the default state is case sensitive; false
 		otherwise.
 	@return	The previous case sensitive state.
 */
 static bool case_sensitive (bool enable);
 
+/**	A <i>Conventions</i> scope provides the pathname delimiter and
+	default case sensitivity for the current thread while the scope
+	exists.
+
+	Without a Conventions scope the process wide settings apply to all
+	threads. While a Conventions scope exists the {@link
+	path_delimiter() path_delimiter} and {@link case_sensitive()
+	case_sensitive} functions get, and set, the settings of the scope;
+	other threads are not affected. Thus threads that use different
+	conventions may process Parameters at the same time without any
+	synchronization.
+
+	Scopes nest: when a Conventions scope is destroyed the settings
+	that applied when it was constructed apply again.
+
+	The {@link Aggregate::indexed(bool) pathname index} of an Aggregate
+	keeps separate tables for each pathname delimiter, so threads that
+	use different delimiters may search the same indexed Aggregate at
+	the same time. The index is case insensitive; the case sensitivity
+	of each thread is applied to the candidates it provides.
+*/
+class Conventions
+{
+public:
+/**	Provides the current settings for this thread.
+
+	The scope starts with the settings that apply when it is
+	constructed.
+*/
+Conventions ();
+
+/**	Provides specific settings for this thread.
+
+	@param	delimiter	The pathname delimiter character.
+	@param	case_sensitive	The default case sensitivity state.
+*/
+Conventions (char delimiter, bool case_sensitive);
+
+//!	Restores the previous settings.
+~Conventions ();
+
+private:
+friend class Parameter;
+
+Conventions (const Conventions&);
+Conventions& operator= (const Conventions&);
+
+char
+	Delimiter;
+bool
+	Case_Sensitive;
+Conventions
+	*Previous;
+};
+
 /*------------------------------------------------------------------------------
 	Comment
 */
@@ -597,6 +716,20 @@ virtual const Parameter& operator[] (unsigned int index) const;
 */
 virtual Parameter& operator= (const Parameter& parameter) = 0;
 
+/**	Moves another Parameter into this Parameter.
+
+	The same as {@link operator=(const Parameter&) assignment} except
+	that the contents of the assigned Parameter - the Value of an
+	Assignment, or the Parameter list of an Aggregate - are taken over
+	instead of being cloned.
+
+	@param	parameter	The Parameter to be moved.
+	@return	This Parameter.
+	@throws Invalid_Argument	If the Parameter to be moved is not
+		of the same implementing class as this Parameter.
+*/
+virtual Parameter& operator= (Parameter&& parameter) = 0;
+
 /**	Assigns a Value to this Parameter.
 
 	The current Value is deleted and the assigned Value is cloned in
@@ -676,6 +809,101 @@ bool operator<= (const Parameter& parameter) const
 bool operator>= (const Parameter& parameter) const
 	{return compare (parameter) >= 0;}
 
+//	Structural hash
+
+/**	Gets the structural hash of this Parameter.
+
+	The hash is a stable digest of the logical content of the
+	Parameter: its name, its Type, and either its Value - the type,
+	units and datum of the Value and of any Values it contains - or the
+	structural hashes of the Parameters it contains, in order. The
+	comment, syntax modes and the base, digits and format of Values are
+	presentation details that are not included. The Value of a TOKEN
+	is not included, consistent with {@link compare(const Parameter&)
+	const compare}. The same content always produces the same hash,
+	from one process to the next.
+
+	The hash is computed when it is first needed and saved. The saved
+	hash of a Parameter, and of each Aggregate that contains it, is
+	discarded when the Parameter is changed by any of its methods, when
+	the Parameter list of an Aggregate is changed through its Vectal
+	interface, or when the Value of an Assignment - or any Value that it
+	contains - is changed through the {@link Assignment::value() value}
+	reference; each Value is linked to the Assignment that {@link
+	Value::owner() owns} it. However, if Parameter pointers are moved
+	about directly in the underlying vector of an Aggregate, or Value
+	pointers in the vector of an Array, {@link invalidate_hash()
+	invalidate_hash} must be used.
+
+	@return	The structural hash of this Parameter. This is never zero.
+	@see	equivalent(const Parameter&) const
+*/
+std::uint64_t structural_hash () const;
+
+/**	Discards the saved structural hash of this Parameter and of each
+	Aggregate that contains it.
+
+	Each discarded hash is computed again when it is next needed.
+
+	@see	structural_hash()
+*/
+void invalidate_hash ();
+
+/**	Tests if this Parameter is logically equivalent to another Parameter.
+
+	When the {@link structural_hash() structural hashes} of the
+	Parameters differ they are not equivalent; otherwise they are
+	equivalent if they {@link compare(const Parameter&) const compare}
+	equal. Since the hashes are saved, rejecting Parameter hierarchies
+	that differ is usually much faster than comparing them.
+
+	<b>N.B.</b>: The hash distinguishes some differences that compare
+	ignores: Aggregates of different Types, Values of different types
+	or units, and numeric Values that differ by less than the comparison
+	accuracy. Parameters that differ in these ways are not equivalent
+	even though they compare equal.
+
+	@param	parameter	The Parameter to test against.
+	@return	true if the Parameters are equivalent; false otherwise.
+*/
+bool equivalent (const Parameter& parameter) const;
+
+protected:
+
+//!	The saved structural hash (0 if none).
+mutable std::atomic<std::uint64_t>	Structural_Hash;
+
+public:
+
+//	Memory usage
+
+/**	Gets the memory used by the Parameter.
+
+	The Parameter node and its name and comment are included, as is
+	the Value of an Assignment. For an Aggregate the Parameter list,
+	the Parameters it contains and its pathname index are included as
+	well. The allocation overhead of this Parameter node itself is not
+	included since the Parameter need not have been allocated by new.
+
+	@return	A Memory_Usage for the Parameter.
+	@see	add_memory_usage(Memory_Usage&) const
+*/
+Memory_Usage memory_usage () const
+	{Memory_Usage usage; add_memory_usage (usage); return usage;}
+
+/**	Adds the memory used by the Parameter to a Memory_Usage.
+
+	The Parameter name and comment are added here; each type of
+	Parameter adds its node and content.
+
+	@param	usage	The Memory_Usage to which the Parameter memory is
+		added.
+	@see	memory_usage() const
+*/
+virtual void add_memory_usage (Memory_Usage& usage) const
+	{usage.Strings += Name.memory_usage ()
+		+ Memory_Usage::string_size (Comment);}
+
 /*==============================================================================
 	I/O
 */
@@ -988,6 +1216,16 @@ explicit Assignment (const std::string name = "");
 */
 Assignment (const Assignment& assignment);
 
+/**	Move constructor.
+
+	The Value of the moved Assignment is taken over, not cloned. The
+	moved Assignment is left without a Value; it is given a new
+	#Default_Value if its {@link value() const value} is used again.
+
+	@param	assignment	The Assignment Parameter to be moved.
+*/
+Assignment (Assignment&& assignment) noexcept;
+
 /**	Copy constructor from a Parameter.
 
 	@param	parameter	The Parameter to be copied.
@@ -1023,6 +1261,17 @@ Assignment (Parser& parser, const std::string name = "");
 Assignment* clone () const
 	{return new Assignment (*this);}
 
+/**	Adds the memory used by this Assignment to a Memory_Usage.
+
+	The Assignment node and its Value, including the allocation
+	overhead of the Value node, are added.
+
+	@param	usage	The Memory_Usage to which the Assignment memory is
+		added.
+	@see	Parameter::memory_usage() const
+*/
+void add_memory_usage (Memory_Usage& usage) const;
+
 //!	Destructor: deletes the Assignment's Value.
 ~Assignment ()
 	{delete The_Value;}
@@ -1099,10 +1348,30 @@ std::string type_name () const
 
 /**	Gets the Value of the Assignment.
 
+	The Value is {@link Value::owner() owned} by the Assignment:
+	changes made to it through the reference discard the {@link
+	structural_hash() structural hash} of the Assignment.
+
+	An Assignment that has been moved is given a new #Default_Value.
+
 	@return	A reference to the Assignment's Value.
 */
 Value& value () const
-	{return *The_Value;}
+	{return The_Value ? *The_Value : default_value ();}
+
+/**	Sets the Value of the Assignment.
+
+	<b>Note</b>: The Value is not cloned; the Value pointer replaces
+	the Assignment's current Value, which is deleted, and the
+	Assignment becomes the {@link Value::owner() owner} of the Value.
+	The Type specification is set to ASSIGNMENT.
+
+	@param	value	A pointer to the Value to be set. If NULL nothing
+		is done.
+	@return	This Assignment.
+	@see	operator=(const Value&)
+*/
+Assignment& value (Value* value);
 
 //	Operators
 
@@ -1123,6 +1392,36 @@ Value& value () const
 */
 Assignment& operator= (const Parameter& parameter);
 
+/**	Assigns an Assignment to this Assignment.
+
+	@param	assignment	The Assignment to be assigned.
+	@return	This Assignment.
+	@see	operator=(const Parameter&)
+*/
+Assignment& operator= (const Assignment& assignment)
+	{return operator= (static_cast<const Parameter&>(assignment));}
+
+/**	Moves a Parameter into this Assignment.
+
+	The same as {@link operator=(const Parameter&) assignment} except
+	that the Value of the moved Assignment is exchanged with this
+	Assignment's Value instead of being cloned.
+
+	@param	parameter	The Parameter to be moved.
+	@return	This Assignment.
+	@throws	Invalid_Argument if the Parameter is not an Assignment.
+*/
+Assignment& operator= (Parameter&& parameter);
+
+/**	Moves an Assignment into this Assignment.
+
+	@param	assignment	The Assignment to be moved.
+	@return	This Assignment.
+	@see	operator=(Parameter&&)
+*/
+Assignment& operator= (Assignment&& assignment) noexcept
+	{return operator= (static_cast<Parameter&&>(assignment));}
+
 /**	Assigns a Value to this Assignment.
 
 	The current Value is deleted and the new value is cloned in
@@ -1199,8 +1498,12 @@ void read (Parser& parser);
 //..............................................................................
 private:
 
-Value*		The_Value;
-Type		Subtype;
+//	NULL after the Assignment has been moved.
+mutable Value*	The_Value;
+Type			Subtype;
+
+//	Gives an Assignment that has been moved a new Default_Value.
+Value& default_value () const;
 
 };		//	End of Assignment class.
 
@@ -1276,6 +1579,16 @@ explicit Aggregate (const std::string name = "",
 */
 Aggregate (const Aggregate& aggregate);
 
+/**	Move constructor.
+
+	The Parameter list of the moved Aggregate is {@link
+	move_in(Aggregate&) moved in}; it is not cloned. The moved
+	Aggregate is left empty.
+
+	@param	aggregate	The Aggregate to move.
+*/
+Aggregate (Aggregate&& aggregate);
+
 /**	Copy constructor from a Parameter.
 
 	If the Parameter being copied is an Aggregate, it is assigned to
@@ -1320,6 +1633,20 @@ Aggregate (Parser& parser, const std::string name = "");
 Aggregate* clone () const
 	{return new Aggregate (*this);}
 
+/**	Adds the memory used by this Aggregate to a Memory_Usage.
+
+	The Aggregate node, its Parameter list - the occupied pointers and
+	any unused capacity - and its pathname index and depth offsets
+	table, if they have been built, are added along with each Parameter
+	in the list, including the allocation overhead of the Parameter
+	node.
+
+	@param	usage	The Memory_Usage to which the Aggregate memory is
+		added.
+	@see	Parameter::memory_usage() const
+*/
+void add_memory_usage (Memory_Usage& usage) const;
+
 //	Subtype
 
 /**	Test if this is an Aggregate.
@@ -1482,6 +1809,36 @@ Aggregate& operator= (const Aggregate& parameter)
 Aggregate& operator= (const Assignment& parameter)
 	{return operator= (static_cast<const Parameter&>(parameter));}
 
+/**	Moves a Parameter into this Aggregate.
+
+	The same as {@link operator=(const Parameter&) assignment} except
+	that the Parameter list of a moved Aggregate is {@link
+	move_in(Aggregate&) moved in}, and a moved Assignment is appended
+	to the Parameter list, without cloning.
+
+	@param	parameter	The Parameter to be moved.
+	@return	This Aggregate.
+*/
+Aggregate& operator= (Parameter&& parameter);
+
+/**	Moves an Aggregate into this Aggregate.
+
+	@param	parameter	The Aggregate to be moved.
+	@return	This Aggregate.
+	@see	operator=(Parameter&&)
+*/
+Aggregate& operator= (Aggregate&& parameter)
+	{return operator= (static_cast<Parameter&&>(parameter));}
+
+/**	Moves an Assignment into this Aggregate.
+
+	@param	parameter	The Assignment to be moved.
+	@return	This Aggregate.
+	@see	operator=(Parameter&&)
+*/
+Aggregate& operator= (Assignment&& parameter)
+	{return operator= (static_cast<Parameter&&>(parameter));}
+
 /**	An Aggregate doesn't have a Value, so this always throws an
 	Invalid_Argument exception.
 
@@ -1568,6 +1925,117 @@ find
 	)
 	const;
 
+class Find_Iterator;
+class Find_Range;
+
+/**	Find all the Parameters at a pathname.
+
+	The Parameters are matched using the same criteria as {@link
+	find(const std::string&, bool, int, Type) find}, in the same order.
+	However, all of the matching Parameters are obtained from a single
+	traversal of the Aggregate hierarchy rather than restarting the
+	search for each one. The traversal is lazy: each match is only
+	sought when the Find_Iterator is advanced to it. If the {@link
+	indexed(bool) pathname index} is enabled the candidates are
+	obtained directly from the index.
+
+	<b>N.B.</b>: Like other container iterators, the iterators of the
+	Find_Range are invalidated by any change to the Aggregate hierarchy.
+
+	@param	pathname	The pathname of the Parameters to find.
+	@param	case_sensitive	If true, the name search is case
+		sensitive; case insensitive otherwise.
+	@param	type		A Type code that specifies the type of Parameter
+		that is to be selected. By default any Type (ASSIGNMENT or
+		AGGREGATE) will be acceptable.
+	@return	A Find_Range of the matching Parameters.
+*/
+Find_Range
+find_all
+	(
+	const std::string&				pathname,
+	bool							case_sensitive = false,
+	idaeim::PVL::Parameter::Type	type = (Type)(ASSIGNMENT | AGGREGATE)
+	)
+	const;
+
+/**	Count the Parameters at a pathname.
+
+	@param	pathname	The pathname of the Parameters to count.
+	@param	case_sensitive	If true, the name search is case
+		sensitive; case insensitive otherwise.
+	@param	type		A Type code that specifies the type of Parameter
+		that is to be counted. By default any Type (ASSIGNMENT or
+		AGGREGATE) will be counted.
+	@return	The number of Parameters that {@link find_all(const
+		std::string&, bool, Type) find_all} would obtain.
+*/
+int
+find_count
+	(
+	const std::string&				pathname,
+	bool							case_sensitive = false,
+	idaeim::PVL::Parameter::Type	type = (Type)(ASSIGNMENT | AGGREGATE)
+	)
+	const;
+
+/**	Enable or disable the pathname index.
+
+	When the index is enabled, {@link find(const std::string&, bool,
+	int, Type) find} - and thus {@link select(Selection*) select} - no
+	longer search the entire Aggregate hierarchy for each pathname.
+	Instead a hash index of the Parameters by their absolute pathnames
+	and by their names is used to obtain the candidate Parameters
+	directly.
+
+	The index is built on demand by the first find after it has been
+	enabled, and again by the first find after the Aggregate hierarchy
+	has changed. Changes made through the Vectal interface methods of
+	any Aggregate in the hierarchy, and changes to the name of any
+	Parameter in the hierarchy, are detected automatically. However,
+	if Parameter pointers are moved about directly in the underlying
+	vector of any Aggregate in the hierarchy, {@link invalidate_index()
+	invalidate_index} must be used.
+
+	By default the index is disabled.
+
+	@param	enable	true if the pathname index is to be used; false
+		otherwise.
+	@return	This Aggregate.
+*/
+Aggregate& indexed (bool enable);
+
+/**	Tests if the pathname index is enabled.
+
+	@return	true if the pathname index is enabled; false otherwise.
+	@see	indexed(bool)
+*/
+bool indexed () const
+	{return Index != NULL;}
+
+/**	Marks the pathname index of this Aggregate, and of each Aggregate
+	that contains it, as out of date.
+
+	Each out of date index is rebuilt when it is next needed. The
+	{@link invalidate_hash() structural hashes} of the same Aggregates
+	are discarded as well.
+
+	@see	indexed(bool)
+*/
+void invalidate_index ();
+
+/**	Makes an immutable snapshot of the Aggregate hierarchy.
+
+	The snapshot is a compact copy of this Aggregate, with its own
+	pathname index, that may be read by any number of threads at the
+	same time without locking. This Aggregate is not changed and
+	remains independent of the snapshot.
+
+	@return	A Frozen snapshot of this Aggregate.
+	@see	Frozen
+*/
+Frozen freeze () const;
+
 //	Select
 
 /**	A <i>Selection</i> is used to map the value of a named parameter to
@@ -1843,6 +2311,11 @@ Selection (const std::string& pathname, Value::String_type& variable,
 	Variables, to obtain values that may have different data types
 	associated with the same Parameter pathname.
 
+	All of the Selection Pathnames are matched together in a single
+	traversal of the Aggregate hierarchy, or are looked up in the
+	{@link indexed(bool) pathname index} if it is enabled. A Selection
+	with a NULL Variable is ignored.
+
 	@param	selections	An array of Selection mappings.
 		<b>N.B.</b>: The Selection array must be terminated with a
 		Selection having a Type of zero. This can be done by appending a
@@ -1924,8 +2397,15 @@ Aggregate& copy_in (const Aggregate& aggregate);
 	the end of this Aggregate's Parameter list. As a result the source
 	Aggregate will be emptied.
 
+	The Parameter pointers are moved as a single range, without
+	copying or reallocation when this Aggregate's list is empty, and
+	the {@link total_size() total sizes} are adjusted once for the
+	entire list. Moving an Aggregate into itself has no effect.
+
 	@param	aggregate	The source Aggregate.
 	@return	This Aggregate.
+	@throws Invalid_Argument If a Parameter to be moved is this
+		Aggregate or one of its parents. Neither Aggregate is changed.
 	@see	add(const Parameter*)
 */
 Aggregate& move_in (Aggregate& aggregate);
@@ -2003,14 +2483,32 @@ void entering (Parameter* parameter);
 */
 void removing (Parameter* parameter);
 
-/**	Counts the number of Parameters in the Aggregate's Parameter list
+/**	Removes all of the Parameter pointers, but does not destroy the
+	Parameters.
+
+	This hides the Vectal's method so that the parent of each
+	Parameter is reset to NULL and the {@link total_size() total size}
+	of this Aggregate, and of each Aggregate that contains it, is
+	reduced accordingly.
+
+	<b>Warning</b>: It is the user's responsibility to make sure that
+	the Parameters are properly managed to prevent a memory leak.
+*/
+void wipe ();
+
+/**	Gets the number of Parameters in the Aggregate's Parameter list
 	and, recursively, the number of Parameters in the Parameter list
 	of each Aggregate in the list.
 
+	The total is maintained as Parameters enter and leave the
+	Parameter list of any Aggregate in the hierarchy, so it is
+	obtained in constant time.
+
 	@return	The accumulated total number of Parameters enclosed by
 		this Aggregate.
 */
-size_type total_size ();
+size_type total_size () const
+	{return Total_Size;}
 
 /*==============================================================================
 	Depth_Iterator
@@ -2039,15 +2537,41 @@ size_type total_size ();
 	iteration will not go beyond the initial begin position of the
 	root Aggregate.
 
-	Random-access operators are also provided. But because they are not
-	truely random access, and do not operate in constant time, the
-	Depth_Iterator is tagged as only bidirectional.
+	Random-access operators are also provided. Each Aggregate maintains
+	the {@link total_size() total size} of its hierarchy, and the
+	depth-first offsets of its Parameters are kept on demand, so a
+	Depth_Iterator is positioned, and the distance between positions is
+	measured, by descending the Aggregate hierarchy rather than by
+	stepping over each Parameter. These operations take time
+	proportional to the depth of the position times the logarithm of
+	the size of the Parameter lists along its path.
+
+	The Depth_Iterator remembers its position in each enclosing
+	Parameter list on a stack that holds the positions of the first few
+	levels within the Depth_Iterator itself, so creating, copying and
+	moving a Depth_Iterator over a typical Aggregate hierarchy does not
+	allocate memory. Alternatively, a Depth_Iterator may be constructed
+	for {@link Depth_Iterator(const Aggregate&, bool) parent
+	traversal}, in which case it keeps no stack at all, only the
+	depth-first offset of the current Parameter list: each time it
+	ascends from an Aggregate it finds the position of the Aggregate in
+	its parent's Parameter list from the depth-first offset tables of
+	the Aggregates that contain it. This is the better choice when
+	Depth_Iterators are copied much more often than they ascend out of
+	Aggregates.
 */
 class Depth_Iterator
-:	public std::iterator<std::bidirectional_iterator_tag, Parameter>
+:	public std::iterator<std::random_access_iterator_tag, Parameter>
 {
 public:
 
+/**	The stack of positions in the enclosing Parameter lists.
+
+	Up to eight levels are held within the Depth_Iterator; only a
+	deeper hierarchy causes an allocation.
+*/
+typedef Small_Stack<Aggregate::iterator, 8>	Position_Stack;
+
 //	Constructors
 
 /**	Constructs a Depth_Iterator without a root Aggregate.
@@ -2056,7 +2580,10 @@ public:
 	iterator.
 */
 Depth_Iterator ()
-	:	Current_Aggregate (NULL)
+	:	Current_Aggregate (NULL),
+		Depth (0),
+		Base (0),
+		Parent_Traversal (false)
 	{}
 
 /**	Constructs a Depth_Iterator for an Aggregate.
@@ -2069,6 +2596,27 @@ Depth_Iterator ()
 */
 explicit Depth_Iterator (const Aggregate& aggregate);
 
+/**	Constructs a Depth_Iterator for an Aggregate with a choice of
+	traversal mode.
+
+	With parent traversal the Depth_Iterator keeps no stack of
+	positions in the enclosing Parameter lists. Instead, it keeps the
+	depth-first offset of the current Parameter list from the root, and
+	when it ascends out of an Aggregate it follows that offset down from
+	the root, through the depth-first offset tables of the enclosing
+	Aggregates, to the position
+	of the Aggregate in its parent's Parameter list. Each ascent thus
+	takes time proportional to the depth of the Aggregate, not to the
+	length of its parent's list. The positions that the Depth_Iterator
+	moves through are the same in either mode.
+
+	@param	aggregate	The root Aggregate.
+	@param	parent_traversal	true if the Depth_Iterator is to
+		traverse the hierarchy by parent pointers; false if it is to
+		use a stack of positions.
+*/
+Depth_Iterator (const Aggregate& aggregate, bool parent_traversal);
+
 /**	Constructs a Depth_Iterator from a normal Parameter_List iterator.
 
 	<b>Warning</b>: The iterator must be valid; i.e. it must refer to a
@@ -2100,6 +2648,24 @@ Aggregate* root () const;
 Aggregate* aggregate () const
 	{return Current_Aggregate;}
 
+/**	Gets the depth of the current position.
+
+	@return	The number of Aggregates between the root Aggregate and
+		the current Aggregate context. This is zero when the current
+		position is in the root Aggregate's Parameter list.
+*/
+unsigned int depth () const
+	{return Depth;}
+
+/**	Tests if this Depth_Iterator uses parent traversal.
+
+	@return	true if parent pointers are used to ascend the hierarchy;
+		false if a stack of positions is used.
+	@see	Depth_Iterator(const Aggregate&, bool)
+*/
+bool parent_traversal () const
+	{return Parent_Traversal;}
+
 /**	Gets a Depth_Iterator positioned at the end of the traversal
 	for this Depth_Iterator.
 
@@ -2128,13 +2694,11 @@ Depth_Iterator end_depth () const;
 	to the next valid position.
 
 	When the Depth_Iterator and list iterator are not positioned in
-	the same Aggregate, then a search is made for the list iterator
-	position within the scope of the Depth_Iterator. First a search
-	is made from the current Depth_Iterator position towards the
-	beginning of its scope. If this fails a search is made
-	from the current Depth_Iterator position towards the end of its
-	scope. The current position of the Depth_Iterator becomes list
-	iterator position if it is found.
+	the same Aggregate, then the list iterator position is located
+	within the scope of the Depth_Iterator by ascending from the
+	Aggregate containing it to the root Aggregate. The current position
+	of the Depth_Iterator becomes list iterator position if it is
+	found.
 
 	@param	list_iterator	The Parameter_List iterator position to be
 		assigned to this Depth_Iterator.
@@ -2316,16 +2880,20 @@ Parameter&      operator[] (int offset) const;
 
 /**	Relocates the current position by the specified distance.
 
-	The Depth_Iterator is incremented for a positive distance,
-	or decremented for a negative distance, repeatedly the
-	absolute amount of the distance.
-
-	<b>Note</b>: This is a random-access iterator operator
-	that does not occur in constant time.
+	The new position is the same as would be reached by incrementing
+	the Depth_Iterator for a positive distance, or decrementing it for
+	a negative distance, the absolute amount of the distance. However,
+	the position is found by descending from the root Aggregate to the
+	Parameter at the new depth-first offset.
 
 	@param	distance	The number of increment (positive) or
 		decrement (negative) operations to apply.
 	@return	This Depth_Iterator.
+	@throws	Out_of_Range	If the new position would be before the
+		beginning or beyond the end of the root Aggregate. The
+		Depth_Iterator is not moved.
+	@throws	Error	If the Depth_Iterator is invalid (doesn't have a
+		root Aggregate).
 	@see	operator++()
 	@see	operator--()
 */
@@ -2374,12 +2942,9 @@ int operator- (const Depth_Iterator& depth_iterator) const;
 /**	Get the distance between this Depth_Iterator and an
 	Aggregate list iterator.
 
-	A search is made for the list iterator position in the
-	scope of this Depth_Iterator; first backwards (positive
-	distance), and then forwards (negative distance).
-
-	<b>Note</b>: This is a random-access iterator operator
-	that does not occur in constant time.
+	The depth-first offset of the list iterator position is found by
+	ascending from the Aggregate containing it to the root Aggregate of
+	this Depth_Iterator.
 
 	@param	list_iterator	An Aggregate::iterator position
 		to find.
@@ -2457,13 +3022,11 @@ bool operator<  (const Depth_Iterator& depth_iterator) const;
 /**	Tests if the current position of this Depth_Iterator is
 	less than the position of an Aggregate list iterator.
 
-	A copy of this Depth_Iterator is incremented forward searching
-	for the list iterator position.
+	The depth-first offsets of the two positions are compared.
 
-	<b>Note</b>: This is a random-access iterator operator that does
-	not occur in constant time. This is always more, often much more,
-	expensive that the == (or !=) test. The latter should be used
-	whenever possible (e.g. in loop conditions).
+	<b>Note</b>: This is always more expensive that the == (or !=)
+	test. The latter should be used whenever possible (e.g. in loop
+	conditions).
 
 	@param	list_iterator	The Aggregate::iterator to compare against.
 	@return	true if the list_iterator position is found; false otherwise.
@@ -2539,14 +3102,191 @@ bool operator>= (const Aggregate::iterator& list_iterator) const
 //..............................................................................
 private:
 
+//	The depth-first offset of the current position from the root.
+size_type depth_position () const;
+
+//	Moves to a depth-first offset from the root.
+void depth_position (size_type position);
+
+//	The depth-first offset of a list iterator position from the root.
+size_type list_position (const Aggregate::iterator& list_iterator) const;
+
+//	Descends into the Aggregate at the current position.
+void descend ();
+
+//	Ascends to the position of the current Aggregate in its parent.
+void ascend (const char* operation);
+
 Aggregate::iterator
 	Current_Position;
 Aggregate
 	*Current_Aggregate;
-std::vector<Aggregate::iterator>
+Position_Stack
 	Previous_Position;
+unsigned int
+	Depth;
+//	With parent traversal, the depth-first offset of the current list.
+size_type
+	Base;
+bool
+	Parent_Traversal;
 };		//	End of Depth_Iterator class.
 
+/*==============================================================================
+	Find_Iterator
+*/
+/**	A <i>Find_Iterator</i> is a forward iterator over the Parameters
+	that match a {@link find_all(const std::string&, bool, Type)
+	find_all} pathname.
+
+	Each increment advances to the next matching Parameter. A
+	default-constructed Find_Iterator is the end iterator.
+*/
+class Find_Iterator
+:	public std::iterator<std::forward_iterator_tag, Parameter>
+{
+public:
+
+//	Constructors
+
+/**	Constructs an end Find_Iterator.
+*/
+Find_Iterator ()
+	:	Candidates (NULL),
+		Candidate (0),
+		Current (NULL)
+	{}
+
+//	Accessors
+
+/**	Gets the current Parameter.
+
+	@return	A reference to the Parameter at the current position.
+*/
+Parameter& operator* () const
+	{return *Current;}
+
+/**	Gets the current Parameter.
+
+	@return	A pointer to the Parameter at the current position.
+*/
+Parameter* operator-> () const
+	{return Current;}
+
+//	Operators
+
+/**	Advances to the next matching Parameter.
+
+	@return	This Find_Iterator.
+*/
+Find_Iterator& operator++ ();
+
+/**	Advances to the next matching Parameter.
+
+	@return	A copy of this Find_Iterator before it was advanced.
+*/
+Find_Iterator operator++ (int)
+	{Find_Iterator position (*this); ++*this; return position;}
+
+/**	Tests if this Find_Iterator is at the same Parameter as another.
+
+	@param	find_iterator	The Find_Iterator to compare against.
+	@return	true if both are at the same Parameter, or both are at the
+		end; false otherwise.
+*/
+bool operator== (const Find_Iterator& find_iterator) const
+	{return Current == find_iterator.Current;}
+
+/**	Tests if this Find_Iterator is not at the same Parameter as another.
+
+	@param	find_iterator	The Find_Iterator to compare against.
+	@return	true if the Find_Iterators are at different Parameters;
+		false otherwise.
+*/
+bool operator!= (const Find_Iterator& find_iterator) const
+	{return Current != find_iterator.Current;}
+
+//..............................................................................
+private:
+
+friend class Aggregate;
+
+struct Query;
+
+Find_Iterator (const std::shared_ptr<const Query>& query);
+
+void seek ();
+bool matches (const Parameter* parameter) const;
+
+std::shared_ptr<const Query>
+	Find_Query;
+
+//	Index candidates; NULL when traversing.
+const std::vector<Parameter*>
+	*Candidates;
+std::vector<Parameter*>::size_type
+	Candidate;
+
+//	Traversal position.
+Depth_Iterator
+	Position,
+	End;
+
+//	The current Parameter; NULL at the end.
+Parameter
+	*Current;
+};		//	End of Find_Iterator class.
+
+/*==============================================================================
+	Find_Range
+*/
+/**	A <i>Find_Range</i> is the range of Parameters obtained by {@link
+	find_all(const std::string&, bool, Type) find_all}.
+*/
+class Find_Range
+{
+public:
+
+//!	The iterator of the range.
+typedef Find_Iterator					iterator;
+//!	The iterator of the range.
+typedef Find_Iterator					const_iterator;
+
+/**	Gets the iterator at the first matching Parameter.
+
+	@return	A Find_Iterator at the first matching Parameter, or the end
+		if there is none.
+*/
+Find_Iterator begin () const
+	{return Begin;}
+
+/**	Gets the end iterator.
+
+	@return	The end Find_Iterator.
+*/
+Find_Iterator end () const
+	{return Find_Iterator ();}
+
+/**	Tests if the range is empty.
+
+	@return	true if no Parameter matched; false otherwise.
+*/
+bool empty () const
+	{return Begin == Find_Iterator ();}
+
+//..............................................................................
+private:
+
+friend class Aggregate;
+
+explicit Find_Range (const Find_Iterator& begin)
+	:	Begin (begin)
+	{}
+
+Find_Iterator
+	Begin;
+};		//	End of Find_Range class.
+
 /**	Gets a Depth_Iterator positioned at the beginning of this Aggregate.
 
 	@return	A Depth_Iterator.
@@ -2565,6 +3305,44 @@ private:
 Type		Subtype;
 static Type	Default_Subtype;
 
+//	Pathname index; NULL if disabled.
+struct Pathname_Index;
+Pathname_Index	*Index;
+
+//	Total number of Parameters in the hierarchy.
+size_type		Total_Size;
+
+//	Depth-first Parameter offsets; NULL until needed.
+struct Depth_Offsets;
+mutable std::atomic<Depth_Offsets*>	Offsets;
+
+//	Changes the total size of this Aggregate and those that contain it.
+void total_size_change (size_type amount, bool increase);
+
+//	The depth-first offset of the Parameter at an index.
+size_type depth_offset (size_type index) const;
+
+/*	The index of the Parameter that contains a depth-first offset;
+	the offset is reduced to be relative to the Parameter.
+*/
+size_type depth_index (size_type& offset) const;
+
+//	Builds the depth-first offsets, if they are kept for the list.
+void build_depth_offsets () const;
+
+//	A Frozen snapshot builds its depth-first offsets before it is shared.
+friend class Frozen;
+
+/*	Gets the index list of the Parameters with an uppercase absolute
+	pathname, or with an uppercase last name segment; NULL if the
+	index is disabled.
+*/
+const std::vector<Parameter*>* index_candidates
+	(const std::string& key, bool absolute) const;
+
+//	A Query obtains its candidates from the pathname index.
+friend class Query;
+
 };		//	End of Aggregate class.
 
 /**	Tests if the position of an Aggregate list iterator is less than
@@ -2651,8 +3429,10 @@ std::string pathname_to (const std::string& pathname);
 
 /**	Sorts an Aggregate's list iterator range.
 
-	A bubble sort is applied, in place, using the less than (<)
-	comparison for the Parameters in the interator range [begin, end).
+	A stable merge sort of the Parameter pointers is applied, in place,
+	using the less than (<) comparison for the Parameters in the
+	interator range [begin, end). Parameters that compare equal retain
+	their relative order.
 
 	@param	begin	The Aggregate::iterator for the first Parameter
 		where sorting begins.
@@ -2662,18 +3442,35 @@ std::string pathname_to (const std::string& pathname);
 */
 void sort (Aggregate::iterator begin, Aggregate::iterator end);
 
+/**	Sorts an Aggregate's list iterator range using multiple threads.
+
+	The result is the same as that of {@link sort(Aggregate::iterator,
+	Aggregate::iterator) sort}. Only very large ranges - many thousands
+	of Parameters - are sorted faster.
+
+	@param	begin	The Aggregate::iterator for the first Parameter
+		where sorting begins.
+	@param	end		The Aggregate::iterator for the position after the
+		last Parameter where sorting ends.
+	@param	threads	The maximum number of threads to use. If zero the
+		number of hardware threads is used.
+	@see	parallel_stable_sort(Iterator, Iterator, Less, unsigned int)
+*/
+void parallel_sort (Aggregate::iterator begin, Aggregate::iterator end,
+	unsigned int threads = 0);
+
 /**	Sorts the Parameters in the iterator range, and all Parameters
 	in all Aggregates contained within the range.
 
 	This is a "deep" sort in that not only are the Parameters in the
 	Aggregate of the iterator range sorted, but each Aggregate within
-	the range has all of its Parameters sorted. Each Aggregate has its
-	Parameters sorted independently (Parameters never leave their
-	containing Aggregate). Though the iterator range is defined by a
-	pair of Depth_Iterators, which are used to traverse the entire
-	Aggregate hierarchy, they must both be positioned in the Parameter
-	list of the same Aggregate which thus defines the range of
-	Parameters to be sorted in the starting Aggregate.
+	the range has all of its Parameters sorted, at every depth. Each
+	Aggregate has its Parameters sorted independently (Parameters
+	never leave their containing Aggregate). Though the iterator range
+	is defined by a pair of Depth_Iterators, which are used to traverse
+	the entire Aggregate hierarchy, they must both be positioned in the
+	Parameter list of the same Aggregate which thus defines the range
+	of Parameters to be sorted in the starting Aggregate.
 
 	@param	begin	The Aggregate::Depth_Iterator for the first Parameter
 		where sorting begins.
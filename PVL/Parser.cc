@@ -179,6 +179,9 @@ Parser::Parser
 		Verbatim_Strings	(PARSE_VERBATIM_STRINGS),
 		Commented_Lines		(PARSE_COMMENTED_LINES),
 		String_Continuation (PARSE_STRING_CONTINUATION),
+		Intern_Symbols		(PARSE_INTERN_SYMBOLS),
+		Strip_Comments		(PARSE_STRIP_COMMENTS),
+		Node_Arena			(PARSE_ARENA ? new Arena : NULL),
 		Warnings			(new Warnings_List ())
 {
 //	VMS binary record size filtering.
@@ -214,6 +217,9 @@ Parser::Parser
 		Verbatim_Strings	(PARSE_VERBATIM_STRINGS),
 		Commented_Lines		(PARSE_COMMENTED_LINES),
 		String_Continuation (PARSE_STRING_CONTINUATION),
+		Intern_Symbols		(PARSE_INTERN_SYMBOLS),
+		Strip_Comments		(PARSE_STRIP_COMMENTS),
+		Node_Arena			(PARSE_ARENA ? new Arena : NULL),
 		VMS_records_filter	(NULL),
 		Warnings			(new Warnings_List ())
 {
@@ -229,6 +235,8 @@ clear_warnings ();
 delete Warnings;
 delete VMS_records_filter;
 delete Line_count_filter;
+if (Node_Arena)
+	Node_Arena->release ();
 }
 
 //	Assignment
@@ -245,11 +253,38 @@ if (this != &parser)
 	Verbatim_Strings = parser.Verbatim_Strings;
 	Commented_Lines = parser.Commented_Lines;
 	String_Continuation = parser.String_Continuation;
+	Intern_Symbols = parser.Intern_Symbols;
+	Strip_Comments = parser.Strip_Comments;
+	arena (parser.Node_Arena != NULL);
 	clear_warnings ();
 	}
 return *this;
 }
 
+/*==============================================================================
+	Accessors:
+*/
+Parser&
+Parser::arena
+	(
+	bool	enable
+	)
+{
+if (enable)
+	{
+	if (! Node_Arena)
+		Node_Arena = new Arena;
+	}
+else
+if (Node_Arena)
+	{
+	//	The Arena remains until all of its nodes have been deleted.
+	Node_Arena->release ();
+	Node_Arena = NULL;
+	}
+return *this;
+}
+
 /*==============================================================================
 	PVL Parser
 */
@@ -259,6 +294,8 @@ return *this;
 Parameter*
 Parser::get_parameters ()
 {
+Arena::Scope
+	arena_scope (node_arena ());
 Aggregate
 	*The_Aggregate = new Aggregate (CONTAINER_NAME);
 Parameter
@@ -299,6 +336,8 @@ Parser::add_parameters
 	Aggregate&	The_Aggregate
 	)
 {
+Arena::Scope
+	arena_scope (node_arena ());
 ingest_parameters (The_Aggregate);
 return The_Aggregate;
 }
@@ -376,6 +415,8 @@ Parser::get_parameter
 {
 if (is_empty ())
 	return NULL;
+Arena::Scope
+	arena_scope (node_arena ());
 
 Parameter
 	*The_Parameter = NULL;
@@ -466,6 +507,8 @@ else
 	{
 	The_Parameter = new Assignment (name);
 	}
+if (Intern_Symbols)
+	The_Parameter->name (Symbol::intern (name));
 
 //	Attach the comment.
 The_Parameter->comment (comment);
@@ -495,7 +538,7 @@ if (parameter_type != Parameter::END &&
 		if (The_Parameter->is_Aggregate ())
 			{
 			//	Set the Parameter name to the Value string.
-			The_Parameter->name (*value);
+			The_Parameter->name (symbol (*value));
 			if (! value->is_String ())
 				{
 				//	The Value is inappropriate for an Aggregate.
@@ -544,7 +587,10 @@ if (is_empty ())
 Location
 	location = next_location (),
 	comment_start,
-	comment_end;
+	comment_end,
+	position;
+bool
+	multiline;
 
 //	Accumulate all sequential comments.
 while (true)
@@ -586,8 +632,25 @@ while (true)
 	else
 		location = comment_end + strlen (COMMENT_END_DELIMITERS);
 
-	comment = substring (comment_start, comment_end);
-	if (comment.find_first_of (LINE_BREAK) != EOS)
+	if (Strip_Comments)
+		{
+		//	Check the comment without assembling it.
+		for (multiline = false,
+				position = comment_start;
+			 ! multiline &&
+				position < comment_end &&
+				! is_end (position);
+			 ++position)
+			if (at (position) &&
+				strchr (LINE_BREAK, at (position)))
+				multiline = true;
+		}
+	else
+		{
+		comment = substring (comment_start, comment_end);
+		multiline = comment.find_first_of (LINE_BREAK) != EOS;
+		}
+	if (multiline)
 		{
 		WARNING (new Multiline_Comment
 			(
@@ -603,6 +666,8 @@ while (true)
 		if (Strict)
 			throw *Warnings->back ();
 		}
+	if (Strip_Comments)
+		continue;
 	if (! Verbatim_Strings)
 		//	Clean up the comment String.
 		translate_from_escape_sequences (comment);
@@ -626,6 +691,8 @@ Parser::add_values
 	Array&		The_Array
 	)
 {
+Arena::Scope
+	arena_scope (node_arena ());
 try
 	{
 	Value
@@ -643,6 +710,8 @@ Parser::get_value ()
 {
 if (is_empty ())
 	return NULL;
+Arena::Scope
+	arena_scope (node_arena ());
 
 Array
 	*The_Array = new Array ();	//	Accumulate an Array of Values.
@@ -676,7 +745,11 @@ else if (at (delimiter) == SEQUENCE_START_DELIMITER)
 	The_Array->type (start_type = Value::SEQUENCE);
 	}
 if (start_type != 0)
+	{
 	next_location (++delimiter);
+	//	Leave a margin beyond the estimate for the Vectal capacity.
+	The_Array->reserve (array_size_estimate (delimiter) + 1);
+	}
 
 /*..............................................................................
 	Get as many values as possible.
@@ -705,7 +778,7 @@ while (true)
 			next_location (++delimiter);
 
 			//	Get any units string for this array.
-			The_Array->units (get_units ());
+			The_Array->units (symbol (get_units ()));
 
 		case STATEMENT_END_DELIMITER:
 			goto End_of_Values;
@@ -754,7 +827,7 @@ while (true)
 			break;
 
 		//	Get any units string for this datum.
-		value->units (get_units ());
+		value->units (symbol (get_units ()));
 		}
 	//	Add the value to the array.
 	The_Array->poke_back (value);
@@ -827,7 +900,7 @@ while (true)
 			next_location (++location);
 
 			//	Get any units string for this array.
-			The_Array->units (get_units ());
+			The_Array->units (symbol (get_units ()));
 			goto End_of_Values;
 
 		//	Syntax error cases:
@@ -881,6 +954,58 @@ if (! start_type &&	//	Not an explicit Array.
 return value;
 }
 
+/*	Estimates the number of Values in an Array.
+
+	The characters already in the buffer are scanned, from the location
+	following the Array start delimiter to the matching Array end
+	delimiter, counting the Value delimiters outside of any enclosed
+	Arrays or quoted strings. No more input is read, and comments are
+	not recognized, so the estimate may be low or high; it is only used
+	to reserve space in the Array.
+*/
+unsigned int
+Parser::array_size_estimate
+	(
+	Location	location
+	)
+	const
+{
+unsigned int
+	estimate = 1,
+	depth = 0;
+char
+	quote = 0;
+for (String::size_type
+		index = index_of (location);
+		index < length ();
+		index++)
+	{
+	char
+		character = (*this)[index];
+	if (quote)
+		{
+		if (character == quote)
+			quote = 0;
+		}
+	else if (character == TEXT_DELIMITER ||
+			 character == SYMBOL_DELIMITER)
+		quote = character;
+	else if (character == SET_START_DELIMITER ||
+			 character == SEQUENCE_START_DELIMITER)
+		++depth;
+	else if (character == SET_END_DELIMITER ||
+			 character == SEQUENCE_END_DELIMITER)
+		{
+		if (! depth--)
+			break;
+		}
+	else if (character == PARAMETER_VALUE_DELIMITER &&
+			 ! depth)
+		++estimate;
+	}
+return estimate;
+}
+
 /*------------------------------------------------------------------------------
 	Datum
 */
@@ -889,6 +1014,8 @@ Parser::get_datum ()
 {
 if (is_empty ())
 	return NULL;
+Arena::Scope
+	arena_scope (node_arena ());
 
 Location
 	delimiter;
@@ -1466,6 +1593,24 @@ if (! Warnings->empty ())
 Warnings->clear ();
 }
 
+Memory_Usage
+Parser::memory_usage () const
+{
+Memory_Usage
+	usage;
+usage.Warnings += sizeof (Warnings_List)
+	+ Warnings->capacity () * sizeof (Exception*);
+for (Parser::Warnings_List::const_iterator
+		warning = Warnings->begin ();
+	 warning != Warnings->end ();
+	 ++warning)
+	usage.Warnings +=
+		(dynamic_cast<const Invalid_Syntax*>(*warning) ?
+			sizeof (Invalid_Syntax) : sizeof (Exception))
+		+ Memory_Usage::string_size ((*warning)->message ());
+return usage;
+}
+
 string
 Parser::line_position
 	(
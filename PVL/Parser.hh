@@ -195,6 +195,18 @@ static const char* const
 #define PARSE_STRING_CONTINUATION true
 #endif
 
+#ifndef PARSE_ARENA
+#define PARSE_ARENA false
+#endif
+
+#ifndef PARSE_INTERN_SYMBOLS
+#define PARSE_INTERN_SYMBOLS false
+#endif
+
+#ifndef PARSE_STRIP_COMMENTS
+#define PARSE_STRIP_COMMENTS false
+#endif
+
 
 /**	Characters reserved by the PVL syntax.
 
@@ -313,6 +325,9 @@ Parser ()
 		Verbatim_Strings	(PARSE_VERBATIM_STRINGS),
 		Commented_Lines		(PARSE_COMMENTED_LINES),
 		String_Continuation	(PARSE_STRING_CONTINUATION),
+		Intern_Symbols		(PARSE_INTERN_SYMBOLS),
+		Strip_Comments		(PARSE_STRIP_COMMENTS),
+		Node_Arena			(PARSE_ARENA ? new Arena : NULL),
 		Warnings			(new Warnings_List ())
 {}
 
@@ -350,6 +365,9 @@ Parser
 		Verbatim_Strings	(parser.Verbatim_Strings),
 		Commented_Lines		(parser.Commented_Lines),
 		String_Continuation	(parser.String_Continuation),
+		Intern_Symbols		(parser.Intern_Symbols),
+		Strip_Comments		(parser.Strip_Comments),
+		Node_Arena			(parser.Node_Arena ? new Arena : NULL),
 		VMS_records_filter	(parser.VMS_records_filter),
 		Line_count_filter	(parser.Line_count_filter),
 		Warnings			(new Warnings_List ())
@@ -498,6 +516,91 @@ Parser& string_continuation (bool enable)
 bool string_continuation ()
 	{return String_Continuation;}
 
+/**	Enable or disable interning of Parameter names and Value units.
+
+	When enabled, the names of the Parameters and the units of the
+	Values that the Parser creates are {@link Symbol::intern(const
+	std::string&) interned} Symbols. Each different name or units
+	string is then kept only once, no matter how many Parameters or
+	Values use it or how many documents are parsed, and names may be
+	compared without examining their text.
+
+	By default interning is disabled.
+
+	@param	enable	true if names and units are to be interned; false
+		otherwise.
+	@return	This Parser.
+	@see	Symbol
+*/
+Parser& intern_symbols (bool enable)
+	{Intern_Symbols = enable; return *this;}
+
+/**	Tests if Parameter names and Value units will be interned.
+
+	@return	true if names and units will be interned; false otherwise.
+	@see	intern_symbols(bool)
+*/
+bool intern_symbols () const
+	{return Intern_Symbols;}
+
+/**	Enable or disable stripping of comments.
+
+	When enabled, the comments in the source of PVL statements are
+	skipped over without being collected, so the Parameters that the
+	Parser creates have no comments. This saves both the work of
+	assembling the comment strings and the memory they would occupy,
+	which can be substantial for heavily commented documents. The
+	syntax of the comments is still checked: a comment without an end
+	delimiter or a comment that spans lines will still produce a
+	{@link warnings() warning}, or an exception in {@link strict(bool)
+	strict mode}.
+
+	By default comments are not stripped.
+
+	@param	enable	true if comments are to be stripped; false
+		otherwise.
+	@return	This Parser.
+	@see	get_comment()
+*/
+Parser& strip_comments (bool enable)
+	{Strip_Comments = enable; return *this;}
+
+/**	Tests if comments will be stripped.
+
+	@return	true if comments will be stripped; false otherwise.
+	@see	strip_comments(bool)
+*/
+bool strip_comments () const
+	{return Strip_Comments;}
+
+/**	Enable or disable node allocation from an Arena.
+
+	When enabled, all the Parameter and Value nodes that the Parser
+	creates are allocated from an Arena that is dedicated to this
+	Parser, rather than each being separately allocated from the heap.
+	The Arena memory is released in one step after the Parser no longer
+	uses it and all the nodes allocated from it have been deleted; e.g.
+	when the root Aggregate of the last document parsed is destroyed
+	after the Parser has been destroyed.
+
+	By default the Arena is disabled.
+
+	@param	enable	true if Parameter and Value nodes are to be
+		allocated from an Arena; false otherwise.
+	@return	This Parser.
+	@see	Arena
+*/
+Parser& arena (bool enable);
+
+/**	Gets the Arena used for node allocation.
+
+	@return	A pointer to the Arena being used by the Parser, or NULL
+		if node allocation from an Arena is disabled.
+	@see	arena(bool)
+*/
+Arena* arena () const
+	{return Node_Arena;}
+
 /*..............................................................................
 	Warnings
 */
@@ -530,6 +633,18 @@ Warnings_List *warnings ()
 */
 void clear_warnings ();
 
+/**	Gets the memory used by the warnings.
+
+	The warnings list and each warning Exception, with its message,
+	are included in the Warnings category. The Parameters and Values
+	provided by the Parser are not included; their memory is obtained
+	from their own memory_usage methods.
+
+	@return	A Memory_Usage for the Parser warnings.
+	@see	Parameter::memory_usage() const
+*/
+Memory_Usage memory_usage () const;
+
 /*==============================================================================
 	PVL parser
 */
@@ -671,6 +786,10 @@ Parameter* get_parameter (bool Assignment_only = false);
 	If any comments are found the next_location of the input stream is
 	moved to the position immediately following the last comment.
 
+	When {@link strip_comments(bool) comment stripping} is enabled the
+	comments are skipped over, with only a missing comment end being
+	checked, and an empty string is always returned.
+
 	@return	A string containing the comment found, or NULL if no
 		comment occurs before the next PVL item or the end of input.
 	@throws	Invalid_Syntax
@@ -989,6 +1108,8 @@ Parameter::Type ingest_parameters (Aggregate& aggregate);
 
 Location skip_commented_line (Location location);
 
+unsigned int array_size_estimate (Location location) const;
+
 void WARNING (Exception* exception);
 
 /**	Generates a string describing the line position of the location.
@@ -1031,7 +1152,21 @@ bool
 	Strict,					//	Enforce strict PVL syntax rules.
 	Verbatim_Strings,		//	Verbatim strings.
 	Commented_Lines,		//	Allow crosshatched-to-EOL comments.
-	String_Continuation;	//	Recognize the string continuation delimiter.
+	String_Continuation,	//	Recognize the string continuation delimiter.
+	Intern_Symbols,			//	Intern Parameter names and Value units.
+	Strip_Comments;			//	Skip comments without collecting them.
+
+//	Node memory pool; NULL if disabled.
+Arena
+	*Node_Arena;
+
+//	The Arena to be used for new nodes.
+Arena* node_arena () const
+	{return Node_Arena ? Node_Arena : Arena::current ();}
+
+//	The Symbol to be used for a new name or units string.
+Symbol symbol (const std::string& text) const
+	{return Intern_Symbols ? Symbol::intern (text) : Symbol (text);}
 
 //	Filters:
 //	Removes VMS binary record structures.
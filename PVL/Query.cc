@@ -0,0 +1,871 @@
+/*	Query
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"Query.hh"
+#include	"Value.hh"
+#include	"PVL_Exceptions.hh"
+
+#include	<string>
+#include	<cstdlib>
+#include	<cstring>
+#include	<cctype>
+using std::string;
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Query
+*/
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Query::ID =
+		"idaeim::PVL::Query (1.0 2026/10/18)";
+
+//	One bit of the States mask is needed for each segment plus the end.
+const int
+	Query::MAX_SEGMENTS		= 63;
+
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+const char
+	*WHITESPACE				= " \t\r\n";
+
+enum Comparison
+	{
+	EQUAL,
+	NOT_EQUAL,
+	LESS,
+	LESS_EQUAL,
+	GREATER,
+	GREATER_EQUAL
+	};
+
+inline bool
+same_character
+	(
+	char	character_1,
+	char	character_2,
+	bool	case_sensitive
+	)
+{
+return
+	character_1 == character_2 ||
+	(! case_sensitive && toupper (character_1) == toupper (character_2));
+}
+
+/*	Wildcard match of an entire name.
+
+	The most recent '*' is retried one character further along the name
+	whenever the rest of the pattern fails to match.
+*/
+bool
+glob_match
+	(
+	const string&	pattern,
+	const string&	name,
+	bool			case_sensitive
+	)
+{
+string::size_type
+	pattern_index = 0,
+	name_index = 0,
+	star_index = string::npos,
+	retry_index = 0;
+if (pattern == "*")
+	return true;
+while (name_index < name.size ())
+	{
+	if (pattern_index < pattern.size () &&
+		pattern[pattern_index] == '*')
+		{
+		star_index = pattern_index++;
+		retry_index = name_index;
+		}
+	else
+	if (pattern_index < pattern.size () &&
+		(pattern[pattern_index] == '?' ||
+		 same_character (pattern[pattern_index], name[name_index],
+			case_sensitive)))
+		{
+		++pattern_index;
+		++name_index;
+		}
+	else
+	if (star_index != string::npos)
+		{
+		pattern_index = star_index + 1;
+		name_index = ++retry_index;
+		}
+	else
+		return false;
+	}
+while (pattern_index < pattern.size () &&
+		pattern[pattern_index] == '*')
+	++pattern_index;
+return pattern_index == pattern.size ();
+}
+
+
+int
+compare_text
+	(
+	const string&	text_1,
+	const string&	text_2,
+	bool			case_sensitive
+	)
+{
+if (case_sensitive)
+	return text_1.compare (text_2);
+for (string::size_type
+		index = 0;
+	 index < text_1.size () && index < text_2.size ();
+	 index++)
+	{
+	int
+		difference = toupper (text_1[index]) - toupper (text_2[index]);
+	if (difference)
+		return difference;
+	}
+return
+	(text_1.size () < text_2.size ()) ? -1 :
+	((text_1.size () > text_2.size ()) ? 1 : 0);
+}
+
+
+template<typename T>
+bool
+compared
+	(
+	Comparison	comparison,
+	const T&	value_1,
+	const T&	value_2
+	)
+{
+switch (comparison)
+	{
+	case EQUAL:			return value_1 == value_2;
+	case NOT_EQUAL:		return value_1 != value_2;
+	case LESS:			return value_1 <  value_2;
+	case LESS_EQUAL:	return value_1 <= value_2;
+	case GREATER:		return value_1 >  value_2;
+	case GREATER_EQUAL:	return value_1 >= value_2;
+	}
+return false;
+}
+
+
+string
+trimmed
+	(
+	const string&	text
+	)
+{
+string::size_type
+	first = text.find_first_not_of (WHITESPACE);
+if (first == string::npos)
+	return string ();
+return text.substr (first, text.find_last_not_of (WHITESPACE) - first + 1);
+}
+
+
+bool
+same_text
+	(
+	const string&	text_1,
+	const string&	text_2
+	)
+{return compare_text (text_1, text_2, false) == 0;}
+
+
+bool
+is_number
+	(
+	const string&	text,
+	Value::Real_type&	number
+	)
+{
+if (text.empty ())
+	return false;
+char
+	*end;
+number = strtold (text.c_str (), &end);
+return *end == 0;
+}
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+/*==============================================================================
+	Constructors
+*/
+Query::Query
+	(
+	const std::string&	expression,
+	bool				case_sensitive
+	)
+	:	Expression (expression),
+		Case_Sensitive (case_sensitive),
+		Delimiter (Parameter::path_delimiter ())
+{
+//	Predicates follow the pathname pattern.
+string::size_type
+	index = expression.find ('[');
+compile (trimmed (expression.substr (0, index)));
+
+while (index != string::npos)
+	{
+	string::size_type
+		end = index + 1;
+	char
+		quote = 0;
+	while (end < expression.size () &&
+			(quote || expression[end] != ']'))
+		{
+		if (quote)
+			{
+			if (expression[end] == quote)
+				quote = 0;
+			}
+		else
+		if (expression[end] == '"' ||
+			expression[end] == '\'')
+			quote = expression[end];
+		++end;
+		}
+	if (end == expression.size ())
+		throw Invalid_Syntax
+			(
+			string ("Unterminated Query predicate - ")
+				+ expression.substr (index),
+			(int)index,
+			ID
+			);
+	compile_predicate (trimmed (expression.substr (index + 1, end - index - 1)));
+
+	index = expression.find_first_not_of (WHITESPACE, end + 1);
+	if (index != string::npos &&
+		expression[index] != '[')
+		throw Invalid_Syntax
+			(
+			string ("Unexpected characters after a Query predicate - ")
+				+ expression.substr (index),
+			(int)index,
+			ID
+			);
+	}
+
+if (Segments.empty ())
+	{
+	if (Predicates.empty ())
+		throw Invalid_Syntax
+			(
+			string ("Empty Query expression."),
+			0,
+			ID
+			);
+	//	Predicates alone select from all Parameters.
+	Segment
+		segment;
+	segment.Pattern = "*";
+	segment.Wildcards = true;
+	segment.Descendant = true;
+	Segments.push_back (segment);
+	}
+}
+
+
+void
+Query::compile
+	(
+	const std::string&	pattern
+	)
+{
+if (pattern.empty ())
+	return;
+
+string::size_type
+	index = 0;
+Segment
+	segment;
+//	A relative pattern may be preceded by any Aggregates.
+segment.Descendant = true;
+if (pattern[0] == Delimiter)
+	{
+	++index;
+	segment.Descendant =
+		index < pattern.size () && pattern[index] == Delimiter;
+	if (segment.Descendant)
+		++index;
+	}
+
+while (true)
+	{
+	if (index == pattern.size ())
+		{
+		if (! segment.Descendant)
+			throw Invalid_Syntax
+				(
+				string ("Query pathname ends with a delimiter - ") + pattern,
+				(int)index,
+				ID
+				);
+		//	Everything below.
+		segment.Pattern = "*";
+		}
+	else
+		{
+		string::size_type
+			end = pattern.find (Delimiter, index);
+		segment.Pattern = pattern.substr (index, end - index);
+		if (segment.Pattern.empty ())
+			throw Invalid_Syntax
+				(
+				string ("Empty Query pathname segment - ") + pattern,
+				(int)index,
+				ID
+				);
+		index = (end == string::npos) ? pattern.size () : end;
+		}
+	segment.Wildcards =
+		segment.Pattern.find_first_of ("*?") != string::npos;
+	if ((int)Segments.size () == MAX_SEGMENTS)
+		throw Invalid_Syntax
+			(
+			string ("More than ") + std::to_string (MAX_SEGMENTS)
+				+ " Query pathname segments - " + pattern,
+			(int)index,
+			ID
+			);
+	Segments.push_back (segment);
+
+	if (index == pattern.size ())
+		break;
+	//	Skip the delimiter; a second delimiter allows descendants.
+	++index;
+	segment.Descendant =
+		index < pattern.size () && pattern[index] == Delimiter;
+	if (segment.Descendant)
+		++index;
+	}
+}
+
+
+void
+Query::compile_predicate
+	(
+	const std::string&	text
+	)
+{
+string::size_type
+	index = text.find_first_of ("=!<> \t");
+string
+	keyword (text.substr (0, index));
+
+if (same_text (keyword, "SIZE") ||
+	same_text (keyword, "VALUE"))
+	{
+	index = text.find_first_not_of (WHITESPACE, index);
+	if (index == string::npos)
+		index = text.size ();
+	static const struct
+		{
+		const char	*Operator;
+		Comparison	Comparison_Code;
+		}
+		OPERATORS[] =
+			{
+			//	Two character operators first.
+			{"==", EQUAL},
+			{"!=", NOT_EQUAL},
+			{"<=", LESS_EQUAL},
+			{">=", GREATER_EQUAL},
+			{"=",  EQUAL},
+			{"<",  LESS},
+			{">",  GREATER}
+			};
+	int
+		entry = -1,
+		entries = sizeof (OPERATORS) / sizeof (OPERATORS[0]);
+	while (++entry < entries &&
+			text.compare (index, strlen (OPERATORS[entry].Operator),
+				OPERATORS[entry].Operator))
+		;
+	if (entry == entries)
+		throw Invalid_Syntax
+			(
+			string ("Missing Query predicate comparison operator - ")
+				+ text,
+			(int)index,
+			ID
+			);
+	Comparison
+		comparison = OPERATORS[entry].Comparison_Code;
+	string::size_type
+		length = strlen (OPERATORS[entry].Operator);
+	string
+		literal (trimmed (text.substr (index + length)));
+	bool
+		quoted = false;
+	if (literal.size () > 1 &&
+		(literal[0] == '"' || literal[0] == '\'') &&
+		literal[literal.size () - 1] == literal[0])
+		{
+		literal = literal.substr (1, literal.size () - 2);
+		quoted = true;
+		}
+	Value::Real_type
+		number = 0;
+	bool
+		numeric = ! quoted && is_number (literal, number);
+
+	if (same_text (keyword, "SIZE"))
+		{
+		if (! numeric)
+			throw Invalid_Syntax
+				(
+				string ("Query SIZE predicate needs a number - ") + text,
+				(int)index,
+				ID
+				);
+		Predicates.push_back
+			([comparison, number] (const Parameter& parameter)
+			{
+			Value::Real_type
+				size = 1;
+			if (parameter.is_Aggregate ())
+				size = static_cast<const Aggregate&>(parameter).size ();
+			else
+			if (parameter.value ().is_Array ())
+				size = static_cast<const Array&>(parameter.value ()).size ();
+			return compared (comparison, size, number);
+			});
+		}
+	else
+	if (numeric)
+		Predicates.push_back
+			([comparison, number] (const Parameter& parameter)
+			{
+			return
+				parameter.is_Assignment () &&
+				parameter.value ().is_Numeric () &&
+				compared (comparison,
+					static_cast<Value::Real_type>(parameter.value ()), number);
+			});
+	else
+		{
+		bool
+			case_sensitive = Case_Sensitive;
+		Predicates.push_back
+			([comparison, literal, case_sensitive] (const Parameter& parameter)
+			{
+			if (! parameter.is_Assignment () ||
+				! parameter.value ().is_String ())
+				return false;
+			Value::String_type
+				value (static_cast<Value::String_type>(parameter.value ()));
+			if (comparison == EQUAL ||
+				comparison == NOT_EQUAL)
+				return glob_match (literal, value, case_sensitive) ==
+					(comparison == EQUAL);
+			return compared (comparison,
+				compare_text (value, literal, case_sensitive), 0);
+			});
+		}
+	return;
+	}
+
+//	Type name.
+static const Parameter::Type
+	PARAMETER_TYPES[] =
+		{
+		Parameter::ASSIGNMENT,
+		Parameter::TOKEN,
+		Parameter::AGGREGATE,
+		Parameter::GROUP,
+		Parameter::OBJECT
+		};
+for (const Parameter::Type
+		*type_code = PARAMETER_TYPES;
+	 type_code < PARAMETER_TYPES
+	 	+ sizeof (PARAMETER_TYPES) / sizeof (PARAMETER_TYPES[0]);
+	 ++type_code)
+	{
+	if (same_text (text, Parameter::type_name (*type_code)))
+		{
+		Parameter::Type
+			type = *type_code;
+		if (type == Parameter::ASSIGNMENT)
+			Predicates.push_back ([] (const Parameter& parameter)
+				{return parameter.is_Assignment ();});
+		else
+		if (type == Parameter::AGGREGATE)
+			Predicates.push_back ([] (const Parameter& parameter)
+				{return parameter.is_Aggregate ();});
+		else
+			Predicates.push_back ([type] (const Parameter& parameter)
+				{return parameter.type () == type;});
+		return;
+		}
+	}
+
+static const Value::Type
+	VALUE_TYPES[] =
+		{
+		Value::NUMERIC,
+		Value::INTEGER,
+		Value::REAL,
+		Value::STRING,
+		Value::IDENTIFIER,
+		Value::SYMBOL,
+		Value::TEXT,
+		Value::DATE_TIME,
+		Value::ARRAY,
+		Value::SET,
+		Value::SEQUENCE
+		};
+for (const Value::Type
+		*type_code = VALUE_TYPES;
+	 type_code < VALUE_TYPES
+	 	+ sizeof (VALUE_TYPES) / sizeof (VALUE_TYPES[0]);
+	 ++type_code)
+	{
+	if (same_text (text, Value::type_name (*type_code)))
+		{
+		Value::Type
+			type = *type_code;
+		bool
+			general =
+				type == Value::NUMERIC ||
+				type == Value::STRING ||
+				type == Value::ARRAY;
+		Predicates.push_back ([type, general] (const Parameter& parameter)
+			{
+			return
+				parameter.is_Assignment () &&
+				(general ?
+					(parameter.value ().type () & type) != 0 :
+					 parameter.value ().type () == type);
+			});
+		return;
+		}
+	}
+
+throw Invalid_Syntax
+	(
+	string ("Unknown Query predicate - ") + text,
+	0,
+	ID
+	);
+}
+
+/*==============================================================================
+	Accessors
+*/
+Query&
+Query::where
+	(
+	const Predicate&	predicate
+	)
+{
+Predicates.push_back (predicate);
+return *this;
+}
+
+/*==============================================================================
+	Evaluation
+*/
+Query::States
+Query::start () const
+{return 1;}
+
+
+Query::States
+Query::advance
+	(
+	States				states,
+	const std::string&	name
+	)
+	const
+{
+States
+	next = 0;
+for (std::vector<Segment>::size_type
+		index = 0;
+	 states && index < Segments.size ();
+	 index++, states >>= 1)
+	{
+	if (! (states & 1))
+		continue;
+	const Segment
+		&segment = Segments[index];
+	if (segment.Descendant)
+		next |= (States)1 << index;
+	bool
+		matched;
+	if (segment.Wildcards)
+		matched = glob_match (segment.Pattern, name, Case_Sensitive);
+	else
+		{
+		matched = segment.Pattern.size () == name.size ();
+		for (string::size_type
+				character = 0;
+			 matched && character < name.size ();
+			 character++)
+			matched = same_character
+				(segment.Pattern[character], name[character], Case_Sensitive);
+		}
+	if (matched)
+		next |= (States)1 << (index + 1);
+	}
+return next;
+}
+
+
+bool
+Query::satisfies
+	(
+	const Parameter&	parameter
+	)
+	const
+{
+for (std::vector<Predicate>::const_iterator
+		predicate = Predicates.begin (),
+		last      = Predicates.end ();
+	 predicate != last;
+	 ++predicate)
+	if (! (*predicate)(parameter))
+		return false;
+return true;
+}
+
+
+bool
+Query::path_matches
+	(
+	const Parameter&				parameter,
+	const Aggregate*				root,
+	std::vector<const Parameter*>&	path
+	)
+	const
+{
+path.clear ();
+const Parameter
+	*node = &parameter;
+while (node != root)
+	{
+	if (! node->parent ())
+		{
+		if (root)
+			//	Not contained by the root.
+			return false;
+		break;
+		}
+	path.push_back (node);
+	node = node->parent ();
+	}
+if (path.empty ())
+	return false;
+
+States
+	states = start ();
+for (std::vector<const Parameter*>::size_type
+		index = path.size ();
+	 states && index--;)
+	states = advance (states, path[index]->name_symbol ().str ());
+return accepts (states);
+}
+
+
+bool
+Query::matches
+	(
+	const Parameter&	parameter,
+	const Aggregate*	root
+	)
+	const
+{
+std::vector<const Parameter*>
+	path;
+return
+	path_matches (parameter, root, path) &&
+	satisfies (parameter);
+}
+
+
+std::vector<Parameter*>
+Query::evaluate
+	(
+	const Aggregate&	aggregate
+	)
+	const
+{
+std::vector<Parameter*>
+	found;
+if (search_index (aggregate, &found, string::npos) == string::npos)
+	search (aggregate, start (), &found, string::npos);
+return found;
+}
+
+
+Parameter*
+Query::first
+	(
+	const Aggregate&	aggregate
+	)
+	const
+{
+std::vector<Parameter*>
+	found;
+if (search_index (aggregate, &found, 1) == string::npos)
+	search (aggregate, start (), &found, 1);
+return found.empty () ? NULL : found.front ();
+}
+
+
+std::size_t
+Query::count
+	(
+	const Aggregate&	aggregate
+	)
+	const
+{
+std::size_t
+	total = search_index (aggregate, NULL, string::npos);
+if (total == string::npos)
+	total = search (aggregate, start (), NULL, string::npos);
+return total;
+}
+
+
+std::size_t
+Query::search
+	(
+	const Aggregate&		aggregate,
+	States					states,
+	std::vector<Parameter*>	*found,
+	std::size_t				limit
+	)
+	const
+{
+//	The States of the Segments still to be matched.
+const States
+	pending = ((States)1 << Segments.size ()) - 1;
+std::size_t
+	total = 0;
+for (Aggregate::const_iterator
+		element = aggregate.begin (),
+		last    = aggregate.end ();
+	 element != last;
+	 ++element)
+	{
+	Parameter
+		*parameter = aggregate.peek (element);
+	States
+		next = advance (states, parameter->name_symbol ().str ());
+	if (accepts (next) &&
+		satisfies (*parameter))
+		{
+		if (found)
+			found->push_back (parameter);
+		if (++total == limit)
+			break;
+		}
+	if ((next & pending) &&
+		parameter->is_Aggregate ())
+		{
+		total += search (static_cast<const Aggregate&>(*parameter),
+			next, found, limit - total);
+		if (total == limit)
+			break;
+		}
+	}
+return total;
+}
+
+
+std::size_t
+Query::search_index
+	(
+	const Aggregate&		aggregate,
+	std::vector<Parameter*>	*found,
+	std::size_t				limit
+	)
+	const
+{
+const Segment
+	&segment = Segments.back ();
+if (! aggregate.indexed () ||
+	segment.Wildcards ||
+	Delimiter != Parameter::path_delimiter ())
+	return string::npos;
+
+//	An absolute pathname without wildcards has a single index key.
+bool
+	absolute = true;
+string
+	key;
+for (std::vector<Segment>::const_iterator
+		element = Segments.begin ();
+	 absolute && element != Segments.end ();
+	 ++element)
+	{
+	absolute = ! element->Wildcards && ! element->Descendant;
+	key += Delimiter;
+	key += element->Pattern;
+	}
+if (! absolute)
+	key = segment.Pattern;
+for (string::iterator
+		character = key.begin ();
+	 character != key.end ();
+	 ++character)
+	*character = (char)toupper (*character);
+
+const std::vector<Parameter*>
+	&candidates = *aggregate.index_candidates (key, absolute);
+std::vector<const Parameter*>
+	path;
+std::size_t
+	total = 0;
+for (std::vector<Parameter*>::const_iterator
+		candidate = candidates.begin (),
+		last      = candidates.end ();
+	 candidate != last;
+	 ++candidate)
+	{
+	if (path_matches (**candidate, &aggregate, path) &&
+		satisfies (**candidate))
+		{
+		if (found)
+			found->push_back (*candidate);
+		if (++total == limit)
+			break;
+		}
+	}
+return total;
+}
+
+}		//	namespace PVL
+}		//	namespace idaeim
@@ -0,0 +1,296 @@
+/*	Query
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#ifndef idaeim_PVL_Query_hh
+#define idaeim_PVL_Query_hh
+
+#include	"Parameter.hh"
+
+#include	<string>
+#include	<vector>
+#include	<functional>
+#include	<cstddef>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Query
+*/
+/**	A <i>Query</i> selects the Parameters of an Aggregate hierarchy that
+	match a pathname pattern and a set of predicates.
+
+	A Query expression is compiled once when the Query is constructed
+	and may then be {@link evaluate(const Aggregate&) const evaluated}
+	against any number of Aggregates. The expression syntax is:
+
+<dl>
+<dt>Segments
+<dd>The pathname pattern is a sequence of name segments separated by
+	the {@link Parameter::path_delimiter() pathname delimiter}, in the
+	same form as a {@link Aggregate::find(const std::string&, bool, int,
+	Parameter::Type) find} pathname. Each segment is matched against the
+	entire name of a Parameter. A segment may contain the wildcard
+	characters '*', which matches any sequence of characters, and '?',
+	which matches any single character.
+
+<dt>Absolute and relative patterns
+<dd>A pattern that starts with a single delimiter is absolute: its
+	first segment must match a Parameter directly contained by the
+	Aggregate being searched. Any other pattern is relative: it matches
+	a Parameter at any depth whose pathname ends with the pattern.
+
+<dt>Descendants
+<dd>Two consecutive delimiters match any number - including none - of
+	intervening Aggregates. A pattern that ends with two delimiters
+	matches all the descendants of the Aggregates that match the
+	preceding segments.
+
+<dt>Predicates
+<dd>The pattern may be followed by any number of predicates, each
+	enclosed in square brackets, that a Parameter must also satisfy. A
+	predicate is either a type name or a comparison:
+	<ul>
+	<li>A {@link Parameter::type_name(const Type) Parameter type name}
+		(e.g. "Assignment", "Group") selects Parameters of the named
+		Type. A {@link Value::type_name(const Type) Value type name}
+		(e.g. "Array", "Integer", "String") selects Assignments with a
+		Value of the named Type. A general type name - Assignment,
+		Aggregate, Numeric, String or Array - includes all of its
+		specific types.
+	<li><code>SIZE</code> <i>operator</i> <i>number</i> compares the
+		number of elements of an Array Value, or the number of
+		Parameters in an Aggregate. A single Value has a size of one.
+	<li><code>VALUE</code> <i>operator</i> <i>literal</i> compares the
+		Value of an Assignment having a single Value. If the literal is
+		a number a Numeric Value is compared numerically. Otherwise a
+		String Value is compared with the literal, which may be quoted
+		and, for the = and != operators, may contain wildcards. String
+		Values are compared with the same case sensitivity as names.
+	</ul>
+	The comparison operator is one of =, !=, &lt;, &lt;=, &gt; or &gt;=.
+	Predicate keywords and type names are not case sensitive. An
+	expression consisting only of predicates selects from all the
+	Parameters.
+</dl>
+
+	For example, "/&#42;/FILTER_NAME" selects every FILTER_NAME
+	Parameter contained by a top level Aggregate, "//BAND_BIN//"
+	selects everything inside every BAND_BIN Aggregate, and
+	"[Array][SIZE > 1000]" selects every Assignment having an Array
+	Value with more than 1000 elements. Arbitrary predicates may be
+	added with {@link where(const Predicate&) where}.
+
+	A Query is evaluated by a single depth-first traversal of the
+	Aggregate hierarchy in which the pattern is matched incrementally:
+	the Aggregates that can not contain a match are not entered, and no
+	pathname is ever assembled. When the Aggregate being searched has
+	its {@link Aggregate::indexed(bool) pathname index} enabled and the
+	last pattern segment has no wildcards, only the Parameters listed in
+	the index for that name are examined. In both cases the Parameters
+	are selected in depth-first order.
+
+	A Query is not modified by evaluation, so the same Query may be
+	evaluated by multiple threads at the same time.
+
+	@version	1.0
+	@see	Aggregate::find_all(const std::string&, bool, Parameter::Type)
+*/
+class Query
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	A Parameter selection test.
+typedef std::function<bool (const Parameter&)>	Predicate;
+
+/*==============================================================================
+	Constants:
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+//!	The maximum number of pattern segments.
+static const int
+	MAX_SEGMENTS;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Compiles a Query expression.
+
+	The current {@link Parameter::path_delimiter() pathname delimiter}
+	is used to separate the pattern segments.
+
+	@param	expression	The Query expression.
+	@param	case_sensitive	If true, the pattern segments are matched
+		with case sensitivity; otherwise case is ignored.
+	@throws	Invalid_Syntax	If the expression can not be compiled.
+*/
+explicit Query
+	(
+	const std::string&	expression,
+	bool				case_sensitive = false
+	);
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the Query expression.
+
+	@return	The expression string from which the Query was compiled.
+*/
+const std::string& expression () const
+	{return Expression;}
+
+/**	Tests if the pattern segments are matched with case sensitivity.
+
+	@return	true if the Query is case sensitive; false otherwise.
+*/
+bool case_sensitive () const
+	{return Case_Sensitive;}
+
+/**	Adds a predicate that a Parameter must satisfy to be selected.
+
+	Predicates are tested, in the order they were added, after the
+	Parameter pathname has been matched.
+
+	@param	predicate	The Predicate to be added.
+	@return	This Query.
+*/
+Query& where (const Predicate& predicate);
+
+/*==============================================================================
+	Evaluation
+*/
+/**	Tests if a Parameter is selected by the Query.
+
+	@param	parameter	The Parameter to be tested.
+	@param	root	The Aggregate relative to which the Parameter's
+		pathname is matched. If NULL the root of the Parameter's
+		hierarchy is used.
+	@return	true if the Parameter is contained, at some depth, by the
+		root Aggregate and is selected by the Query; false otherwise.
+*/
+bool matches
+	(
+	const Parameter&	parameter,
+	const Aggregate*	root = NULL
+	)
+	const;
+
+/**	Selects the matching Parameters of an Aggregate hierarchy.
+
+	@param	aggregate	The Aggregate to be searched.
+	@return	A vector of pointers to the selected Parameters in
+		depth-first order.
+*/
+std::vector<Parameter*> evaluate (const Aggregate& aggregate) const;
+
+/**	Gets the first matching Parameter of an Aggregate hierarchy.
+
+	The search stops as soon as a match is found.
+
+	@param	aggregate	The Aggregate to be searched.
+	@return	A pointer to the first selected Parameter in depth-first
+		order, or NULL if there is none.
+*/
+Parameter* first (const Aggregate& aggregate) const;
+
+/**	Counts the matching Parameters of an Aggregate hierarchy.
+
+	@param	aggregate	The Aggregate to be searched.
+	@return	The number of Parameters that {@link evaluate(const
+		Aggregate&) const evaluate} would select.
+*/
+std::size_t count (const Aggregate& aggregate) const;
+
+/*==============================================================================
+	Private
+*/
+private:
+
+//	The set of pattern positions reached, as a bit mask.
+typedef unsigned long long	States;
+
+struct Segment
+{
+std::string
+	Pattern;
+//	The Pattern contains wildcards.
+bool
+	Wildcards;
+//	Names may be skipped before this segment is matched.
+bool
+	Descendant;
+};
+
+void compile (const std::string& pattern);
+void compile_predicate (const std::string& text);
+
+States start () const;
+States advance (States states, const std::string& name) const;
+bool accepts (States states) const
+	{return states & ((States)1 << Segments.size ());}
+bool satisfies (const Parameter& parameter) const;
+bool path_matches
+	(
+	const Parameter&				parameter,
+	const Aggregate*				root,
+	std::vector<const Parameter*>&	path
+	)
+	const;
+
+std::size_t search
+	(
+	const Aggregate&		aggregate,
+	States					states,
+	std::vector<Parameter*>	*found,
+	std::size_t				limit
+	)
+	const;
+std::size_t search_index
+	(
+	const Aggregate&		aggregate,
+	std::vector<Parameter*>	*found,
+	std::size_t				limit
+	)
+	const;
+
+std::string
+	Expression;
+bool
+	Case_Sensitive;
+char
+	Delimiter;
+std::vector<Segment>
+	Segments;
+std::vector<Predicate>
+	Predicates;
+
+};		//	End of Query class.
+
+}		//	namespace PVL
+}		//	namespace idaeim
+#endif	//	idaeim_PVL_Query_hh
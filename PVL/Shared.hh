@@ -0,0 +1,211 @@
+/*	Shared
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#ifndef idaeim_PVL_Shared_hh
+#define idaeim_PVL_Shared_hh
+
+#include	"PVL/Parameter.hh"
+#include	"PVL/Value.hh"
+
+#include	<memory>
+#include	<utility>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Shared
+*/
+/**	A <i>Shared</i> tree is a copy-on-write handle for an Aggregate or
+	Array.
+
+	Copying a Shared handle does not copy the tree it refers to; the
+	copy refers to the same tree. This makes handing a snapshot of a
+	large Parameter tree - e.g. a PDS label - to another component a
+	constant time operation. The tree is only cloned when it is about
+	to be {@link modify() modified} while another handle still refers
+	to it. Thus each handle always sees the tree as it was when the
+	handle was copied, no matter how the other handles are used.
+
+	The unit of sharing is the entire tree. Every Parameter and Value
+	has a single Parent, and the Depth_Iterator and the pathname
+	methods depend on it, so a node can not be shared by two trees
+	without breaking those links. Sharing whole trees keeps every
+	Parent link, and every Depth_Iterator, consistent while still
+	avoiding the deep copy when nobody modifies the snapshot.
+
+	<b>N.B.</b>: A reference obtained from modify() refers to a tree
+	that may become shared as soon as the handle is copied. Always
+	obtain a new reference from modify() after copying a handle rather
+	than modifying the tree through a reference obtained before the
+	copy was made.
+
+	The reference count of the shared tree is maintained atomically,
+	so handles referring to the same tree may be copied, read and
+	destroyed by different threads. However, any one handle must not
+	be used concurrently by more than one thread if one of them is
+	modifying it.
+
+	@param	T	The Aggregate or Array class of the tree.
+	@version	1.0
+	@see	Aggregate
+	@see	Array
+*/
+template <typename T>
+class Shared
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	The class of the shared tree.
+typedef T						value_type;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs a Shared handle for a new, empty tree.
+*/
+Shared ()
+	:	Tree (new T)
+	{}
+
+/**	Constructs a Shared handle for a copy of a tree.
+
+	The tree is cloned once; further copies of the handle share the
+	clone.
+
+	@param	tree	The tree to be copied.
+*/
+explicit Shared (const T& tree)
+	:	Tree (tree.clone ())
+	{}
+
+/**	Constructs a Shared handle for a tree that is moved in.
+
+	The contents of the tree are taken over, not cloned. The tree is
+	left empty.
+
+	@param	tree	The tree to be moved.
+*/
+explicit Shared (T&& tree)
+	:	Tree (new T (std::move (tree)))
+	{}
+
+/**	Constructs a Shared handle that takes ownership of a tree.
+
+	<b>N.B.</b>: The tree must not have a parent, and it must not be
+	deleted by anyone else.
+
+	@param	tree	A pointer to the tree to be owned. If NULL a new,
+		empty tree is used.
+*/
+explicit Shared (T* tree)
+	:	Tree (tree ? tree : new T)
+	{}
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the tree for reading.
+
+	@return	A const reference to the tree.
+*/
+const T& operator* () const
+	{return *Tree;}
+
+/**	Gets the tree for reading.
+
+	@return	A const pointer to the tree.
+*/
+const T* operator-> () const
+	{return Tree.get ();}
+
+/**	Gets the tree for reading.
+
+	@return	A const reference to the tree.
+*/
+const T& get () const
+	{return *Tree;}
+
+/**	Gets the tree for modification.
+
+	If the tree is shared with any other handle it is first cloned;
+	the other handles continue to refer to the original tree. Thus a
+	modification never affects the tree seen by any other handle.
+
+	@return	A reference to a tree that is referred to only by this
+		handle.
+*/
+T& modify ()
+{
+if (Tree.use_count () > 1)
+	Tree.reset (Tree->clone ());
+return *Tree;
+}
+
+/**	Tests if the tree is shared with another handle.
+
+	@return	true if another handle refers to the same tree; false
+		otherwise.
+*/
+bool is_shared () const
+	{return Tree.use_count () > 1;}
+
+/**	Gets the number of handles referring to the tree.
+
+	@return	The number of handles, including this one, that refer to
+		the same tree.
+*/
+long shares () const
+	{return Tree.use_count ();}
+
+/**	Tests if another handle refers to the same tree.
+
+	@param	shared	The other handle.
+	@return	true if both handles refer to the same tree; false
+		otherwise.
+*/
+bool shares_with (const Shared& shared) const
+	{return Tree == shared.Tree;}
+
+/*==============================================================================
+	Data members
+*/
+private:
+
+std::shared_ptr<T>
+	Tree;
+
+};		//	End of Shared class.
+
+/*==============================================================================
+	Types
+*/
+//!	A copy-on-write Aggregate.
+typedef Shared<Aggregate>			Shared_Aggregate;
+//!	A copy-on-write Array.
+typedef Shared<Array>				Shared_Array;
+
+}		//	namespace PVL
+}		//	namespace idaeim
+#endif	//	idaeim_PVL_Shared_hh
@@ -0,0 +1,254 @@
+/*	Small_Stack
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#ifndef idaeim_PVL_Small_Stack_hh
+#define idaeim_PVL_Small_Stack_hh
+
+#include	<cstddef>
+#include	<utility>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Small_Stack
+*/
+/**	A <i>Small_Stack</i> is a stack that holds its first few entries
+	within itself.
+
+	Up to Inline entries are kept in storage that is part of the
+	Small_Stack object, so a Small_Stack that never grows beyond that
+	size never allocates memory and is copied without allocation. Only
+	when more entries are pushed are they moved to storage allocated
+	from the heap; that storage is kept until the Small_Stack is
+	destroyed. A Small_Stack that has been moved from is left empty
+	and, when its entries were on the heap, their storage is taken
+	over by the Small_Stack it was moved to.
+
+	This is the position stack of the Aggregate and Array
+	Depth_Iterators, where the depth of a typical Parameter or Value
+	hierarchy is only a few levels.
+
+	@param	T	The entry type. It must be default constructible and
+		copy assignable.
+	@param	Inline	The number of entries held within the Small_Stack.
+	@version	1.0
+*/
+template <typename T, std::size_t Inline>
+class Small_Stack
+{
+public:
+/*==============================================================================
+	Types
+*/
+typedef T					value_type;
+typedef std::size_t			size_type;
+typedef T*					iterator;
+typedef const T*			const_iterator;
+
+/*==============================================================================
+	Constructors
+*/
+//!	Constructs an empty Small_Stack.
+Small_Stack ()
+	:	Entries (Local),
+		Size (0),
+		Capacity (Inline)
+	{}
+
+/**	Copy constructor.
+
+	@param	stack	The Small_Stack to be copied.
+*/
+Small_Stack (const Small_Stack& stack)
+	:	Entries (Local),
+		Size (0),
+		Capacity (Inline)
+	{*this = stack;}
+
+/**	Move constructor.
+
+	@param	stack	The Small_Stack to be moved. It is left empty.
+*/
+Small_Stack (Small_Stack&& stack)
+	:	Entries (Local),
+		Size (0),
+		Capacity (Inline)
+	{*this = std::move (stack);}
+
+//!	Destructor.
+~Small_Stack ()
+	{
+	if (Entries != Local)
+		delete[] Entries;
+	}
+
+/*==============================================================================
+	Assignment
+*/
+/**	Copy assignment.
+
+	@param	stack	The Small_Stack to be copied.
+	@return	This Small_Stack.
+*/
+Small_Stack& operator= (const Small_Stack& stack)
+	{
+	if (this != &stack)
+		{
+		reserve (stack.Size);
+		for (size_type
+				index = 0;
+				index < stack.Size;
+				index++)
+			Entries[index] = stack.Entries[index];
+		Size = stack.Size;
+		}
+	return *this;
+	}
+
+/**	Move assignment.
+
+	@param	stack	The Small_Stack to be moved. It is left empty.
+	@return	This Small_Stack.
+*/
+Small_Stack& operator= (Small_Stack&& stack)
+	{
+	if (this != &stack)
+		{
+		if (stack.Entries != stack.Local)
+			{
+			//	Take over the heap storage.
+			if (Entries != Local)
+				delete[] Entries;
+			Entries = stack.Entries;
+			Capacity = stack.Capacity;
+			Size = stack.Size;
+			stack.Entries = stack.Local;
+			stack.Capacity = Inline;
+			}
+		else
+			*this = static_cast<const Small_Stack&>(stack);
+		stack.Size = 0;
+		}
+	return *this;
+	}
+
+/*==============================================================================
+	Accessors
+*/
+//!	Tests if the Small_Stack is empty.
+bool empty () const
+	{return ! Size;}
+
+//!	Gets the number of entries.
+size_type size () const
+	{return Size;}
+
+//!	Gets the number of entries that can be held without allocation.
+size_type capacity () const
+	{return Capacity;}
+
+//!	Gets the top entry. The Small_Stack must not be empty.
+T& back ()
+	{return Entries[Size - 1];}
+const T& back () const
+	{return Entries[Size - 1];}
+
+//!	Gets an entry by index from the bottom of the stack.
+T& operator[] (size_type index)
+	{return Entries[index];}
+const T& operator[] (size_type index) const
+	{return Entries[index];}
+
+//!	Gets an iterator at the bottom of the stack.
+iterator begin ()
+	{return Entries;}
+const_iterator begin () const
+	{return Entries;}
+
+//!	Gets an iterator beyond the top of the stack.
+iterator end ()
+	{return Entries + Size;}
+const_iterator end () const
+	{return Entries + Size;}
+
+/*==============================================================================
+	Manipulators
+*/
+/**	Pushes an entry onto the top of the stack.
+
+	@param	entry	The entry to be pushed.
+*/
+void push_back (const T& entry)
+	{
+	if (Size == Capacity)
+		reserve (Capacity << 1);
+	Entries[Size++] = entry;
+	}
+
+//!	Pops the top entry. The Small_Stack must not be empty.
+void pop_back ()
+	{--Size;}
+
+//!	Removes all entries. Any heap storage is kept for reuse.
+void clear ()
+	{Size = 0;}
+
+/**	Ensures capacity for an amount of entries.
+
+	@param	amount	The number of entries that the Small_Stack is to
+		be able to hold without further allocation.
+*/
+void reserve (size_type amount)
+	{
+	if (amount <= Capacity)
+		return;
+	T
+		*entries = new T[amount];
+	for (size_type
+			index = 0;
+			index < Size;
+			index++)
+		entries[index] = std::move (Entries[index]);
+	if (Entries != Local)
+		delete[] Entries;
+	Entries = entries;
+	Capacity = amount;
+	}
+
+/*==============================================================================
+	Private
+*/
+private:
+
+T
+	Local[Inline],
+	*Entries;
+size_type
+	Size,
+	Capacity;
+
+};		//	End of Small_Stack class.
+
+}		//	namespace PVL
+}		//	namespace idaeim
+#endif	//	idaeim_PVL_Small_Stack_hh
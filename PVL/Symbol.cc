@@ -0,0 +1,316 @@
+/*	Symbol
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"Symbol.hh"
+
+#include	<atomic>
+#include	<functional>
+#include	<mutex>
+#include	<ostream>
+#include	<cctype>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Symbol
+*/
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Symbol::ID =
+		"idaeim::PVL::Symbol (1.0 2026/10/18)";
+
+#ifndef SYMBOL_TABLE_INITIAL_CAPACITY
+#define SYMBOL_TABLE_INITIAL_CAPACITY		256
+#endif
+
+/*==============================================================================
+	Symbol table
+*/
+/*	The symbol table is an open addressing hash table of entry pointers
+	with linear probing. Its capacity is a power of two and is kept at
+	least twice the number of entries.
+
+	The table is searched without locking: each slot is set, once, to
+	an entry that is complete before it is stored, and a table that is
+	replaced by a larger one is never destroyed, so a search that is
+	concurrent with an addition sees either the new entry or an empty
+	slot. Additions are serialized by the table lock.
+
+	The tables are never destroyed so that Symbols held by static
+	objects remain valid while the program exits.
+*/
+struct Symbol::Table
+{
+explicit Table (std::size_t capacity, const Table* previous = NULL)
+	:	Mask (capacity - 1),
+		Slots (new std::atomic<const Entry*>[capacity]),
+		Previous (previous)
+	{
+	for (std::size_t
+			slot = 0;
+		 slot <= Mask;
+		 slot++)
+		Slots[slot].store (NULL, std::memory_order_relaxed);
+	}
+
+//	The slot for some text: either its entry or an empty slot.
+std::atomic<const Entry*>&
+slot
+	(
+	const std::string&	text
+	)
+	const
+{
+std::size_t
+	index = std::hash<std::string> ()(text) & Mask;
+const Entry
+	*entry;
+while ((entry = Slots[index].load (std::memory_order_acquire)) &&
+		entry->Text != text)
+	index = (index + 1) & Mask;
+return Slots[index];
+}
+
+std::size_t
+	Mask;
+std::atomic<const Entry*>
+	*Slots;
+//	The table that was replaced by this one.
+const Table
+	*Previous;
+
+//	The current symbol table; NULL until the first entry is added.
+static std::atomic<Table*>
+	Current;
+};
+
+std::atomic<Symbol::Table*>
+	Symbol::Table::Current (NULL);
+
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+std::atomic<std::size_t>
+	Total_Entries (0);
+
+std::mutex&
+symbol_table_lock ()
+{
+static std::mutex
+	*lock = new std::mutex;
+return *lock;
+}
+
+std::string
+uppercase
+	(
+	const std::string&	text
+	)
+{
+std::string
+	upper (text);
+for (std::string::iterator
+		character = upper.begin ();
+	 character != upper.end ();
+	 ++character)
+	*character = (char)toupper (*character);
+return upper;
+}
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+
+const Symbol::Entry*
+Symbol::table_entry
+	(
+	const std::string&	text
+	)
+{
+const Table
+	*table = Table::Current.load (std::memory_order_acquire);
+if (! table)
+	return NULL;
+return table->slot (text).load (std::memory_order_acquire);
+}
+
+/*==============================================================================
+	Constructors
+*/
+Symbol
+Symbol::intern
+	(
+	const std::string&	text
+	)
+{
+Symbol
+	symbol;
+if (text.empty () ||
+	(symbol.The_Entry = table_entry (text)))
+	return symbol;
+
+std::lock_guard<std::mutex>
+	lock (symbol_table_lock ());
+Table
+	*table = Table::Current.load (std::memory_order_relaxed);
+if (table &&
+	(symbol.The_Entry = table->slot (text).load (std::memory_order_relaxed)))
+	//	Added while waiting for the lock.
+	return symbol;
+
+//	Two entries may be added; keep the table at most half full.
+std::size_t
+	entries = Total_Entries.load (std::memory_order_relaxed) + 2;
+if (! table ||
+	entries * 2 > table->Mask + 1)
+	{
+	std::size_t
+		capacity = table ? (table->Mask + 1) : SYMBOL_TABLE_INITIAL_CAPACITY;
+	while (entries * 2 > capacity)
+		capacity <<= 1;
+	Table
+		*larger = new Table (capacity, table);
+	if (table)
+		for (std::size_t
+				slot = 0;
+			 slot <= table->Mask;
+			 slot++)
+			{
+			const Entry
+				*entry = table->Slots[slot].load (std::memory_order_relaxed);
+			if (entry)
+				larger->slot (entry->Text).store
+					(entry, std::memory_order_relaxed);
+			}
+	Table::Current.store (table = larger, std::memory_order_release);
+	}
+
+std::string
+	upper (uppercase (text));
+const Entry
+	*upper_entry = NULL;
+if (upper != text &&
+	! (upper_entry = table->slot (upper).load (std::memory_order_relaxed)))
+	{
+	Entry
+		*entry = new Entry (upper);
+	entry->Uppercase = entry;
+	table->slot (upper).store (entry, std::memory_order_release);
+	Total_Entries.fetch_add (1, std::memory_order_relaxed);
+	upper_entry = entry;
+	}
+Entry
+	*entry = new Entry (text, upper_entry);
+if (! upper_entry)
+	entry->Uppercase = entry;
+table->slot (text).store (entry, std::memory_order_release);
+Total_Entries.fetch_add (1, std::memory_order_relaxed);
+symbol.The_Entry = entry;
+return symbol;
+}
+
+
+Symbol
+Symbol::lookup
+	(
+	const std::string&	text
+	)
+{
+const Entry
+	*entry = text.empty () ? NULL : table_entry (text);
+if (entry)
+	{
+	Symbol
+		symbol;
+	symbol.The_Entry = entry;
+	return symbol;
+	}
+return Symbol (text);
+}
+
+
+std::size_t
+Symbol::interned ()
+{return Total_Entries.load (std::memory_order_relaxed);}
+
+/*==============================================================================
+	Comparison
+*/
+bool
+Symbol::equals
+	(
+	const Symbol&	symbol,
+	bool			case_sensitive
+	)
+	const
+{
+if (is_interned () && symbol.is_interned ())
+	{
+	//	Empty Symbols have no entry.
+	if (! The_Entry || ! symbol.The_Entry)
+		return The_Entry == symbol.The_Entry;
+	return case_sensitive ?
+		The_Entry == symbol.The_Entry :
+		The_Entry->Uppercase == symbol.The_Entry->Uppercase;
+	}
+return equals (symbol.str (), case_sensitive);
+}
+
+
+bool
+Symbol::equals
+	(
+	const std::string&	text,
+	bool				case_sensitive
+	)
+	const
+{
+const std::string
+	&own_text = str ();
+if (case_sensitive)
+	return own_text == text;
+if (own_text.size () != text.size ())
+	return false;
+for (std::string::size_type
+		index = 0;
+	 index < own_text.size ();
+	 index++)
+	if (toupper (own_text[index]) != toupper (text[index]))
+		return false;
+return true;
+}
+
+/*==============================================================================
+	Functions
+*/
+std::ostream&
+operator<<
+	(
+	std::ostream&	out,
+	const Symbol&	symbol
+	)
+{return out << symbol.str ();}
+
+}		//	namespace PVL
+}		//	namespace idaeim
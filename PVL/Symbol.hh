@@ -0,0 +1,426 @@
+/*	Symbol
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#ifndef idaeim_PVL_Symbol_hh
+#define idaeim_PVL_Symbol_hh
+
+#include	"PVL/Memory_Usage.hh"
+
+#include	<string>
+#include	<utility>
+#include	<iosfwd>
+#include	<cstddef>
+
+
+namespace idaeim
+{
+namespace PVL
+{
+/*******************************************************************************
+	Symbol
+*/
+/**	A <i>Symbol</i> is the string used for a Parameter name or Value
+	units.
+
+	A Symbol is a single pointer to its entry: the text and, if the
+	Symbol has been {@link intern(const std::string&) interned}, a
+	reference to the entry for the uppercase form of the text. An empty
+	Symbol has no entry. A Symbol that is not interned holds its own
+	entry, which is copied with the Symbol. The entry of an interned
+	Symbol is kept, exactly once, in a process wide symbol table and is
+	shared by all the Symbols with the same text. The same few names
+	and units tend to be repeated many times over in a collection of
+	PVL documents - e.g. PDS labels - so interning them avoids keeping
+	a separate copy of each for every Parameter or Value.
+
+	Two interned Symbols have the same text if, and only if, they refer
+	to the same table entry, and each table entry also refers to the
+	entry for its uppercase form. Thus interned Symbols are compared,
+	with or without case sensitivity, by a simple pointer comparison.
+	A Symbol that is not interned is compared by its text.
+
+	Symbols are not interned unless this is specifically requested.
+	Entries are never removed from the symbol table, so interning is
+	intended for vocabulary - names and units - not for arbitrary data.
+
+	The symbol table is thread safe. It is searched without locking;
+	only the addition of new entries is serialized. An interned
+	Symbol's text is immutable and may be read by any thread.
+
+	@version	1.0
+	@see	Parser::intern_symbols(bool)
+*/
+class Symbol
+{
+public:
+/*==============================================================================
+	Constants:
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs an empty Symbol.
+*/
+Symbol ()
+	:	The_Entry (NULL)
+	{}
+
+/**	Constructs a Symbol that is not interned.
+
+	@param	text	The Symbol text. It is copied into the Symbol.
+*/
+explicit Symbol (const std::string& text)
+	:	The_Entry (text.empty () ? NULL : new Entry (text))
+	{}
+
+/**	Constructs a Symbol that is not interned by moving its text.
+
+	@param	text	The Symbol text. It is moved into the Symbol.
+*/
+explicit Symbol (std::string&& text)
+	:	The_Entry (text.empty () ? NULL : new Entry (std::move (text)))
+	{}
+
+/**	Constructs a copy of a Symbol.
+
+	The copy of an interned Symbol refers to the same table entry;
+	otherwise the text is copied.
+
+	@param	symbol	The Symbol to copy.
+*/
+Symbol (const Symbol& symbol)
+	:	The_Entry (copy_of (symbol.The_Entry))
+	{}
+
+/**	Constructs a Symbol by moving another Symbol.
+
+	The other Symbol is left empty.
+
+	@param	symbol	The Symbol to move.
+*/
+Symbol (Symbol&& symbol) noexcept
+	:	The_Entry (symbol.The_Entry)
+	{symbol.The_Entry = NULL;}
+
+//!	Destroys the Symbol.
+~Symbol ()
+	{release (The_Entry);}
+
+/**	Gets the interned Symbol for some text.
+
+	If the text is not yet in the symbol table it is added.
+
+	@param	text	The Symbol text.
+	@return	An interned Symbol. If the text is empty an empty Symbol,
+		which is always treated as interned, is returned.
+*/
+static Symbol intern (const std::string& text);
+
+/**	Gets the interned Symbol for some text, if there is one.
+
+	Unlike intern, the symbol table is never extended.
+
+	@param	text	The Symbol text.
+	@return	An interned Symbol if the text is already in the symbol
+		table; otherwise a Symbol for the text that is not interned.
+*/
+static Symbol lookup (const std::string& text);
+
+/**	Finds the interned Symbol for some text.
+
+	Unlike lookup, a Symbol is never allocated for text that is not
+	interned.
+
+	@param	text	The Symbol text.
+	@return	An interned Symbol if the text is in the symbol table;
+		otherwise an empty Symbol.
+*/
+static Symbol find (const std::string& text)
+	{
+	Symbol
+		symbol;
+	if (! text.empty ())
+		symbol.The_Entry = table_entry (text);
+	return symbol;
+	}
+
+/**	Gets the number of entries in the symbol table.
+
+	@return	The number of different strings that have been interned,
+		including their uppercase forms.
+*/
+static std::size_t interned ();
+
+/*==============================================================================
+	Assignment
+*/
+/**	Assigns another Symbol to this Symbol.
+
+	@param	symbol	The Symbol to copy.
+	@return	This Symbol.
+	@see	Symbol(const Symbol&)
+*/
+Symbol& operator= (const Symbol& symbol)
+	{
+	if (The_Entry != symbol.The_Entry)
+		{
+		const Entry
+			*entry = copy_of (symbol.The_Entry);
+		release (The_Entry);
+		The_Entry = entry;
+		}
+	return *this;
+	}
+
+/**	Moves another Symbol to this Symbol.
+
+	@param	symbol	The Symbol to move.
+	@return	This Symbol.
+	@see	Symbol(Symbol&&)
+*/
+Symbol& operator= (Symbol&& symbol)
+	{
+	if (this != &symbol)
+		{
+		release (The_Entry);
+		The_Entry = symbol.The_Entry;
+		symbol.The_Entry = NULL;
+		}
+	return *this;
+	}
+
+/**	Assigns new text to the Symbol.
+
+	The Symbol will not be interned.
+
+	@param	text	The new Symbol text.
+	@return	This Symbol.
+*/
+Symbol& operator= (const std::string& text)
+	{return operator= (Symbol (text));}
+
+/**	Assigns new text to the Symbol by moving it.
+
+	The Symbol will not be interned.
+
+	@param	text	The new Symbol text.
+	@return	This Symbol.
+*/
+Symbol& operator= (std::string&& text)
+	{return operator= (Symbol (std::move (text)));}
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the Symbol text.
+
+	@return	A reference to the Symbol's text.
+*/
+const std::string& str () const
+	{return The_Entry ? The_Entry->Text : empty_text ();}
+
+/**	Converts the Symbol to its text.
+
+	@return	A reference to the Symbol's text.
+	@see	str()
+*/
+operator const std::string& () const
+	{return str ();}
+
+/**	Gets the Symbol text as a C-string.
+
+	@return	A pointer to the NUL-terminated Symbol text.
+*/
+const char* c_str () const
+	{return str ().c_str ();}
+
+/**	Tests if the Symbol text is empty.
+
+	@return	true if the Symbol has no text; false otherwise.
+*/
+bool empty () const
+	{return ! The_Entry;}
+
+/**	Gets the length of the Symbol text.
+
+	@return	The number of characters in the Symbol text.
+*/
+std::string::size_type size () const
+	{return str ().size ();}
+
+/**	Tests if the Symbol is interned.
+
+	An empty Symbol is always treated as interned.
+
+	@return	true if the Symbol refers to a symbol table entry, or is
+		empty; false otherwise.
+*/
+bool is_interned () const
+	{return ! The_Entry || The_Entry->Uppercase;}
+
+/**	Gets the heap storage used by the Symbol text.
+
+	The entry of an interned Symbol is in the shared symbol table, so it
+	is not attributed to the Symbol.
+
+	@return	The size of the heap storage of the Symbol's own entry,
+		including the storage of its text.
+	@see	Memory_Usage::string_size(const std::string&)
+*/
+std::size_t memory_usage () const
+	{return is_interned () ?
+		0 : sizeof (Entry) + Memory_Usage::string_size (The_Entry->Text);}
+
+/*==============================================================================
+	Comparison
+*/
+/**	Tests if this Symbol has the same text as another Symbol.
+
+	If both Symbols are interned they are compared by their table
+	entries; no text is examined.
+
+	@param	symbol	The Symbol to compare against.
+	@param	case_sensitive	If false, the text is compared without
+		regard to case.
+	@return	true if the Symbols have the same text; false otherwise.
+*/
+bool equals (const Symbol& symbol, bool case_sensitive = true) const;
+
+/**	Tests if this Symbol has the same text as a string.
+
+	@param	text	The string to compare against.
+	@param	case_sensitive	If false, the text is compared without
+		regard to case.
+	@return	true if the Symbol has the same text; false otherwise.
+*/
+bool equals (const std::string& text, bool case_sensitive = true) const;
+
+/**	Compares this Symbol's text with another string.
+
+	@param	text	The string to compare against.
+	@return	The result of comparing the Symbol text with the string.
+	@see	std::string::compare(const std::string&)
+*/
+int compare (const std::string& text) const
+	{return str ().compare (text);}
+
+/**	Compares this Symbol with another Symbol.
+
+	Symbols with the same entry compare equal without their text being
+	examined.
+
+	@param	symbol	The Symbol to compare against.
+	@return	The result of comparing the Symbol texts.
+	@see	std::string::compare(const std::string&)
+*/
+int compare (const Symbol& symbol) const
+	{return (The_Entry == symbol.The_Entry) ?
+		0 : str ().compare (symbol.str ());}
+
+/*==============================================================================
+	Private
+*/
+private:
+
+/*	The text of a Symbol and, for a symbol table entry, the entry for
+	its uppercase form (NULL for the entry of a Symbol that is not
+	interned). An uppercase entry refers to itself.
+*/
+struct Entry
+	{
+	explicit Entry (const std::string& text, const Entry* uppercase = NULL)
+		:	Text (text),
+			Uppercase (uppercase)
+		{}
+	explicit Entry (std::string&& text)
+		:	Text (std::move (text)),
+			Uppercase (NULL)
+		{}
+
+	const std::string
+		Text;
+	const Entry
+		*Uppercase;
+	};
+
+//	The symbol table; defined in the implementation.
+struct Table;
+
+//	Finds the symbol table entry for some text; NULL if there is none.
+static const Entry* table_entry (const std::string& text);
+
+static const Entry* copy_of (const Entry* entry)
+	{return (entry && ! entry->Uppercase) ? new Entry (entry->Text) : entry;}
+
+static void release (const Entry* entry)
+	{if (entry && ! entry->Uppercase) delete entry;}
+
+static const std::string& empty_text ()
+	{static const std::string empty; return empty;}
+
+//	The Symbol entry; NULL if the Symbol is empty.
+const Entry
+	*The_Entry;
+
+};		//	End of Symbol class.
+
+/*==============================================================================
+	Functions
+*/
+/**	Tests if two Symbols have the same text.
+
+	@param	symbol_1	The first Symbol.
+	@param	symbol_2	The second Symbol.
+	@return	true if the Symbols have the same text; false otherwise.
+	@see	Symbol::equals(const Symbol&, bool)
+*/
+inline bool operator== (const Symbol& symbol_1, const Symbol& symbol_2)
+	{return symbol_1.equals (symbol_2);}
+
+inline bool operator!= (const Symbol& symbol_1, const Symbol& symbol_2)
+	{return ! symbol_1.equals (symbol_2);}
+
+inline bool operator== (const Symbol& symbol, const std::string& text)
+	{return symbol.str () == text;}
+
+inline bool operator!= (const Symbol& symbol, const std::string& text)
+	{return symbol.str () != text;}
+
+inline bool operator== (const std::string& text, const Symbol& symbol)
+	{return symbol.str () == text;}
+
+inline bool operator!= (const std::string& text, const Symbol& symbol)
+	{return symbol.str () != text;}
+
+/**	Prints the Symbol text to an output stream.
+
+	@param	out	The ostream to receive the text.
+	@param	symbol	The Symbol to print.
+	@return	The ostream.
+*/
+std::ostream& operator<< (std::ostream& out, const Symbol& symbol);
+
+}		//	namespace PVL
+}		//	namespace idaeim
+#endif	//	idaeim_PVL_Symbol_hh
@@ -21,6 +21,7 @@ CVS ID: Value.cc,v 1.46 2013/09/17 03:52:51 castalia Exp
 *******************************************************************************/
 
 #include	"Value.hh"
+#include	"Parameter.hh"
 #include	"Parser.hh"
 #include	"Lister.hh"
 
@@ -39,6 +40,8 @@ using std::min;
 #include	<cstdlib>
 #include	<cstring>
 #include	<cerrno>
+#include	<vector>
+#include	<mutex>
 
 using std::string;
 using std::ostream;
@@ -450,6 +453,17 @@ while (parent)
 return root_array;
 }
 
+void
+Value::invalidate_hash ()
+{
+Value
+	*value = this;
+while (value->Parent)
+	value = value->Parent;
+if (value->Owner)
+	value->Owner->invalidate_hash ();
+}
+
 bool
 Value::has_children () const
 {return is_Array () && dynamic_cast<const Array*>(this)->size ();}
@@ -897,7 +911,7 @@ if (this != &value)
 	catch (Exception exception)
 		{INVALID_OPERATION (exception.message (), "assign (=)", *this, value);}
 	Signed = value.is_signed ();
-	Units = value.units ();
+	Units = value.units_symbol ();
 	Digits = value.digits ();
 	if (! (Base = value.base ()) &&
 		value.is_String ())
@@ -905,6 +919,7 @@ if (this != &value)
 	if (! Base)
 		Base = 10;
 	//	DO NOT assign the Parent!
+	invalidate_hash ();
 	}
 return *this;
 }
@@ -922,6 +937,7 @@ if (! base)
 try {Datum = string_to_integer (value, base);}
 catch (Exception exception)
 	{INVALID_OPERATION (exception.message (), "assign (=)", *this, value);}
+invalidate_hash ();
 return *this;
 }
 
@@ -950,7 +966,12 @@ string
 	message;
 if (! value.is_Array ())
 	{
-	try {Datum += static_cast<Integer_type>(value); return *this;}
+	try
+		{
+		Datum += static_cast<Integer_type>(value);
+		invalidate_hash ();
+		return *this;
+		}
 	catch (Exception exception) {message = exception.message ();}
 	}
 INVALID_OPERATION (message, "add", *this, value);
@@ -1107,8 +1128,9 @@ if (this != &value)
 	catch (Invalid_Argument exception)
 		{INVALID_OPERATION (exception.message (), "assign (=)", *this, value);}
 	//	DO NOT assign the Parent!
-	Units = value.units ();
+	Units = value.units_symbol ();
 	Digits = value.digits ();
+	invalidate_hash ();
 	}
 return *this;
 }
@@ -1122,6 +1144,7 @@ Real::operator=
 try {Datum = string_to_real (value);}
 catch (Exception exception)
 	{INVALID_OPERATION (exception.message (), "assign (=)", *this, value);}
+invalidate_hash ();
 return *this;
 }
 
@@ -1150,7 +1173,12 @@ string
 	message;
 if (! value.is_Array ())
 	{
-	try {Datum += static_cast<Real_type>(value); return *this;}
+	try
+		{
+		Datum += static_cast<Real_type>(value);
+		invalidate_hash ();
+		return *this;
+		}
 	catch (Exception exception) {message = exception.message ();}
 	}
 INVALID_OPERATION (message, "add", *this, value);
@@ -1339,6 +1367,17 @@ String::String
 		Subtype (value.Subtype)
 {}
 
+//	Move
+String::String
+	(
+	String&&			value
+	)
+	noexcept
+	:	Value (std::move (value)),
+		Datum (std::move (value.Datum)),
+		Subtype (value.Subtype)
+{}
+
 //	Copy virtual
 String::String
 	(
@@ -1401,6 +1440,7 @@ else
 			<< ") is inappropriate for a String Value.";
 	throw Invalid_Argument (message.str (), ID);
 	}
+invalidate_hash ();
 return *this;
 }
 
@@ -1453,10 +1493,37 @@ if (this != &value)
 		Subtype = value.type ();
 	else
 		Subtype = IDENTIFIER;	//	The default Type.
-	Units = value.units ();
+	Units = value.units_symbol ();
 	Digits = value.digits ();
 	Base = value.base ();
 	//	DO NOT assign the Parent!
+	invalidate_hash ();
+	}
+return *this;
+}
+
+String&
+String::operator=
+	(
+	Value&&			value
+	)
+{
+if (this != &value)
+	{
+	if (value.is_String ())
+		{
+		String
+			&source = static_cast<String&>(value);
+		Datum = std::move (source.Datum);
+		Subtype = source.Subtype;
+		Units = std::move (source.Units);
+		Digits = source.Digits;
+		Base = source.Base;
+		//	DO NOT assign the Parent!
+		invalidate_hash ();
+		}
+	else
+		operator= (static_cast<const Value&>(value));
 	}
 return *this;
 }
@@ -1468,6 +1535,7 @@ String::operator=
 	)
 {
 Datum = integer_to_string (value, SIGNED, Base, Digits);
+invalidate_hash ();
 return *this;
 }
 
@@ -1479,6 +1547,7 @@ String::operator=
 {
 Datum = integer_to_string
 	(static_cast<Integer_type>(value), UNSIGNED, Base, Digits);
+invalidate_hash ();
 return *this;
 }
 
@@ -1490,6 +1559,7 @@ String::operator=
 {
 Datum = real_to_string (value, Real::default_format_flags (), Digits);
 Base = 10;
+invalidate_hash ();
 return *this;
 }
 
@@ -1503,6 +1573,7 @@ Datum = value;
 if (Subtype == IDENTIFIER)
 	//	Possible unquoted Subtype promotion to quoted Subtype.
 	Subtype = type (Datum);
+invalidate_hash ();
 return *this;
 }
 
@@ -1530,6 +1601,7 @@ String::operator+=
 if (value.is_Array ())
 	INVALID_OPERATION ("", "add (+=)", *this, value);
 Datum += static_cast<String_type>(value);
+invalidate_hash ();
 return *this;
 }
 
@@ -1564,6 +1636,31 @@ return Datum.compare (static_cast<String_type>(value));
 /*******************************************************************************
 	Array
 */
+/*	Depth-first offsets.
+
+	The offset of each Value in the list is the number of Values that
+	precede it in a depth-first traversal of the Array; an extra offset
+	for the end of the list is the total size of the Array. The offsets
+	are only kept for lists that are long enough for a binary search to
+	pay; they are rebuilt when next needed after the hierarchy has
+	changed.
+*/
+struct Array::Depth_Offsets
+{
+std::vector<size_type>
+	Offsets;
+std::atomic<bool>
+	Valid;
+std::mutex
+	Lock;
+
+Depth_Offsets ()
+	:	Valid (false)
+	{}
+
+void build (const Array& array);
+};
+
 /*------------------------------------------------------------------------------
 	Constructors
 */
@@ -1571,7 +1668,9 @@ Array::Array
 	(
 	const Type			type_code
 	)
-	:	Value (0, 0)
+	:	Value (0, 0),
+		Total_Size (0),
+		Offsets (NULL)
 {
 type (type_code);
 }
@@ -1583,7 +1682,9 @@ Array::Array
 	)
 	:	Value (array),
 		Vectal<Value> (),
-		Subtype (array.Subtype)
+		Subtype (array.Subtype),
+		Total_Size (0),
+		Offsets (NULL)
 {
 /*	Copy in the new Value List.
 
@@ -1595,12 +1696,29 @@ Array::Array
 copy_in (array);
 }
 
+//		Move
+Array::Array
+	(
+	Array&&				array
+	)
+	:	Value (std::move (array)),
+		Vectal<Value> (),
+		Subtype (array.Subtype),
+		Total_Size (0),
+		Offsets (NULL)
+{
+//	Take over the Values; the Parent of each is reset.
+move_in (array);
+}
+
 //		Copy virtual
 Array::Array
 	(
 	const Value&		value
 	)
-	:	Value (0, 0)
+	:	Value (0, 0),
+		Total_Size (0),
+		Offsets (NULL)
 {
 if (value.is_Array ())
 	*this = value;
@@ -1618,7 +1736,9 @@ Array::Array
 	Parser&				parser,
 	const Type			type_code
 	)
-	:	Value (0, 0)
+	:	Value (0, 0),
+		Total_Size (0),
+		Offsets (NULL)
 {
 Value
 	*value = parser.get_value ();
@@ -1641,6 +1761,13 @@ if (value)
 	}
 }
 
+//	Destructor
+Array::~Array ()
+{
+clear ();
+delete Offsets.load ();
+}
+
 /*------------------------------------------------------------------------------
 	Type conversion
 */
@@ -1751,6 +1878,7 @@ else
 			<< ") is inappropriate for an Array Value.";
 	throw Invalid_Argument (message.str (), Value::ID);
 	}
+invalidate_hash ();
 return *this;
 }
 
@@ -1768,7 +1896,7 @@ if (this != &value)
 	if (value.is_Array ())
 		{
 		//	DO NOT assign the Parent!
-		Units = value.units ();
+		Units = value.units_symbol ();
 		Subtype = value.type ();
 		/*
 			Remove the old Value List.
@@ -1805,6 +1933,47 @@ if (this != &value)
 			 first != last;
 			 ++first)
 			delete *first;
+		invalidate_hash ();
+		}
+	else
+		INVALID_OPERATION ("", "assign (=)", *this, value);
+	}
+return *this;
+}
+
+Array&
+Array::operator=
+	(
+	Value&&				value
+	)
+{
+if (this != &value)
+	{
+	if (value.is_Array ())
+		{
+		Array
+			&array = static_cast<Array&>(value);
+		//	DO NOT assign the Parent!
+		Units = std::move (array.Units);
+		Subtype = array.Subtype;
+		/*
+			The old list is set-aside without deleting it in case the
+			Array being moved is enclosed within this Array.
+		*/
+		std::vector<Value*>
+			list (vector_base ());
+		wipe ();
+		//	Take over the Values (no clones).
+		move_in (array);
+
+		//	Delete the original Values.
+		for (std::vector<Value*>::iterator
+				first = list.begin (),
+				last  = list.end ();
+			 first != last;
+			 ++first)
+			delete *first;
+		invalidate_hash ();
 		}
 	else
 		INVALID_OPERATION ("", "assign (=)", *this, value);
@@ -1933,6 +2102,36 @@ if (comparison == 0)
 return comparison;
 }
 
+/*------------------------------------------------------------------------------
+	Memory usage
+*/
+void
+Array::add_memory_usage
+	(
+	Memory_Usage&	usage
+	)
+	const
+{
+Value::add_memory_usage (usage);
+usage.Nodes += sizeof (Array);
+usage.Lists += size () * sizeof (Value*);
+usage.Slack += (capacity () - size ()) * sizeof (Value*);
+Depth_Offsets
+	*offsets = Offsets.load (std::memory_order_acquire);
+if (offsets)
+	usage.Indices += sizeof (Depth_Offsets)
+		+ offsets->Offsets.capacity () * sizeof (size_type);
+for (const_iterator
+		value = begin (),
+		last  = end ();
+	 value != last;
+	 ++value)
+	{
+	value->add_memory_usage (usage);
+	Arena::node_usage (&*value, usage);
+	}
+}
+
 /*------------------------------------------------------------------------------
 	Convenient
 */
@@ -1961,30 +2160,48 @@ Array::move_in
 {
 /*	Implementation note:
 
-	The code would be more compact if the value pointers were moved
-	in a peek, pull, poke_back loop. However, a pull instead of a
-	pull_back would be used to maintain the order of the original
-	values which would entail an unecessary and potentially
-	expensive shift-up of all the remaining pointers in the list after
-	each pull. To avoid this all the pointers are simply copied, wiped
-	from the source array (which also avoids unecessary parent
-	pointer NULL-ing) and then poke_back is used to move the copied
-	pointers into this array list.
+	The value pointers are spliced into this Value List as a single
+	range rather than being pulled and poked one at a time. The path
+	check and the total size adjustments that entering and removing
+	would apply to each value are done once for the whole list, and the
+	values are re-parented in a single pass.
 */
-//	Copy the new Value List (just the pointers).
-std::vector<Value*>
-	list (array.vector_base ());
-//	Remove the pointers but don't delete the Values.
-array.wipe ();
-//	Move the value pointers into this Value List.
-for (std::vector<Value*>::const_iterator
-		value = list.begin (),
-		last  = list.end ();
-	 value != last;
-	 ++value)
+if (&array == this ||
+	array.empty ())
+	return *this;
+//	None of the moved Values may be in this Array's path.
+for (Value
+		*value = this;
+	 value;
+	 value = value->Parent)
 	{
-	poke_back (*value);	//	Poke it into the destination (Parent reset).
+	if (value->Parent == &array)
+		{
+		ostringstream
+			message;
+		message << "Can't enter Value \"" << *value << "\"";
+		if (message.str ().size () > 75)
+			message.str (message.str ().substr (0, 75) + " ...\"");
+		message << endl
+				<< "  into the Array \"" << *this << "\"";
+		if (message.str ().size () > 150)
+			message.str (message.str ().substr (0, 150) + " ...\"");
+		message << endl
+				<< "  because it is already in the Array's path.";
+		throw Invalid_Argument (message.str (), Value::ID);
+		}
 	}
+size_type
+	amount = array.Total_Size;
+array.total_size_change (amount, false);
+for (iterator
+		value = array.begin (),
+		last  = array.end ();
+	 value != last;
+	 ++value)
+	value->Parent = this;
+splice_back (array);
+total_size_change (amount, true);
 return *this;
 }
 
@@ -2058,6 +2275,79 @@ return NULL;
 /*------------------------------------------------------------------------------
 	Vectal related methods.
 */
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+//	The minimum list size for which depth-first offsets are kept.
+const Array::size_type
+	DEPTH_OFFSETS_MINIMUM	= 16;
+
+//	The number of Values in a depth-first traversal of a Value.
+inline Array::size_type
+depth_span
+	(
+	const Value*	value
+	)
+{
+return value->is_Array () ?
+	(static_cast<const Array*>(value)->total_size () + 1) : 1;
+}
+
+//	The object of an atomic pointer, created when first needed.
+template<typename Object>
+Object*
+depth_offsets
+	(
+	std::atomic<Object*>&	pointer
+	)
+{
+Object
+	*object = pointer.load (std::memory_order_acquire);
+if (! object)
+	{
+	Object
+		*created = new Object;
+	if (pointer.compare_exchange_strong
+			(object, created, std::memory_order_acq_rel))
+		object = created;
+	else
+		delete created;
+	}
+return object;
+}
+
+/*	The offsets of a list, built if they are not valid.
+
+	Once the offsets are valid they are read without the lock, so
+	offsets that were built before a list was shared - like those of a
+	Frozen snapshot - are read without modifying anything.
+*/
+template<typename Object, typename List>
+const Object*
+valid_depth_offsets
+	(
+	std::atomic<Object*>&	pointer,
+	const List&				list
+	)
+{
+Object
+	*offsets = pointer.load (std::memory_order_acquire);
+if (! offsets ||
+	! offsets->Valid.load (std::memory_order_acquire))
+	{
+	offsets = depth_offsets (pointer);
+	std::lock_guard<std::mutex>
+		lock (offsets->Lock);
+	if (! offsets->Valid.load (std::memory_order_relaxed))
+		offsets->build (list);
+	}
+return offsets;
+}
+
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+
 void
 Array::entering
 	(
@@ -2086,6 +2376,7 @@ while (parent)
 	parent = parent->Parent;
 	}
 value->Parent = this;
+total_size_change (depth_span (value), true);
 }
 
 void
@@ -2095,25 +2386,151 @@ Array::removing
 	)
 {
 value->Parent = NULL;
+total_size_change (depth_span (value), false);
+}
+
+void
+Array::wipe ()
+{
+for (iterator
+		value = begin (),
+		last  = end ();
+	 value != last;
+	 ++value)
+	value->Parent = NULL;
+total_size_change (Total_Size, false);
+Value_List::wipe ();
 }
 
+void
+Array::invalidate_offsets ()
+{
+Depth_Offsets
+	*offsets = Offsets.load (std::memory_order_acquire);
+if (offsets)
+	offsets->Valid = false;
+}
+
+void
+Array::total_size_change
+	(
+	size_type	amount,
+	bool		increase
+	)
+{
+Array
+	*root = this;
+for (Array
+		*array = this;
+	 array;
+	 array = array->Parent)
+	{
+	if (increase)
+		array->Total_Size += amount;
+	else
+		array->Total_Size -= amount;
+	array->invalidate_offsets ();
+	root = array;
+	}
+if (root->Owner)
+	root->Owner->invalidate_hash ();
+}
+
+
+void
+Array::Depth_Offsets::build
+	(
+	const Array&	array
+	)
+{
+Offsets.resize (array.size () + 1);
+size_type
+	offset = 0,
+	index = 0;
+for (const_iterator
+		value = array.begin (),
+		last  = array.end ();
+	 value != last;
+	 ++value)
+	{
+	Offsets[index++] = offset;
+	offset += depth_span (&*value);
+	}
+Offsets[index] = offset;
+Valid.store (true, std::memory_order_release);
+}
+
+
 Array::size_type
-Array::total_size ()
+Array::depth_offset
+	(
+	size_type	index
+	)
+	const
 {
-int
-	total = 0;
-if (! empty ())
+if (index >= size ())
+	return Total_Size;
+if (size () < DEPTH_OFFSETS_MINIMUM)
 	{
-	for (iterator
-			first = begin (),
-			last  = end ();
-		first != last;
-		++first,
-		++total)
-		if (first->is_Array ())
-			total += (static_cast<Array&>(*first)).total_size ();
+	size_type
+		offset = 0;
+	for (const_iterator
+			value = begin (),
+			last  = begin () + index;
+		 value != last;
+		 ++value)
+		offset += depth_span (&*value);
+	return offset;
 	}
-return total;
+const Depth_Offsets
+	*offsets = valid_depth_offsets (Offsets, *this);
+return offsets->Offsets[index];
+}
+
+
+Array::size_type
+Array::depth_index
+	(
+	size_type&	offset
+	)
+	const
+{
+if (size () < DEPTH_OFFSETS_MINIMUM)
+	{
+	size_type
+		index = 0,
+		span;
+	for (const_iterator
+			value = begin ();
+			offset >= (span = depth_span (&*value));
+			++value,
+			++index)
+		offset -= span;
+	return index;
+	}
+const Depth_Offsets
+	*offsets = valid_depth_offsets (Offsets, *this);
+size_type
+	index = std::upper_bound
+		(offsets->Offsets.begin (), offsets->Offsets.end (), offset)
+		- offsets->Offsets.begin () - 1;
+offset -= offsets->Offsets[index];
+return index;
+}
+
+
+void
+Array::build_depth_offsets () const
+{
+if (size () >= DEPTH_OFFSETS_MINIMUM)
+	valid_depth_offsets (Offsets, *this);
+for (const_iterator
+		value = begin (),
+		last  = end ();
+	 value != last;
+	 ++value)
+	if (value->is_Array ())
+		static_cast<const Array&>(*value).build_depth_offsets ();
 }
 
 /*******************************************************************************
@@ -2143,7 +2560,21 @@ Array::Depth_Iterator::Depth_Iterator
 	const Array&	array
 	)
 	:	Current_Position ((const_cast<Array&>(array)).begin ()),
-		Current_Array (const_cast<Array*>(&array))
+		Current_Array (const_cast<Array*>(&array)),
+		Depth (0),
+		Parent_Traversal (false)
+{
+}
+
+Array::Depth_Iterator::Depth_Iterator
+	(
+	const Array&	array,
+	bool			parent_traversal
+	)
+	:	Current_Position ((const_cast<Array&>(array)).begin ()),
+		Current_Array (const_cast<Array*>(&array)),
+		Depth (0),
+		Parent_Traversal (parent_traversal)
 {
 }
 
@@ -2157,7 +2588,7 @@ if (! top)
 	throw Error
 		("Can't get the end of an invalid Depth_Iterator", Value::ID);
 Depth_Iterator
-	depth_iterator (*top);
+	depth_iterator (*top, Parent_Traversal);
 depth_iterator.Current_Position = top->end ();
 return depth_iterator;
 }
@@ -2174,32 +2605,21 @@ if (Current_Position != list_iterator)
 	if (Current_Array->end () == list_iterator)
 		{
 		Current_Position = list_iterator;
-		if (! Previous_Position.empty ())
+		if (Depth)
 			{
 			if (Current_Array->empty ())
 				{
 				//	Increment to a valid position.
 				do
 					{
-					/*	Ascend to the Previous_Position in the parent Array.
+					/*	Ascend to the position in the parent Array.
 						The pre-increment will then move to the next Value
 						in the parent Array's Value_List.
 					*/
-					Current_Position = Previous_Position.back ();
-					Previous_Position.pop_back ();
-					if (! (Current_Array = Current_Position->parent ()))
-						{
-						ostringstream
-							message;
-						message << "Depth_Iterator increment found no parent for" << endl
-								<< "  \"" << *Current_Position << "\".";
-						if (message.str ().size () > 150)
-							message.str (message.str ().substr (0, 150) + " ...\".");
-						throw Error (message.str (), Value::ID);
-						}
+					ascend ("increment");
 					}
 					while (++Current_Position == Current_Array->end () &&
-							! Previous_Position.empty ());
+							Depth);
 				}
 			else
 				//	Back off from the end.
@@ -2212,39 +2632,28 @@ if (Current_Position != list_iterator)
 		}
 	else
 		{
-		//	Try to find the list_iterator in the scope of this Depth_Iterator.
-		Depth_Iterator
-			position (*this);
-		try
-			{
-			while (--*this != list_iterator) ;
-			}
-		catch (Out_of_Range out_of_range)
+		//	Find the list_iterator in the scope of this Depth_Iterator.
+		size_type
+			position;
+		try {position = list_position (list_iterator);}
+		catch (Out_of_Range exception)
 			{
-			try
-				{
-				*this = position;
-				while (++*this != list_iterator) ;
-				}
-			catch (Out_of_Range exception)
-				{
-				*this = position;
-				ostringstream
-					message;
-				message << "Can't assign the Array iterator at \""
-						<< *list_iterator << "\"";
-				if (message.str ().size () > 75)
-					message.str (message.str ().substr (0, 75) + " ...\"");
-				message << endl
-						<< "  to the Depth_Iterator at \""
-						<< *Current_Position << "\".";
-				if (message.str ().size () > 150)
-					message.str (message.str ().substr (0, 150) + " ...\".");
-				message << endl
-						<< "  The former is not in the scope of the later.";
-				throw Invalid_Argument (message.str (), Value::ID);
-				}
+			ostringstream
+				message;
+			message << "Can't assign the Array iterator at \""
+					<< *list_iterator << "\"";
+			if (message.str ().size () > 75)
+				message.str (message.str ().substr (0, 75) + " ...\"");
+			message << endl
+					<< "  to the Depth_Iterator at \""
+					<< *Current_Position << "\".";
+			if (message.str ().size () > 150)
+				message.str (message.str ().substr (0, 150) + " ...\".");
+			message << endl
+					<< "  The former is not in the scope of the later.";
+			throw Invalid_Argument (message.str (), Value::ID);
 			}
+		depth_position (position);
 		}
 	}
 return *this;
@@ -2257,10 +2666,177 @@ return *this;
 Array*
 Array::Depth_Iterator::root () const
 {
-if (Previous_Position.empty ())
+if (! Depth)
 	return Current_Array;
-else
+if (! Parent_Traversal)
 	return Previous_Position[0]->parent ();
+Array
+	*array = Current_Array;
+for (unsigned int
+		level = Depth;
+		level && array;
+		level--)
+	array = array->parent ();
+return array;
+}
+
+//	Depth-first offset of the current position.
+Array::size_type
+Array::Depth_Iterator::depth_position () const
+{
+if (Parent_Traversal)
+	return list_position (Current_Position);
+Array
+	*array = root ();
+size_type
+	position = 0;
+for (Position_Stack::const_iterator
+		previous = Previous_Position.begin ();
+		previous != Previous_Position.end ();
+		++previous)
+	{
+	//	The offset of the enclosing Array, and the Array itself.
+	position += array->depth_offset (*previous - array->begin ()) + 1;
+	array = static_cast<Array*>(previous->operator-> ());
+	}
+return position
+	+ array->depth_offset (Current_Position - array->begin ());
+}
+
+//	Reposition at a depth-first offset.
+void
+Array::Depth_Iterator::depth_position
+	(
+	size_type	position
+	)
+{
+Array
+	*top = root ();
+Previous_Position.clear ();
+Depth = 0;
+Current_Array = top;
+if (position >= top->total_size ())
+	{
+	Current_Position = top->end ();
+	return;
+	}
+while (true)
+	{
+	Current_Position = Current_Array->begin ()
+		+ Current_Array->depth_index (position);
+	if (! position)
+		break;
+	//	Descend into the Array that contains the position.
+	descend ();
+	--position;
+	}
+}
+
+//	Depth-first offset of a list iterator position.
+Array::size_type
+Array::Depth_Iterator::list_position
+	(
+	const Array::iterator&	list_iterator
+	)
+	const
+{
+Array
+	*top = root (),
+	*array;
+if (list_iterator == top->end ())
+	return top->total_size ();
+if (list_iterator == Current_Array->end ())
+	array = Current_Array;
+else
+	array = list_iterator->parent ();
+size_type
+	position = 0;
+if (array)
+	position = array->depth_offset (list_iterator - array->begin ());
+while (array &&
+		array != top)
+	{
+	Array
+		*parent = array->parent ();
+	if (! parent)
+		break;
+	/*	The index of the Array in its parent's list is taken from the
+		current path when it is there; otherwise it is searched for.
+	*/
+	Position_Stack::const_iterator
+		previous = Previous_Position.begin ();
+	while (previous != Previous_Position.end () &&
+			previous->operator-> () != array)
+		++previous;
+	size_type
+		index = (previous != Previous_Position.end ()) ?
+			(*previous - parent->begin ()) :
+			(std::find (parent->vector_base ().begin (),
+				parent->vector_base ().end (), array)
+				- parent->vector_base ().begin ());
+	position += parent->depth_offset (index) + 1;
+	array = parent;
+	}
+if (array != top)
+	throw Out_of_Range
+		(
+		"The Array iterator is not in the scope\n"
+		"  of the Depth_Iterator root Array.",
+		Value::ID
+		);
+return position;
+}
+
+//	Descend into the Array at the current position.
+void
+Array::Depth_Iterator::descend ()
+{
+if (! Parent_Traversal)
+	Previous_Position.push_back (Current_Position);
+++Depth;
+Current_Array = static_cast<Array*>(Current_Position.operator-> ());
+}
+
+//	Ascend to the position of the current Array in its parent.
+void
+Array::Depth_Iterator::ascend
+	(
+	const char*	operation
+	)
+{
+Array
+	*parent;
+if (Parent_Traversal)
+	{
+	if ((parent = Current_Array->parent ()))
+		Current_Position = parent->begin ()
+			+ (std::find (parent->vector_base ().begin (),
+				parent->vector_base ().end (), Current_Array)
+				- parent->vector_base ().begin ());
+	}
+else
+	{
+	Current_Position = Previous_Position.back ();
+	Previous_Position.pop_back ();
+	parent = Current_Position->parent ();
+	}
+if (! parent)
+	{
+	ostringstream
+		message;
+	message << "Depth_Iterator " << operation << " found no parent for" << endl
+			<< "  \"";
+	if (Parent_Traversal)
+		message << *Current_Array;
+	else
+		message << *Current_Position;
+	message << "\".";
+	if (message.str ().size () > 150)
+		message.str (message.str ().substr (0, 150) + " ...\".");
+	throw Error (message.str (), Value::ID);
+	}
+Current_Array = parent;
+--Depth;
 }
 
 /*------------------------------------------------------------------------------
@@ -2272,7 +2848,7 @@ Array::Depth_Iterator::operator++ ()
 {
 if (! Current_Array)
 	throw Error ("Can't increment an invalid Depth_Iterator", Value::ID);
-if (! Previous_Position.empty () ||
+if (Depth ||
 	Current_Position != Current_Array->end ())
 	{
 	if (Current_Position->is_Array () &&
@@ -2282,34 +2858,21 @@ if (! Previous_Position.empty () ||
 			Save the current position, then
 			descend to the first Value in this Array.
 		*/
-		Previous_Position.push_back (Current_Position);
-		Current_Array =
-			static_cast<Array*>(Current_Position.operator-> ());
+		descend ();
 		Current_Position = Current_Array->begin ();
 		}
 	else
 		{
 		//	Pre-increment to the next position.
 		while (++Current_Position == Current_Array->end () &&
-				! Previous_Position.empty ())
+				Depth)
 			{
 			/*	End of the current Value_List in a child Array.
-				Ascend to the Previous_Position in the parent Array.
+				Ascend to the position in the parent Array.
 				The pre-increment will then move to the next Value
 				in the parent Array's Value_List.
 			*/
-			Current_Position = Previous_Position.back ();
-			Previous_Position.pop_back ();
-			if (! (Current_Array = Current_Position->parent ()))
-				{
-				ostringstream
-					message;
-				message << "Depth_Iterator increment found no parent for" << endl
-						<< "  \"" << *Current_Position << "\".";
-				if (message.str ().size () > 150)
-					message.str (message.str ().substr (0, 150) + " ...\".");
-				throw Error (message.str (), Value::ID);
-				}
+			ascend ("increment");
 			}
 		}
 	return *this;
@@ -2330,30 +2893,19 @@ Array::Depth_Iterator::next_sibling ()
 if (! Current_Array)
 	throw Error
 		("No next siblilng for an invalid Depth_Iterator", Value::ID);
-if (! Previous_Position.empty () ||
+if (Depth ||
 	Current_Position != Current_Array->end ())
 	{
 	//	Pre-increment to the next position.
 	while (++Current_Position == Current_Array->end () &&
-			! Previous_Position.empty ())
+			Depth)
 		{
 		/*	End of the current Value_List in a child Array.
-			Ascend to the Previous_Position in the parent Array.
+			Ascend to the position in the parent Array.
 			The pre-increment will then move to the next Value
 			in the parent Array's Value_List.
 		*/
-		Current_Position = Previous_Position.back ();
-		Previous_Position.pop_back ();
-		if (! (Current_Array = Current_Position->parent ()))
-			{
-			ostringstream
-				message;
-			message << "Depth_Iterator next sibling found no parent for" << endl
-					<< "  \"" << *Current_Position << "\".";
-			if (message.str ().size () > 150)
-				message.str (message.str ().substr (0, 150) + " ...\".");
-			throw Error (message.str (), Value::ID);
-			}
+		ascend ("next sibling");
 		}
 	return *this;
 	}
@@ -2382,7 +2934,7 @@ Array::Depth_Iterator::operator-- ()
 {
 if (! Current_Array)
 	throw Error ("Can't decrement an invalid Depth_Iterator", Value::ID);
-if (! Previous_Position.empty () ||
+if (Depth ||
 	Current_Position != Current_Array->begin ())
 	{
 	if (Current_Position == Current_Array->begin ())
@@ -2390,18 +2942,7 @@ if (! Previous_Position.empty () ||
 		/*	The current position is the beginning of a child array.
 			Ascend to the previous position in the parent array.
 		*/
-		Current_Position = Previous_Position.back ();
-		Previous_Position.pop_back ();
-		if (! (Current_Array = Current_Position->parent ()))
-			{
-			ostringstream
-				message;
-			message << "Depth_Iterator decrement found no parent for" << endl
-					<< "  \"" << *Current_Position << "\".";
-			if (message.str ().size () > 150)
-				message.str (message.str ().substr (0, 150) + " ...\".");
-			throw Error (message.str (), Value::ID);
-			}
+		ascend ("decrement");
 		}
 	else
 		{
@@ -2415,9 +2956,7 @@ if (! Previous_Position.empty () ||
 				The pre-decrement will back to the last Value in the
 				Array's Value_List.
 			*/
-			Previous_Position.push_back (Current_Position);
-			Current_Array =
-				static_cast<Array*>(Current_Position.operator-> ());
+			descend ();
 			Current_Position = Current_Array->end ();
 			}
 		}
@@ -2439,26 +2978,13 @@ Array::Depth_Iterator::previous_sibling ()
 if (! Current_Array)
 	throw Error
 		("No previous sibling for an invalid Depth_Iterator", Value::ID);
-if (! Previous_Position.empty () ||
+if (Depth ||
 	Current_Position != Current_Array->begin ())
 	{
 	//	Pre-decrement to the previous position.
 	while (Current_Position == Current_Array->begin () &&
-			! Previous_Position.empty ())
-		{
-		Current_Position = Previous_Position.back ();
-		Previous_Position.pop_back ();
-		if (! (Current_Array = Current_Position->parent ()))
-			{
-			ostringstream
-				message;
-			message << "Depth_Iterator previous sibling found no parent for" << endl
-					<< "  \"" << *Current_Position << "\".";
-			if (message.str ().size () > 150)
-				message.str (message.str ().substr (0, 150) + " ...\".");
-			throw Error (message.str (), Value::ID);
-			}
-		}
+			Depth)
+		ascend ("previous sibling");
 	return *this;
 	}
 ostringstream
@@ -2495,12 +3021,31 @@ Array::Depth_Iterator::operator+=
 	int		distance
 	)
 {
-if (distance > 0)
-	while (distance--)
-		++*this;
-else
-	while (distance++)
-		--*this;
+if (! Current_Array)
+	throw Error
+		("Can't offset an invalid Depth_Iterator", Value::ID);
+if (distance == 1)
+	return ++*this;
+if (distance == -1)
+	return --*this;
+if (distance)
+	{
+	size_type
+		position = depth_position ();
+	if ((distance < 0 &&
+			position < (size_type)-distance) ||
+		(distance > 0 &&
+			root ()->total_size () - position < (size_type)distance))
+		{
+		ostringstream
+			message;
+		message << "Can't offset a Depth_Iterator by " << distance
+				<< " from position " << position << endl
+				<< "  of its root Array.";
+		throw Out_of_Range (message.str (), Value::ID);
+		}
+	depth_position (position + distance);
+	}
 return *this;
 }
 
@@ -2537,27 +3082,9 @@ Array::Depth_Iterator::operator-
 	const Array::iterator&	list_iterator
 	) const
 {
-int
-	distance;
-Depth_Iterator
-	position;
-try
-	{
-	for (distance = 0,
-		 position = *this;
-		 position != list_iterator;
-		 --position,
-		 ++distance) ;
-	}
-catch (Out_of_Range exception)
-	{
-	for (distance = 0,
-		 position = *this + 1;
-		 position != list_iterator;
-		 ++position,
-		 --distance) ;
-	}
-return distance;
+if (*this == list_iterator)
+	return 0;
+return (int)depth_position () - (int)list_position (list_iterator);
 }
 
 int
@@ -2565,7 +3092,11 @@ Array::Depth_Iterator::operator-
 	(
 	const Depth_Iterator&	depth_iterator
 	) const
-{return operator- (depth_iterator.Current_Position);}
+{
+if (root () == depth_iterator.root ())
+	return (int)depth_position () - (int)depth_iterator.depth_position ();
+return operator- (depth_iterator.Current_Position);
+}
 
 /*------------------------------------------------------------------------------
 	Logical operators
@@ -2575,7 +3106,11 @@ Array::Depth_Iterator::operator<
 	(
 	const Depth_Iterator& 	depth_iterator
 	) const
-{return *this < depth_iterator.Current_Position;}
+{
+if (root () == depth_iterator.root ())
+	return depth_position () < depth_iterator.depth_position ();
+return *this < depth_iterator.Current_Position;
+}
 
 bool
 Array::Depth_Iterator::operator<
@@ -2585,56 +3120,136 @@ Array::Depth_Iterator::operator<
 {
 if (*this == list_iterator)
 	return false;
-Depth_Iterator
-	position (*this);
-try
-	{
-	while (++position != list_iterator) ;
-	return true;
-	}
+try {return depth_position () < list_position (list_iterator);}
 catch (Out_of_Range exception) {return false;}
 }
 
 /*******************************************************************************
 	Utility functions
 */
+#ifndef DOXYGEN_PROCESSING
+namespace
+{
+bool
+value_less
+	(
+	const Value*	value_1,
+	const Value*	value_2
+	)
+{return *value_1 < *value_2;}
+
+
+//	A String Value with its comparison key.
+struct Keyed_Value
+{
+Value::String_type
+	Key;
+Value
+	*Pointer;
+};
+
+bool
+key_less
+	(
+	const Keyed_Value&	value_1,
+	const Keyed_Value&	value_2
+	)
+{return value_1.Key < value_2.Key;}
+
+
 void
-sort
+sort_values
 	(
 	Array::iterator	first,
-	Array::iterator	last
+	Array::iterator	last,
+	unsigned int	threads
 	)
 {
 if (first == last)
+	return;
+Array::Base_iterator
+	begin = first,
+	end = last,
+	element = begin;
+//	The Value pointers are moved without the Vectal methods.
+if (first->parent ())
+	first->parent ()->invalidate_offsets ();
+while (element != end &&
+		(*element)->is_String ())
+	++element;
+if (element != end)
 	{
+	if (threads == 1)
+		std::stable_sort (begin, end, value_less);
+	else
+		parallel_stable_sort (begin, end, value_less, threads);
 	return;
 	}
-Array::Base_iterator
-	bubble,
-	this_value;
-Value
-	*value;
-for (--last;
-	 first != last;
-	 --last)
+
+/*	String Values are compared by their datum strings, which would
+	otherwise be copied for every comparison.
+*/
+std::vector<Keyed_Value>
+	keyed;
+keyed.reserve (end - begin);
+for (element = begin;
+	 element != end;
+	 ++element)
 	{
-	bubble = first;
-	do
-		{
-		this_value = bubble;
-		 ++bubble;
-		if (**bubble < **this_value)
-			{
-			//	Swap Value pointers.
-			value = *bubble;
-			*bubble = *this_value;
-			*this_value = value;
-			}
-		}
-		while (bubble != last);
+	keyed.push_back (Keyed_Value ());
+	keyed.back ().Key = static_cast<Value::String_type>(**element);
+	keyed.back ().Pointer = *element;
 	}
+if (threads == 1)
+	std::stable_sort (keyed.begin (), keyed.end (), key_less);
+else
+	parallel_stable_sort (keyed.begin (), keyed.end (), key_less, threads);
+element = begin;
+for (std::vector<Keyed_Value>::const_iterator
+		value = keyed.begin ();
+		value != keyed.end ();
+		++value)
+	*element++ = value->Pointer;
 }
 
+
+void
+sort_hierarchy
+	(
+	Array&	array
+	)
+{
+sort_values (array.begin (), array.end (), 1);
+for (Array::iterator
+		value = array.begin ();
+		value != array.end ();
+		++value)
+	if (value->is_Array ())
+		sort_hierarchy (static_cast<Array&>(*value));
+}
+
+}	//	Local namespace
+#endif	//	DOXYGEN_PROCESSING
+
+
+void
+sort
+	(
+	Array::iterator	first,
+	Array::iterator	last
+	)
+{sort_values (first, last, 1);}
+
+
+void
+parallel_sort
+	(
+	Array::iterator	first,
+	Array::iterator	last,
+	unsigned int	threads
+	)
+{sort_values (first, last, threads);}
+
 void
 sort
 	(
@@ -2655,9 +3270,7 @@ sort (static_cast<Array::iterator>(first), static_cast<Array::iterator>(last));
 while (first != last)
 	{
 	if (first->is_Array ())
-		sort (
-			(static_cast<Array&>(*first)).begin (),
-			(static_cast<Array&>(*first)).end ());
+		sort_hierarchy (static_cast<Array&>(*first));
 	++first;
 	}
 }
@@ -26,9 +26,13 @@ CVS ID: Value.hh,v 1.54 2013/09/17 03:52:51 castalia Exp
 #include	"Utility/Types.hh"
 #include	"PVL/PVL_Exceptions.hh"
 #include	"PVL/Vectal.hh"
+#include	"PVL/Arena.hh"
+#include	"PVL/Symbol.hh"
+#include	"PVL/Small_Stack.hh"
 
 #include	<string>
 #include	<iostream>	//	Needed for default cin and cout arguments.
+#include	<atomic>
 
 
 namespace idaeim
@@ -38,6 +42,7 @@ namespace PVL
 //	Forward references.
 class Array;
 class Parser;
+class Parameter;
 
 /*=*****************************************************************************
 	Value
@@ -98,6 +103,7 @@ class Parser;
 class Value
 {
 friend class Array;
+friend class Assignment;
 
 public:
 /*==============================================================================
@@ -208,6 +214,7 @@ enum
 */
 Value (const std::string& units = "", const int digits = 0, const int base = 10)
 	:	Parent (NULL),
+		Owner (NULL),
 		Units (units),
 		Digits (digits),
 		Base ((base < MIN_BASE || base > MAX_BASE) ? 0 : base)
@@ -223,24 +230,43 @@ Value (const std::string& units = "", const int digits = 0, const int base = 10)
 */
 explicit Value (const int digits, const int base = 10)
 	:	Parent (NULL),
-		Units (""),
+		Owner (NULL),
+		Units (),
 		Digits (digits),
 		Base ((base < MIN_BASE || base > MAX_BASE) ? 0 : base)
 	{}
 
 /**	Constructs a Value as a copy of another Value.
 
-	<b>N.B.</b>: The Parent is not copied; the new Value has no parent.
+	<b>N.B.</b>: The Parent is not copied; the new Value has no parent
+	or owner.
 
 	@param	value	The Value to copy.
 */
 Value (const Value& value)
 	:	Parent (NULL),	// Never inherit the parent.
+		Owner (NULL),
 		Units (value.Units),
 		Digits (value.Digits),
 		Base (value.Base)
 	{}
 
+/**	Constructs a Value by moving the contents of another Value.
+
+	The Units Symbol is moved; the other characteristics are copied.
+	<b>N.B.</b>: The Parent is not moved; the new Value has no parent
+	or owner.
+
+	@param	value	The Value to move.
+*/
+Value (Value&& value) noexcept
+	:	Parent (NULL),	// Never inherit the parent.
+		Owner (NULL),
+		Units (std::move (value.Units)),
+		Digits (value.Digits),
+		Base (value.Base)
+	{}
+
 /**	Creates a Value clone of the Value.
 
 	This method is required by the Array Vectal.
@@ -253,6 +279,27 @@ virtual Value* clone () const = 0;
 virtual ~Value ()
 	{}
 
+/**	Allocates memory for a Value.
+
+	The memory is obtained from the {@link Arena::current() current
+	Arena}, if there is one, or the heap.
+
+	@param	size	The size of the Value object.
+	@return	A pointer to the memory for the Value.
+	@see	Arena::allocate_node(std::size_t)
+*/
+static void* operator new (std::size_t size)
+	{return Arena::allocate_node (size);}
+
+/**	Releases the memory for a Value.
+
+	@param	value	A pointer to the memory for the Value.
+	@param	size	The size of the Value object.
+	@see	Arena::release_node(void*, std::size_t)
+*/
+static void operator delete (void* value, std::size_t size)
+	{Arena::release_node (value, size);}
+
 /*==============================================================================
 	Accessors
 */
@@ -273,6 +320,30 @@ virtual ~Value ()
 Array* parent () const
 	{return Parent;}
 
+/**	Gets the Parameter that owns the Value.
+
+	Only the Value of an Assignment has an owner; the Values contained
+	in an Array have a parent instead.
+
+	@return	A pointer to the owning Assignment Parameter (NULL if the
+		value has no owner).
+	@see	invalidate_hash()
+*/
+Parameter* owner () const
+	{return Owner;}
+
+/**	Discards the saved structural hash of the Assignment that owns this
+	Value, or the outermost Array that contains it.
+
+	The methods that change the type, units or datum of a Value, or
+	the Values contained in an Array, do this; it only needs to be
+	used when the Values are moved about directly in the underlying
+	vector of an Array.
+
+	@see	Parameter::structural_hash()
+*/
+void invalidate_hash ();
+
 /**	Tests if the Value has children Values.
 
 	@return	true if the Value {@link is_Array() is an Array}
@@ -586,7 +657,25 @@ std::string nearest_units () const;
 	@return	This Value.
 */
 Value& units (const std::string& units)
-	{Units = units; return *this;}
+	{Units = units; invalidate_hash (); return *this;}
+
+/**	Gets the units Symbol for the Value.
+
+	@return	A reference to the Symbol for the units of the Value.
+*/
+const Symbol& units_symbol () const
+	{return Units;}
+
+/**	Sets the units description for the Value from a Symbol.
+
+	If the Symbol is {@link Symbol::intern(const std::string&) interned}
+	the Value units will be too.
+
+	@param	units	The units Symbol.
+	@return	This Value.
+*/
+Value& units (const Symbol& units)
+	{Units = units; invalidate_hash (); return *this;}
 
 /*------------------------------------------------------------------------------
 	Digits
@@ -611,6 +700,33 @@ int digits () const
 Value& digits (const int digits)
 	{Digits = digits; return *this;}
 
+/*------------------------------------------------------------------------------
+	Memory usage
+*/
+/**	Gets the memory used by the Value.
+
+	The Value node and its units and datum are included. For an Array
+	the Value list and the Values it contains are included as well.
+	The allocation overhead of this Value node itself is not included
+	since the Value need not have been allocated by new.
+
+	@return	A Memory_Usage for the Value.
+	@see	add_memory_usage(Memory_Usage&) const
+*/
+Memory_Usage memory_usage () const
+	{Memory_Usage usage; add_memory_usage (usage); return usage;}
+
+/**	Adds the memory used by the Value to a Memory_Usage.
+
+	The Value units are added here; each type of Value adds its node
+	and datum.
+
+	@param	usage	The Memory_Usage to which the Value memory is added.
+	@see	memory_usage() const
+*/
+virtual void add_memory_usage (Memory_Usage& usage) const
+	{usage.Strings += Units.memory_usage ();}
+
 /*==============================================================================
 	Operators
 */
@@ -644,6 +760,19 @@ virtual const Value& operator[] (unsigned int index) const;
 */
 virtual Value& operator= (const Value& value) = 0;
 
+/**	Moves another Value into this Value.
+
+	By default the Value is {@link operator=(const Value&) assigned};
+	subclasses with contents that can be taken over without copying
+	override this method.
+
+	@param	value	The Value to be moved.
+	@see	String::operator=(Value&&)
+	@see	Array::operator=(Value&&)
+*/
+virtual Value& operator= (Value&& value)
+	{return operator= (static_cast<const Value&>(value));}
+
 /**	Assigns an int value to this Value.
 
 	@param	value	The int value to be assigned.
@@ -996,11 +1125,18 @@ protected:
 */
 Array				*Parent;
 
+/**	The Assignment Parameter that owns this Value,
+	or NULL if the Value is not the Value of an Assignment.
+
+	@see	invalidate_hash()
+*/
+Parameter			*Owner;
+
 /**	The units description string.
 
 	@see	units(const std::string&)
 */
-std::string			Units;
+Symbol				Units;
 
 /**	The number of digits in the Value representation.
 
@@ -1366,6 +1502,16 @@ Integer (const Value& value);
 Integer* clone () const
 	{return new Integer (*this);}
 
+//	Memory usage
+
+/**	Adds the memory used by this Integer to a Memory_Usage.
+
+	@param	usage	The Memory_Usage to which the Integer memory is added.
+	@see	Value::memory_usage() const
+*/
+void add_memory_usage (Memory_Usage& usage) const
+	{Value::add_memory_usage (usage); usage.Nodes += sizeof (Integer);}
+
 //	Type conversion
 
 /**	Casts the Integer to an int type.
@@ -1441,7 +1587,7 @@ bool is_signed () const
 	@return	This Integer.
 */
 Integer& is_signed (const bool sign)
-	{Signed = sign; return *this;}
+	{Signed = sign; invalidate_hash (); return *this;}
 
 //	Subtype
 
@@ -1504,7 +1650,7 @@ Integer& operator= (const Value& value);
 	@return	This Integer.
 */
 Integer& operator= (const int value)
-	{Datum = value; return *this;}
+	{Datum = value; invalidate_hash (); return *this;}
 
 /**	Assigns an unsigned int type value to this Integer.
 
@@ -1516,7 +1662,7 @@ Integer& operator= (const int value)
 	@return	This Integer.
 */
 Integer& operator= (const unsigned int value)
-	{Datum = value; Signed = UNSIGNED; return *this;}
+	{Datum = value; Signed = UNSIGNED; invalidate_hash (); return *this;}
 
 /**	Assigns an Integer_type value to this Integer.
 
@@ -1526,7 +1672,7 @@ Integer& operator= (const unsigned int value)
 	@return	This Integer.
 */
 Integer& operator= (const Integer_type value)
-	{Datum = value; return *this;}
+	{Datum = value; invalidate_hash (); return *this;}
 
 #ifdef idaeim_LONG_LONG_INTEGER
 /**	Assigns a long type value to this Integer.
@@ -1537,7 +1683,7 @@ Integer& operator= (const Integer_type value)
 	@return	This Integer.
 */
 Integer& operator= (const long value)
-	{Datum = value; return *this;}
+	{Datum = value; invalidate_hash (); return *this;}
 
 /**	Assigns an unsigned long type value to this Integer.
 
@@ -1549,7 +1695,7 @@ Integer& operator= (const long value)
 	@return	This Integer.
 */
 Integer& operator= (const unsigned long value)
-	{Datum = value; Signed = UNSIGNED; return *this;}
+	{Datum = value; Signed = UNSIGNED; invalidate_hash (); return *this;}
 #endif
 
 #ifdef idaeim_LONG_DOUBLE
@@ -1562,7 +1708,7 @@ Integer& operator= (const unsigned long value)
 	@return	This Integer.
 */
 Integer& operator= (const double value)
-	{Datum = static_cast<Integer_type>(value); return *this;}
+	{Datum = static_cast<Integer_type>(value); invalidate_hash (); return *this;}
 #endif
 
 /**	Assigns a Real_type value to this Integer.
@@ -1574,7 +1720,7 @@ Integer& operator= (const double value)
 	@return	This Integer.
 */
 Integer& operator= (const Real_type value)
-	{Datum = static_cast<Integer_type>(value); return *this;}
+	{Datum = static_cast<Integer_type>(value); invalidate_hash (); return *this;}
 
 /**	Assigns a string representation of a value to this Integer.
 
@@ -1736,6 +1882,16 @@ Real (const Value& value);
 Real* clone () const
 	{return new Real (*this);}
 
+//	Memory usage
+
+/**	Adds the memory used by this Real to a Memory_Usage.
+
+	@param	usage	The Memory_Usage to which the Real memory is added.
+	@see	Value::memory_usage() const
+*/
+void add_memory_usage (Memory_Usage& usage) const
+	{Value::add_memory_usage (usage); usage.Nodes += sizeof (Real);}
+
 //	Type conversion
 
 /**	Casts the Real to an Integer_type type.
@@ -1856,7 +2012,7 @@ Real& operator= (const Value& value);
 	@return	This Real.
 */
 Real& operator= (const int value)
-	{Datum = value; return *this;}
+	{Datum = value; invalidate_hash (); return *this;}
 
 /**	Assigns an unsigned int type value to this Real.
 
@@ -1866,7 +2022,7 @@ Real& operator= (const int value)
 	@return	This Real.
 */
 Real& operator= (const unsigned int value)
-	{Datum = value; return *this;}
+	{Datum = value; invalidate_hash (); return *this;}
 
 #ifdef idaeim_LONG_LONG_INTEGER
 /**	Assigns a long type value to this Real.
@@ -1877,7 +2033,7 @@ Real& operator= (const unsigned int value)
 	@return	This Real.
 */
 Real& operator= (const long value)
-	{Datum = value; return *this;}
+	{Datum = value; invalidate_hash (); return *this;}
 #endif
 
 /**	Assigns an Integer_type value to this Real.
@@ -1888,7 +2044,7 @@ Real& operator= (const long value)
 	@return	This Real.
 */
 Real& operator= (const Integer_type value)
-	{Datum = static_cast<Real_type>(value); return *this;}
+	{Datum = static_cast<Real_type>(value); invalidate_hash (); return *this;}
 
 #ifdef idaeim_LONG_DOUBLE
 /**	Assigns a double value to this Real.
@@ -1899,7 +2055,7 @@ Real& operator= (const Integer_type value)
 	@return	This Real.
 */
 Real& operator= (const double value)
-	{Datum = value; return *this;}
+	{Datum = value; invalidate_hash (); return *this;}
 #endif
 
 /**	Assigns a Real_type value to this Real.
@@ -1910,7 +2066,7 @@ Real& operator= (const double value)
 	@return	This Real.
 */
 Real& operator= (const Real_type value)
-	{Datum = value; return *this;}
+	{Datum = value; invalidate_hash (); return *this;}
 
 /**	Assigns a string representation of a value to this Real.
 
@@ -2208,6 +2364,16 @@ String (const Real_type datum, const int digits = 0);
 */
 String (const String& value);
 
+/**	Constructs a String by moving the contents of another String.
+
+	The datum and units strings are moved; the other String is left
+	with empty strings. The parent is not moved; the new String has no
+	parent.
+
+	@param	value	The String to move.
+*/
+String (String&& value) noexcept;
+
 //		Copy virtual
 
 /**	Constructs a String from another Value.
@@ -2234,6 +2400,20 @@ String (const Value& value);
 String* clone () const
 	{return new String (*this);}
 
+//	Memory usage
+
+/**	Adds the memory used by this String to a Memory_Usage.
+
+	@param	usage	The Memory_Usage to which the String memory is added.
+	@see	Value::memory_usage() const
+*/
+void add_memory_usage (Memory_Usage& usage) const
+	{
+	Value::add_memory_usage (usage);
+	usage.Nodes += sizeof (String);
+	usage.Strings += Memory_Usage::string_size (Datum);
+	}
+
 //	Type conversion
 
 /**	Casts the String to an int.
@@ -2398,6 +2578,35 @@ static Type type (String_type& characters);
 */
 String& operator= (const Value& value);
 
+/**	Assigns a String to this String.
+
+	@param	value	The String to be assigned.
+	@return	This String.
+	@see	operator=(const Value&)
+*/
+String& operator= (const String& value)
+	{return operator= (static_cast<const Value&>(value));}
+
+/**	Moves a Value into this String.
+
+	If the Value is a String its datum and units strings are moved,
+	otherwise the Value is {@link operator=(const Value&) assigned}.
+	The parent is not moved.
+
+	@param	value	The Value to be moved.
+	@return	This String.
+*/
+String& operator= (Value&& value);
+
+/**	Moves a String into this String.
+
+	@param	value	The String to be moved.
+	@return	This String.
+	@see	operator=(Value&&)
+*/
+String& operator= (String&& value)
+	{return operator= (static_cast<Value&&>(value));}
+
 /**	Assigns an int value to this String.
 
 	The datum for this String is assigned the string representation of
@@ -2652,6 +2861,16 @@ explicit Array (const Type type = Default_Subtype);
 */
 Array (const Array& array);
 
+/**	Constructs an Array by moving the contents of another Array.
+
+	The Values of the Array being moved are {@link move_in(Array&)
+	moved in} to the new Array; they are not cloned. The other Array
+	is left empty.
+
+	@param	array	The Array to move.
+*/
+Array (Array&& array);
+
 /**	Constructs an Array from another Value.
 
 	If the Value being copied is an Array, it is assigned to the new
@@ -2678,6 +2897,12 @@ Array (const Value& value);
 */
 Array (Parser& parser, const Type type = Default_Subtype);
 
+/**	Destroys an Array by clearing the Value list.
+
+	Each Value in the list will be deleted.
+*/
+~Array ();
+
 //		Clone
 
 /**	Constructs a clone of this Array.
@@ -2689,6 +2914,20 @@ Array (Parser& parser, const Type type = Default_Subtype);
 Array* clone () const
 	{return new Array (*this);}
 
+//	Memory usage
+
+/**	Adds the memory used by this Array to a Memory_Usage.
+
+	The Array node, its Value list - the occupied pointers and any
+	unused capacity - and its depth offsets table, if one has been
+	built, are added along with each Value in the list, including the
+	allocation overhead of the Value node.
+
+	@param	usage	The Memory_Usage to which the Array memory is added.
+	@see	Value::memory_usage() const
+*/
+void add_memory_usage (Memory_Usage& usage) const;
+
 //	Type conversion
 
 //!	@throws	Invalid_Argument	An Array can not be cast to a primitive type.
@@ -2829,6 +3068,37 @@ const Value& operator[] (unsigned int index) const
 */
 Array& operator= (const Value& value);
 
+/**	Assigns an Array to this Array.
+
+	@param	array	The Array to be assigned.
+	@return	This Array.
+	@see	operator=(const Value&)
+*/
+Array& operator= (const Array& array)
+	{return operator= (static_cast<const Value&>(array));}
+
+/**	Moves an Array into this Array.
+
+	The same as {@link operator=(const Value&) assignment} except that
+	the Value list of the assigned Array is {@link move_in(Array&)
+	moved in} instead of being cloned. The assigned Array is left
+	empty.
+
+	@param	value	The Value to be moved.
+	@return	This Array.
+	@throws	Invalid_Argument	If the assigned Value is not an Array.
+*/
+Array& operator= (Value&& value);
+
+/**	Moves an Array into this Array.
+
+	@param	array	The Array to be moved.
+	@return	This Array.
+	@see	operator=(Value&&)
+*/
+Array& operator= (Array&& array)
+	{return operator= (static_cast<Value&&>(array));}
+
 //!	@throws	Invalid_Argument	An Array can not be assigned a primitive type.
 Array& operator= (const Integer_type value);
 //!	@throws	Invalid_Argument	An Array can not be assigned a primitive type.
@@ -2945,8 +3215,15 @@ Array& copy_in (const Array& array);
 	the end of this Array's Value list. As a result the source
 	Array will be emptied.
 
+	The Value pointers are moved as a single range, without copying
+	or reallocation when this Array's list is empty, and the {@link
+	total_size() total sizes} are adjusted once for the entire list.
+	Moving an Array into itself has no effect.
+
 	@param	array	The source Array.
 	@return	This Array.
+	@throws Invalid_Argument If a Value to be moved is this Array
+		or one of its parents. Neither Array is changed.
 	@see	add(const Value*)
 */
 Array& move_in (Array& array);
@@ -3022,14 +3299,41 @@ void entering (Value* value);
 */
 void removing (Value* value);
 
-/**	Counts the number of Values in the Array's Value list
+/**	Removes all of the Value pointers, but does not destroy the
+	Values.
+
+	This hides the Vectal's method so that the parent of each Value is
+	reset to NULL and the {@link total_size() total size} of this
+	Array, and of each Array that contains it, is reduced accordingly.
+
+	<b>Warning</b>: It is the user's responsibility to make sure that
+	the Values are properly managed to prevent a memory leak.
+*/
+void wipe ();
+
+/**	Gets the number of Values in the Array's Value list
 	and, recursively, the number of Values in the Value list
 	of each Array in the list.
 
+	The total is maintained as Values enter and leave the Value list
+	of any Array in the hierarchy, so it is obtained in constant time.
+
 	@return	The accumulated total number of Values enclosed by
 		this Array.
 */
-size_type total_size ();
+size_type total_size () const
+	{return Total_Size;}
+
+/**	Marks the depth-first offsets of the Values in this Array as out
+	of date.
+
+	The offsets, which are used to position a {@link Depth_Iterator}
+	in the Array hierarchy, are rebuilt when next needed. Changes made
+	through the Vectal interface methods are detected automatically.
+	However, if Value pointers are moved about directly in the
+	underlying vector of the Array this method must be used.
+*/
+void invalidate_offsets ();
 
 /*==============================================================================
 	Depth_Iterator
@@ -3058,15 +3362,35 @@ size_type total_size ();
 	iteration will not go beyond the initial begin position of the
 	root Array.
 
-	Random-access operators are also provided. But because they are not
-	truely random access, and do not operate in constant time, the
-	Depth_Iterator is tagged as only bidirectional.
+	Random-access operators are also provided. Each Array maintains the
+	{@link total_size() total size} of its hierarchy, and the
+	depth-first offsets of its Values are kept on demand, so a
+	Depth_Iterator is positioned, and the distance between positions is
+	measured, by descending the Array hierarchy rather than by stepping
+	over each Value. These operations take time proportional to the
+	depth of the position times the logarithm of the size of the Value
+	lists along its path.
+
+	The positions in the enclosing Value lists are kept on a stack
+	that holds the first few levels within the Depth_Iterator, so a
+	Depth_Iterator over a typical Array hierarchy is created, copied
+	and moved without allocating memory. A Depth_Iterator constructed
+	for {@link Depth_Iterator(const Array&, bool) parent traversal}
+	keeps no stack; it finds the position of each Array in its
+	parent's Value list when it ascends out of the Array.
 */
 class Depth_Iterator
-:	public std::iterator<std::bidirectional_iterator_tag, Value>
+:	public std::iterator<std::random_access_iterator_tag, Value>
 {
 public:
 
+/**	The stack of positions in the enclosing Value lists.
+
+	Up to eight levels are held within the Depth_Iterator; only a
+	deeper hierarchy causes an allocation.
+*/
+typedef Small_Stack<Array::iterator, 8>	Position_Stack;
+
 //	Constructors
 
 /**	Constructs a Depth_Iterator without a root Array.
@@ -3075,7 +3399,9 @@ public:
 	iterator.
 */
 Depth_Iterator ()
-	:	Current_Array (NULL)
+	:	Current_Array (NULL),
+		Depth (0),
+		Parent_Traversal (false)
 	{}
 
 /**	Constructs a Depth_Iterator for an Array.
@@ -3088,6 +3414,22 @@ Depth_Iterator ()
 */
 explicit Depth_Iterator (const Array& array);
 
+/**	Constructs a Depth_Iterator for an Array with a choice of
+	traversal mode.
+
+	With parent traversal the Depth_Iterator keeps no stack of
+	positions in the enclosing Value lists. Instead, when it ascends
+	out of an Array it uses the Array's parent pointer and searches the
+	parent's Value list for the Array. The positions that the
+	Depth_Iterator moves through are the same in either mode.
+
+	@param	array	The root Array.
+	@param	parent_traversal	true if the Depth_Iterator is to
+		traverse the hierarchy by parent pointers; false if it is to
+		use a stack of positions.
+*/
+Depth_Iterator (const Array& array, bool parent_traversal);
+
 /**	Construct a Depth_Iterator from a normal Array iterator.
 
 	<B>Warning</B>: The iterator must be valid; i.e. it must refer to a
@@ -3096,7 +3438,9 @@ explicit Depth_Iterator (const Array& array);
 */
 Depth_Iterator (const Array::iterator& list_iterator)
 	:	Current_Position (list_iterator),
-		Current_Array ((*list_iterator).parent ())
+		Current_Array ((*list_iterator).parent ()),
+		Depth (0),
+		Parent_Traversal (false)
 	{}
 
 /**	Converts the Depth_Iterator to a Value_List iterator.
@@ -3120,6 +3464,24 @@ Array* root () const;
 Array* array () const
 	{return Current_Array;}
 
+/**	Gets the depth of the current position.
+
+	@return	The number of Arrays between the root Array and the
+		current Array context. This is zero when the current position
+		is in the root Array's Value list.
+*/
+unsigned int depth () const
+	{return Depth;}
+
+/**	Tests if this Depth_Iterator uses parent traversal.
+
+	@return	true if parent pointers are used to ascend the hierarchy;
+		false if a stack of positions is used.
+	@see	Depth_Iterator(const Array&, bool)
+*/
+bool parent_traversal () const
+	{return Parent_Traversal;}
+
 /**	Gets a Depth_Iterator positioned at the end of the traversal
 	for this Depth_Iterator.
 
@@ -3148,13 +3510,10 @@ Depth_Iterator end_depth () const;
 	to the next valid position.
 
 	When the Depth_Iterator and list iterator are not positioned in
-	the same Array, then a search is made for the list iterator
-	position within the scope of the Depth_Iterator. First a search
-	is made from the current Depth_Iterator position towards the
-	beginning of its scope. If this fails a search is made
-	from the current Depth_Iterator position towards the end of its
-	scope. The current position of the Depth_Iterator becomes list
-	iterator position if it is found.
+	the same Array, then the list iterator position is located within
+	the scope of the Depth_Iterator by ascending from the Array
+	containing it to the root Array. The current position of the
+	Depth_Iterator becomes list iterator position if it is found.
 
 	@param	list_iterator	The Value_List iterator position
 		to be assigned to this Depth_Iterator.
@@ -3334,16 +3693,20 @@ Value&          operator[] (int offset) const;
 
 /**	Relocates the current position by the specified distance.
 
-	The Depth_Iterator is incremented for a positive distance,
-	or decremented for a negative distance, repeatedly the
-	absolute amount of the distance.
-
-	<b>Note</b>: This is a random-access iterator operator
-	that does not occur in constant time.
+	The new position is the same as would be reached by incrementing
+	the Depth_Iterator for a positive distance, or decrementing it for
+	a negative distance, the absolute amount of the distance. However,
+	the position is found by descending from the root Array to the
+	Value at the new depth-first offset.
 
 	@param	distance	The number of increment (positive) or
 		decrement (negative) operations to apply.
 	@return	This Depth_Iterator.
+	@throws	Out_of_Range	If the new position would be before the
+		beginning or beyond the end of the root Array. The
+		Depth_Iterator is not moved.
+	@throws	Error	If the Depth_Iterator is invalid (doesn't have a
+		root Array).
 	@see	operator++()
 	@see	operator--()
 */
@@ -3392,12 +3755,9 @@ int operator- (const Depth_Iterator& depth_iterator) const;
 /**	Get the distance between this Depth_Iterator and an
 	Array list iterator.
 
-	A search is made for the list iterator position in the
-	scope of this Depth_Iterator; first backwards (positive
-	distance), and then forwards (negative distance).
-
-	<b>Note</b>: This is a random-access iterator operator
-	that does not occur in constant time.
+	The depth-first offset of the list iterator position is found by
+	ascending from the Array containing it to the root Array of this
+	Depth_Iterator.
 
 	@param	list_iterator	An Array::iterator position
 		to find.
@@ -3474,13 +3834,11 @@ bool operator<  (const Depth_Iterator& depth_iterator) const;
 /**	Tests if the current position of this Depth_Iterator is
 	less than the position of an Array list iterator.
 
-	A copy of this Depth_Iterator is incremented forward searching
-	for the list iterator position.
+	The depth-first offsets of the two positions are compared.
 
-	<b>Note</b>: This is a random-access iterator operator that does
-	not occur in constant time. This is always more, often much more,
-	expensive that the == (or !=) test. The latter should be used
-	whenever possible (e.g. in loop conditions).
+	<b>Note</b>: This is always more expensive that the == (or !=)
+	test. The latter should be used whenever possible (e.g. in loop
+	conditions).
 
 	@param	list_iterator	The Array::iterator to compare against.
 	@return	true if the list_iterator position is found; false otherwise.
@@ -3556,12 +3914,31 @@ bool operator>= (const Array::iterator& list_iterator) const
 //..............................................................................
 private:
 
+//	The depth-first offset of the current position from the root.
+size_type depth_position () const;
+
+//	Moves to a depth-first offset from the root.
+void depth_position (size_type position);
+
+//	The depth-first offset of a list iterator position from the root.
+size_type list_position (const Array::iterator& list_iterator) const;
+
+//	Descends into the Array at the current position.
+void descend ();
+
+//	Ascends to the position of the current Array in its parent.
+void ascend (const char* operation);
+
 Array::iterator
 	Current_Position;
 Array
 	*Current_Array;
-std::vector<Array::iterator>
+Position_Stack
 	Previous_Position;
+unsigned int
+	Depth;
+bool
+	Parent_Traversal;
 };		//	End of Depth_Iterator class.
 
 /**	Gets a Depth_Iterator positioned at the beginning of this Array.
@@ -3582,6 +3959,35 @@ private:
 Type		Subtype;
 static Type	Default_Subtype;
 
+//	Total number of Values in the hierarchy.
+size_type	Total_Size;
+
+//	Depth-first Value offsets; NULL until needed.
+struct Depth_Offsets;
+mutable std::atomic<Depth_Offsets*>	Offsets;
+
+/*	Changes the total size of this Array and those that contain it,
+	marks their depth-first offsets as out of date, and discards the
+	structural hash of the Assignment that owns them.
+*/
+void total_size_change (size_type amount, bool increase);
+
+//	The depth-first offset of the Value at an index.
+size_type depth_offset (size_type index) const;
+
+/*	The index of the Value that contains a depth-first offset;
+	the offset is reduced to be relative to the Value.
+*/
+size_type depth_index (size_type& offset) const;
+
+/*	Builds the depth-first offsets, if they are kept for the list, and
+	those of the Arrays it contains.
+*/
+void build_depth_offsets () const;
+
+//	A Frozen snapshot builds its depth-first offsets before it is shared.
+friend class Frozen;
+
 };		//	End of Array class.
 
 //	Non-member functions.
@@ -3607,8 +4013,11 @@ inline bool operator<
 */
 /**	Sorts an Array's list iterator range.
 
-	A bubble sort is applied, in place, using the less than (<)
-	comparison for the Values in the interator range [begin, end).
+	A stable merge sort of the Value pointers is applied, in place,
+	using the less than (<) comparison for the Values in the interator
+	range [begin, end). Values that compare equal retain their relative
+	order. When all the Values are Strings their datum strings are
+	obtained once and compared directly.
 
 	@param	begin	The Array::iterator for the first Value
 		where sorting begins.
@@ -3618,13 +4027,30 @@ inline bool operator<
 */
 void sort (Array::iterator begin, Array::iterator end);
 
+/**	Sorts an Array's list iterator range using multiple threads.
+
+	The result is the same as that of {@link sort(Array::iterator,
+	Array::iterator) sort}. Only very large ranges - many thousands of
+	Values - are sorted faster.
+
+	@param	begin	The Array::iterator for the first Value
+		where sorting begins.
+	@param	end		The Array::iterator for the position after the
+		last Value where sorting ends.
+	@param	threads	The maximum number of threads to use. If zero the
+		number of hardware threads is used.
+	@see	parallel_stable_sort(Iterator, Iterator, Less, unsigned int)
+*/
+void parallel_sort (Array::iterator begin, Array::iterator end,
+	unsigned int threads = 0);
+
 /**	Sorts the Values in the iterator range, and all Values
 	in all Arrays contained within the range.
 
 	This is a "deep" sort in that not only are the Values in the
 	Array of the iterator range sorted, but each Array within
-	the range has all of its Values sorted. Each Array has its
-	Values sorted independently (Values never leave their
+	the range has all of its Values sorted, at every depth. Each Array
+	has its Values sorted independently (Values never leave their
 	containing Array). Though the iterator range is defined by a
 	pair of Depth_Iterators, which are used to traverse the entire
 	Array hierarchy, they must both be positioned in the Value
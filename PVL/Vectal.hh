@@ -27,6 +27,12 @@ CVS ID: Vectal.hh,v 1.16 2004/10/26 10:23:05 castalia Exp
 #include	<iterator>
 #include	<string>
 #include	<stdexcept>
+#include	<memory>
+#include	<utility>
+#include	<type_traits>
+#include	<algorithm>
+#include	<thread>
+#include	<exception>
 
 
 namespace idaeim
@@ -205,6 +211,22 @@ class Vectal
 #define VECTAL_CAPACITY_MARGIN 8
 #endif
 
+/**	The default storage capacity {@link Growth_Policy growth policy}.
+
+	With GEOMETRIC_GROWTH the capacity is increased by half again
+	whenever it is exhausted, so appending n values copies O(n) value
+	pointers in total. With MARGIN_GROWTH the capacity is only
+	increased to the next multiple of the #VECTAL_CAPACITY_MARGIN, which
+	keeps the least excess memory but makes appending n values copy
+	O(n<sup>2</sup>) value pointers. Either policy may be selected for
+	any Vectal.
+
+	@see	growth_policy(Growth_Policy)
+*/
+#ifndef VECTAL_GROWTH_POLICY
+#define VECTAL_GROWTH_POLICY GEOMETRIC_GROWTH
+#endif
+
 public:
 
 //	Forward references:
@@ -259,6 +281,15 @@ typedef Reverse_Iterator						reverse_iterator;
 //!	Vectal const reverse iterator.
 typedef Const_Reverse_Iterator					const_reverse_iterator;
 
+//!	Storage capacity growth policies.
+enum Growth_Policy
+	{
+	//!	Grow to the next multiple of the #VECTAL_CAPACITY_MARGIN.
+	MARGIN_GROWTH,
+	//!	Grow by half the size, to the next multiple of the margin.
+	GEOMETRIC_GROWTH
+	};
+
 /*==============================================================================
 	Constructors
 */
@@ -271,9 +302,30 @@ Vectal ()
 	@param	vectal	The Vectal to be copied.
 	@see	operator=(const Vectal&)
 */
-explicit Vectal (const Vectal& vectal) : std::vector<T*> ()
+explicit Vectal (const Vectal& vectal)
+	:	std::vector<T*> (),
+		Growth (vectal.Growth)
 {operator= (vectal);}
 
+/**	Move constructor.
+
+	The value pointers of the source Vectal are taken over; no values
+	are cloned. The source Vectal is left empty.
+
+	<b>N.B.</b>: The {@link entering(pointer) entering method} is not
+	applied to the values that are taken over because a subclass is
+	not yet constructed when this base class constructor runs. A
+	subclass that tracks its values (e.g. by setting a parent pointer)
+	should move the values itself, or re-enter them in its own move
+	constructor.
+
+	@param	vectal	The Vectal to be moved.
+*/
+Vectal (Vectal&& vectal) noexcept
+	:	std::vector<T*> (),
+		Growth (vectal.Growth)
+{Base::swap (vectal.vector_base ());}
+
 private:
 /**	Construct with a number of default elements.
 
@@ -583,6 +635,38 @@ if (this != &vectal)
 return *this;
 }
 
+/**	Moves the values from another Vectal.
+
+	The existing values are destroyed. Then the value pointers of the
+	source Vectal are {@link pull(iterator, iterator) pulled} from it
+	and {@link poke_back(pointer) poked} into this Vectal; no values are
+	cloned. The source Vectal is left empty.
+
+	<b>N.B.</b>: The source values are pulled before the existing
+	values are destroyed so the source Vectal may safely be one of the
+	values contained in this Vectal.
+
+	@param	vectal	A Vectal of the same type as this Vectal.
+	@return	This Vectal.
+*/
+Vectal& operator= (Vectal<value_type>&& vectal)
+{
+if (this != &vectal)
+	{
+	Base
+		values (vectal.vector_base ());
+	vectal.pull (vectal.begin (), vectal.end ());
+	clear ();
+	for (Base_iterator
+			value = values.begin (),
+			last  = values.end ();
+		 value != last;
+		 ++value)
+		poke_back (*value);
+	}
+return *this;
+}
+
 /*------------------------------------------------------------------------------
 	Insert
 */
@@ -687,6 +771,74 @@ void insert (iterator position, InputIterator start, InputIterator stop)
 void push_back (const_reference value)
 {poke_back (value.clone ());}
 
+/**	Pushes a temporary value on the end of the Vectal.
+
+	Instead of cloning the value a new object of the value's static
+	type is move constructed from it. This avoids a deep copy of the
+	value's contents (e.g. the elements of a PVL::Aggregate or
+	PVL::Array), which are taken over by the new object.
+
+	<b>N.B.</b>: The object constructed is of the static type of the
+	argument, which must be a complete type derived from (or the same
+	as) the value_type. Use std::move only on an object of its actual
+	type; otherwise the {@link push_back(const_reference) cloning
+	push_back} should be used.
+
+	@param	value	An rvalue reference to the value to be moved.
+	@see	emplace_back(Arguments&&...)
+*/
+template <typename U>
+typename std::enable_if
+	<
+	! std::is_lvalue_reference<U>::value &&
+	std::is_base_of<value_type, typename std::decay<U>::type>::value
+	>::type
+push_back (U&& value)
+{adopt (std::unique_ptr<value_type>
+	(new typename std::decay<U>::type (std::move (value))));}
+
+/**	Constructs a new value on the end of the Vectal.
+
+	An object of type U is constructed in place from the arguments and
+	its pointer is {@link adopt(std::unique_ptr<value_type>) adopted}.
+	No copy is made.
+
+	@param	arguments	The arguments to be forwarded to the U
+		constructor.
+	@return	A reference to the new value.
+*/
+template <typename U, typename... Arguments>
+U& emplace_back (Arguments&&... arguments)
+{
+U
+	*value = new U (std::forward<Arguments> (arguments)...);
+adopt (std::unique_ptr<value_type> (value));
+return *value;
+}
+
+/**	Takes ownership of a value on the end of the Vectal.
+
+	The value pointer is {@link poke_back(pointer) poked} into the
+	Vectal; the value is not cloned. If the value can not be entered
+	into the Vectal - the {@link entering(pointer) entering method}
+	throws an exception - the value is destroyed.
+
+	@param	value	A std::unique_ptr holding the value to be adopted.
+	@return	A reference to the adopted value.
+	@throws	invalid_argument	If the value pointer is NULL.
+*/
+reference adopt (std::unique_ptr<value_type> value)
+{
+if (! value)
+	throw std::invalid_argument
+		(
+		std::string (ID) + '\n' +
+		"Can not adopt a NULL value."
+		);
+poke_back (value.get ());
+return *value.release ();
+}
+
 /**	Inserts a value pointer (not a value copy) at an iterator position.
 
 	<b>N.B.</b>: The value pointer is provided to the {@link
@@ -694,8 +846,8 @@ void push_back (const_reference value)
 	backing vector.
 
 	If the VECTAL_CAPACITY_MARGIN is not 0 and the allocated storage
-	capacity has been reached, then storage reserve is increased to the
-	next largest multiple of the margin amount.
+	capacity has been reached, then storage reserve is increased
+	according to the {@link growth_policy() growth policy}.
 
 	@param	position	The iterator position where the value pointer
 		will be placed. The position is not range checked.
@@ -777,7 +929,7 @@ return position;
 
 	If the VECTAL_CAPACITY_MARGIN is not 0 and the allocated
 	storage capacity has been reached, then storage reserve is
-	increased to the next largest multiple of the margin amount.
+	increased according to the {@link growth_policy() growth policy}.
 
 	@param	value_pointer	The value pointer to be stored.
 */
@@ -900,6 +1052,49 @@ void clear ()
 void wipe ()
 {Base::clear ();}
 
+protected:
+/**	Moves all of the value pointers of another Vectal to the end of
+	this Vectal.
+
+	The pointers are moved in a single operation: when this Vectal is
+	empty its storage is exchanged with that of the other Vectal, and
+	otherwise the pointers are appended as one range after any
+	capacity that is needed has been reserved according to the {@link
+	growth_policy() growth policy}. Neither the {@link entering(pointer)
+	entering method} nor the {@link removing(pointer) removing method}
+	is applied; this is a bulk transfer for subclasses that account for
+	the values that are moved themselves.
+
+	@param	vectal	The Vectal whose value pointers are to be moved. It
+		is left empty.
+*/
+void splice_back (Vectal& vectal)
+{
+if (&vectal == this ||
+	vectal.Base::empty ())
+	return;
+if (Base::empty ())
+	Base::swap (vectal.vector_base ());
+else
+	{
+	size_type
+		amount = Base::size () + vectal.Base::size ();
+	if (amount > Base::capacity ())
+		{
+		if (Growth == GEOMETRIC_GROWTH)
+			amount += amount / 2;
+#if (VECTAL_CAPACITY_MARGIN != 0)
+		amount += VECTAL_CAPACITY_MARGIN - (amount % VECTAL_CAPACITY_MARGIN);
+#endif
+		Base::reserve (amount);
+		}
+	Base::insert (Base::end (), vectal.Base::begin (), vectal.Base::end ());
+	vectal.Base::clear ();
+	}
+}
+
+public:
+
 /*------------------------------------------------------------------------------
 	Pop/Pull
 */
@@ -1024,9 +1219,30 @@ return value_pointer;
 /*==============================================================================
 	Resize and Replace
 */
+/**	Sets the storage capacity growth policy.
+
+	The policy applies whenever a value is added and the allocated
+	storage capacity has been reached. It does not change the current
+	capacity.
+
+	@param	policy	The Growth_Policy to apply.
+	@return	This Vectal.
+	@see	#VECTAL_GROWTH_POLICY
+*/
+Vectal& growth_policy (Growth_Policy policy)
+{Growth = policy; return *this;}
+
+/**	Gets the storage capacity growth policy.
+
+	@return	The Growth_Policy that is applied.
+	@see	growth_policy(Growth_Policy)
+*/
+Growth_Policy growth_policy () const
+{return Growth;}
+
 private:
-/**	Adjusts the capacity to be the next largest multiple of the
-	#VECTAL_CAPACITY_MARGIN.
+/**	Adjusts the capacity according to the growth policy, to the next
+	largest multiple of the #VECTAL_CAPACITY_MARGIN.
 */
 bool adjust_capacity ()
 {
@@ -1035,6 +1251,8 @@ size_type
 	amount = Base::size ();
 if (amount == Base::capacity ())
 	{
+	if (Growth == GEOMETRIC_GROWTH)
+		amount += amount / 2;
 	amount += VECTAL_CAPACITY_MARGIN - (amount % VECTAL_CAPACITY_MARGIN);
 	Base::reserve (amount);
 	return true;
@@ -2361,6 +2579,155 @@ Const_Reverse_Iterator rbegin () const
 Const_Reverse_Iterator rend () const
 {return Base::rend ();}
 
+/*==============================================================================
+	Data
+*/
+private:
+
+Growth_Policy
+	Growth = VECTAL_GROWTH_POLICY;
+
 };		//	End of Vectal class.
+
+/*=*****************************************************************************
+	Utility functions
+*/
+/**	Stably sorts an iterator range using multiple threads.
+
+	The range is divided into one part for each thread. The parts are
+	sorted at the same time and then merged, pairs of adjacent parts at
+	the same time, until the entire range is sorted. Elements that are
+	equivalent retain their relative order. The result is the same as
+	that of std::stable_sort.
+
+	<b>N.B.</b>: The comparison function is used by several threads at
+	the same time. If a thread can not be started its part of the work
+	is done by the calling thread instead.
+
+	@param	first	A random access iterator for the first element of the
+		range to be sorted.
+	@param	last	A random access iterator for the position after the
+		last element of the range to be sorted.
+	@param	less	A function that returns true if its first argument
+		is to be ordered before its second argument; false otherwise.
+	@param	threads	The maximum number of threads to use. If zero the
+		number of hardware threads is used. No more than one thread is
+		used for each 8192 elements.
+	@throws	std::exception	Any exception thrown by the comparison
+		function is rethrown after all the threads have finished.
+*/
+template <typename Iterator, typename Less>
+void
+parallel_stable_sort
+	(
+	Iterator		first,
+	Iterator		last,
+	Less			less,
+	unsigned int	threads = 0
+	)
+{
+//	The minimum number of elements sorted by each thread.
+const std::size_t
+	PARALLEL_SORT_MINIMUM = 8192;
+
+const std::size_t
+	total = last - first;
+if (! threads)
+	threads = std::thread::hardware_concurrency ();
+if (threads > total / PARALLEL_SORT_MINIMUM)
+	threads = total / PARALLEL_SORT_MINIMUM;
+if (threads < 2)
+	{
+	std::stable_sort (first, last, less);
+	return;
+	}
+
+//	The part boundaries.
+std::vector<Iterator>
+	bounds;
+for (unsigned int
+		part = 0;
+		part <= threads;
+		part++)
+	bounds.push_back (first + (total * part / threads));
+
+std::vector<std::exception_ptr>
+	failures (threads);
+std::vector<std::thread>
+	workers;
+workers.reserve (threads);
+//	Waits for the workers to finish and rethrows any exception.
+auto
+	finish = [&workers, &failures] ()
+	{
+	for (std::size_t
+			worker = 0;
+			worker < workers.size ();
+			worker++)
+		workers[worker].join ();
+	workers.clear ();
+	for (std::size_t
+			part = 0;
+			part < failures.size ();
+			part++)
+		if (failures[part])
+			std::rethrow_exception (failures[part]);
+	};
+
+//	Sort the parts.
+for (unsigned int
+		part = 0;
+		part < threads;
+		part++)
+	{
+	auto
+		task = [&bounds, &less, &failures, part] ()
+		{
+		try {std::stable_sort (bounds[part], bounds[part + 1], less);}
+		catch (...) {failures[part] = std::current_exception ();}
+		};
+	try {workers.emplace_back (task);}
+	catch (...)
+		{
+		//	No more threads; the started workers are still joined.
+		task ();
+		}
+	}
+finish ();
+
+//	Merge adjacent pairs of parts until there is only one part.
+while (bounds.size () > 2)
+	{
+	std::vector<Iterator>
+		merged;
+	for (std::size_t
+			part = 0;
+			part + 2 < bounds.size ();
+			part += 2)
+		{
+		merged.push_back (bounds[part]);
+		auto
+			task = [&bounds, &less, &failures, part] ()
+			{
+			try {std::inplace_merge
+					(bounds[part], bounds[part + 1], bounds[part + 2], less);}
+			catch (...) {failures[part / 2] = std::current_exception ();}
+			};
+		try {workers.emplace_back (task);}
+		catch (...)
+			{
+			//	No more threads; the started workers are still joined.
+			task ();
+			}
+		}
+	if (bounds.size () % 2 == 0)
+		//	An odd number of parts; the last is merged in the next round.
+		merged.push_back (bounds[bounds.size () - 2]);
+	merged.push_back (bounds.back ());
+	finish ();
+	bounds.swap (merged);
+	}
+}
+
 }		//	namespace idaeim
 #endif	//	idaeim_Vectal_hh
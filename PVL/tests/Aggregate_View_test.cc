@@ -0,0 +1,500 @@
+/*	Aggregate_View_test
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"PVL.hh"
+#include	"Utility/Checker.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<string>
+#include	<vector>
+#include	<iostream>
+#include	<fstream>
+#include	<sstream>
+#include	<memory>
+#include	<cstdio>
+#include	<cstdlib>
+#include	<cstring>
+using namespace std;
+
+#ifndef VIEW_FILE
+#define VIEW_FILE		"Aggregate_View_test.pvlb"
+#endif
+
+
+//	The Lister listing of a Parameter.
+string
+listing_of
+	(
+	const Parameter&	parameter
+	)
+{
+ostringstream
+	listing;
+Lister
+	lister (listing);
+lister << parameter;
+return listing.str ();
+}
+
+
+//	The pathnames of all the Parameters an Aggregate find_all obtains.
+string
+found_pathnames
+	(
+	const Aggregate&	aggregate,
+	const string&		pathname,
+	bool				case_sensitive
+	)
+{
+string
+	listing;
+Aggregate::Find_Range
+	range (aggregate.find_all (pathname, case_sensitive));
+for (Aggregate::Find_Iterator
+		parameter = range.begin ();
+	 parameter != range.end ();
+	 ++parameter)
+	listing += parameter->pathname () + '\n';
+return listing;
+}
+
+
+//	The pathnames of all the Parameters an Aggregate_View find_all obtains.
+string
+viewed_pathnames
+	(
+	const Aggregate_View&	aggregate,
+	const string&			pathname,
+	bool					case_sensitive
+	)
+{
+string
+	listing;
+vector<Parameter_View>
+	found (aggregate.find_all (pathname, case_sensitive));
+for (vector<Parameter_View>::const_iterator
+		parameter = found.begin ();
+	 parameter != found.end ();
+	 ++parameter)
+	listing += parameter->pathname () + '\n';
+return listing;
+}
+
+
+//	Tests if viewing the data throws an Invalid_Syntax exception.
+bool
+invalid
+	(
+	const string&	data
+	)
+{
+try
+	{
+	Aggregate_View
+		view (data.data (), data.size ());
+	for (Aggregate_View::Depth_Iterator
+			parameter = view.begin_depth ();
+		 parameter != view.end_depth ();
+		 ++parameter)
+		parameter->name ();
+	}
+catch (const Invalid_Syntax&) {return true;}
+return false;
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Aggregate_View class test" << endl
+	 << Aggregate_View::ID << endl << endl;
+
+Checker
+	checker;
+
+if (count > 1)
+	{
+	if (*arguments[1] == '-')
+		 arguments[1]++;
+	if (*arguments[1] == 'v' ||
+		*arguments[1] == 'V')
+		checker.Verbose = true;
+	}
+
+try {
+
+string
+	parameters
+		("/* Product label */\n"
+		 "PDS_Version_ID = PDS3\n"
+		 "Object = Image\n"
+		 "  Lines = 1024\n"
+		 "  Samples = 2048 <pixels>\n"
+		 "  Sample_Bits = 16#FF#\n"
+		 "  Scaling_Factor = 1.5E-3\n"
+		 "  Filter_Name = \"Near Infrared\"\n"
+		 "  Start_Time = 2013-02-24T00:50:49.123Z\n"
+		 "  /* Band description */\n"
+		 "  Group = Band_Bin\n"
+		 "    Center = (1.0 <um>, 2.0 <um>, 3.0 <um>)\n"
+		 "    Width = {0.1, 0.2, 0.3} <um>\n"
+		 "    Filter_Name = (Red, Green, Blue)\n"
+		 "    Nested = ((1, 2), {a, b})\n"
+		 "  End_Group\n"
+		 "End_Object\n"
+		 "Object = Spectrum\n"
+		 "  Filter_Name = \"Near Infrared\"\n"
+		 "  Group = Band_Bin\n"
+		 "    Center = 1.5\n"
+		 "  End_Group\n"
+		 "End_Object\n"
+		 "Filter_Name = None\n"
+		 "Target = Mars\n"
+		 "End\n");
+Parser
+	parser (parameters);
+Aggregate
+	label (parser, Parser::CONTAINER_NAME);
+label.find ("Band_Bin")->indenting (false);
+
+if (checker.Verbose)
+	cout << "--- Aggregate_View::open (\"" VIEW_FILE "\")" << endl;
+	{
+	ofstream
+		file (VIEW_FILE, ios::out | ios::binary | ios::trunc);
+	Binary::write (label, file);
+	}
+Aggregate_View
+	view (Aggregate_View::open (VIEW_FILE));
+checker.check ("open",
+	true, (bool)view);
+checker.check ("verify",
+	true, view.verify ());
+checker.check ("root name",
+	label.name (), view.name ());
+checker.check ("size",
+	(int)label.size (), view.size ());
+
+//	Children.
+string
+	expected,
+	obtained;
+for (Aggregate::const_iterator
+		parameter = label.begin ();
+	 parameter != label.end ();
+	 ++parameter)
+	expected += parameter->name () + ' ' + parameter->type_name () + '\n';
+for (Aggregate_View::const_iterator
+		parameter = view.begin ();
+	 parameter != view.end ();
+	 ++parameter)
+	obtained += parameter->name () + ' ' + parameter->type_name () + '\n';
+checker.check ("children",
+	string (expected), obtained);
+
+//	Depth-first traversal.
+expected.clear ();
+obtained.clear ();
+for (Aggregate::Depth_Iterator
+		parameter = label.begin_depth ();
+	 parameter != label.end_depth ();
+	 ++parameter)
+	expected += parameter->pathname () + '\n';
+for (Aggregate_View::Depth_Iterator
+		parameter = view.begin_depth ();
+	 parameter != view.end_depth ();
+	 ++parameter)
+	obtained += parameter->pathname () + '\n';
+checker.check ("depth-first pathnames",
+	string (expected), obtained);
+
+//	Find results are the same as for the Aggregate.
+const char
+	*finds[] =
+		{
+		"Filter_Name",
+		"FILTER_NAME",
+		"/Image/Filter_Name",
+		"/IMAGE/BAND_BIN/CENTER",
+		"Band_Bin/Center",
+		"band_bin",
+		"/Band_Bin",
+		"Nothing"
+		};
+for (unsigned int
+		find = 0;
+	 find < sizeof (finds) / sizeof (finds[0]);
+	 find++)
+	{
+	for (int
+			case_sensitive = 0;
+		 case_sensitive < 2;
+		 case_sensitive++)
+		{
+		string
+			description (string ("find_all \"") + finds[find] + '"' +
+				(case_sensitive ? " case sensitive" : ""));
+		checker.check (description,
+			found_pathnames (label, finds[find], case_sensitive != 0),
+			viewed_pathnames (view, finds[find], case_sensitive != 0));
+		}
+	}
+checker.check ("find skip",
+	string ("/Spectrum/Filter_Name"),
+	view.find ("Filter_Name", false, 2).pathname ());
+checker.check ("find not found",
+	false, (bool)view.find ("Filter_Name", false, 4));
+checker.check ("find type",
+	string ("/Image/Band_Bin"),
+	view.find ("Band_Bin", false, 0, Parameter::GROUP).pathname ());
+checker.check ("find_count",
+	4, view.find_count ("Filter_Name"));
+checker.check ("parent",
+	string ("/Image/Band_Bin"),
+	view.find ("Band_Bin/Width").parent ().pathname ());
+checker.check ("root has no parent",
+	false, (bool)view.parent ());
+
+//	Nested Aggregates.
+Aggregate_View
+	band_bin (view.find ("/Image/Band_Bin"));
+checker.check ("nested size",
+	4, band_bin.size ());
+checker.check ("nested find",
+	string ("/Image/Band_Bin/Filter_Name"),
+	band_bin.find ("Filter_Name").pathname ());
+checker.check ("nested absolute find",
+	string ("/Image/Band_Bin/Center"),
+	band_bin.find ("/Center").pathname ());
+checker.check ("nested comment",
+	label.find ("Band_Bin")->comment (), band_bin.comment ());
+checker.check ("nested mode",
+	(int)Parameter::MODE_FALSE,
+	(int)band_bin.mode_state (Parameter::Indenting));
+
+//	Values.
+checker.check ("Integer",
+	(Value::Integer_type)2048,
+	(Value::Integer_type)view.find ("Samples").value ());
+checker.check ("units",
+	string ("pixels"), view.find ("Samples").value ().units ());
+checker.check ("base",
+	16, view.find ("Sample_Bits").value ().base ());
+checker.check ("Real",
+	(Value::Real_type)1.5E-3,
+	(Value::Real_type)view.find ("Scaling_Factor").value ());
+checker.check ("String",
+	string ("Near Infrared"),
+	(Value::String_type)view.find ("Image/Filter_Name").value ());
+checker.check ("String type",
+	(int)Value::DATE_TIME, (int)view.find ("Start_Time").value ().type ());
+Value_View
+	width = view.find ("Width").value ();
+checker.check ("Array type",
+	(int)Value::SET, (int)width.type ());
+checker.check ("Array size",
+	3, width.size ());
+checker.check ("Array element",
+	(Value::Real_type)0.2, (Value::Real_type)width[1]);
+checker.check ("nested Array element",
+	string ("b"),
+	(Value::String_type)view.find ("Nested").value ()[1][1]);
+expected.clear ();
+obtained.clear ();
+const Array
+	&centers = static_cast<const Array&>(label.find ("Center")->value ());
+for (Array::const_iterator
+		element = centers.begin ();
+	 element != centers.end ();
+	 ++element)
+	expected += element->units () + ' ';
+Value_View
+	center = view.find ("Center").value ();
+for (Value_View::const_iterator
+		element = center.begin ();
+	 element != center.end ();
+	 ++element)
+	obtained += element->units () + ' ';
+checker.check ("Array iteration",
+	string (expected), obtained);
+bool
+	thrown = false;
+try {view.find ("Image").value ();}
+catch (const Invalid_Argument&) {thrown = true;}
+checker.check ("Aggregate has no value",
+	true, thrown);
+thrown = false;
+try {Aggregate_View aggregate (view.find ("Lines"));}
+catch (const Invalid_Argument&) {thrown = true;}
+checker.check ("Assignment is not an Aggregate",
+	true, thrown);
+
+//	Select.
+Value::Integer_type
+	lines = 0,
+	samples = 0;
+Value::Real_type
+	widths[3] = {0, 0, 0};
+Value::String_type
+	target;
+Aggregate::Selection
+	selections[] =
+	{
+	Aggregate::Selection ("/Image/Lines", lines),
+	Aggregate::Selection ("Samples", samples),
+	Aggregate::Selection ("Band_Bin/Width", *widths, 3),
+	Aggregate::Selection ("Target", target),
+	Aggregate::Selection ()
+	};
+view.select (selections);
+checker.check ("select integer",
+	(Value::Integer_type)1024, lines);
+checker.check ("select integer relative",
+	(Value::Integer_type)2048, samples);
+checker.check ("select real array",
+	(Value::Real_type)0.3, widths[2]);
+checker.check ("select string",
+	Value::String_type ("Mars"), target);
+
+//	Listing.
+std::unique_ptr<Aggregate>
+	materialized (view.materialize ());
+checker.check ("materialize",
+	listing_of (label), listing_of (*materialized));
+ostringstream
+	listing;
+Lister
+	lister (listing);
+lister << view;
+checker.check ("Lister output",
+	listing_of (label), listing.str ());
+listing.str ("");
+listing << view.find ("Image/Band_Bin");
+ostringstream
+	original;
+original << *label.find ("Image/Band_Bin");
+checker.check ("ostream output",
+	original.str (), listing.str ());
+
+//	The view keeps the encoding open.
+Parameter_View
+	lines_view = view.find ("Lines");
+view = Aggregate_View ();
+checker.check ("view keeps the encoding",
+	string ("Lines"), lines_view.name ());
+lines_view = Parameter_View ();
+remove (VIEW_FILE);
+
+//	In memory encodings.
+string
+	encoding (Binary::encode (label));
+Aggregate_View
+	memory_view (encoding.data (), encoding.size ());
+checker.check ("in memory",
+	listing_of (label), listing_of (*std::unique_ptr<Aggregate>
+		(memory_view.materialize ())));
+string
+	data (encoding);
+data[data.size () - 5] ^= 0x10;
+checker.check ("verify corrupt",
+	false, Aggregate_View (data.data (), data.size ()).verify ());
+data = encoding;
+data[0] = 'X';
+checker.check ("bad magic", true, invalid (data));
+data = encoding;
+data[4]++;
+checker.check ("unsupported version", true, invalid (data));
+checker.check ("truncated", true,
+	invalid (encoding.substr (0, encoding.size () - 1)));
+checker.check ("short", true, invalid ("PVLB"));
+
+//	A corrupt field read during materialization.
+Aggregate
+	marked ("Marked");
+marked.add (Assignment ("Measure") = Integer (7).units ("UNITS_MARK"));
+data = Binary::encode (marked);
+unsigned int
+	corrupt_length = 0x7FFFFFFF;
+memcpy (&data[data.find ("UNITS_MARK") - sizeof (unsigned int)],
+	&corrupt_length, sizeof (unsigned int));
+thrown = false;
+try
+	{
+	delete Aggregate_View (data.data (), data.size ()).materialize ();
+	}
+catch (const Invalid_Syntax&) {thrown = true;}
+checker.check ("corrupt units materialize",
+	true, thrown);
+
+//	Out of range base and digits fields preceed the Integer datum.
+Aggregate
+	numbered ("Numbered");
+Value::Integer_type
+	datum_mark = 0x5A5A5A5A;
+numbered.add (Assignment ("Count") = Integer (datum_mark));
+data = Binary::encode (numbered);
+string::size_type
+	datum = data.find (string (reinterpret_cast<const char*>(&datum_mark),
+		sizeof (datum_mark)));
+int
+	corrupt_field = 37;
+memcpy (&data[datum - sizeof (int)], &corrupt_field, sizeof (int));
+thrown = false;
+try
+	{
+	delete Aggregate_View (data.data (), data.size ()).materialize ();
+	}
+catch (const Invalid_Syntax&) {thrown = true;}
+checker.check ("corrupt base materialize",
+	true, thrown);
+corrupt_field = -1;
+memcpy (&data[datum - 2 * sizeof (int)], &corrupt_field, sizeof (int));
+thrown = false;
+try
+	{
+	Aggregate_View (data.data (), data.size ()).find ("Count")
+		.value ().digits ();
+	}
+catch (const Invalid_Syntax&) {thrown = true;}
+checker.check ("corrupt digits",
+	true, thrown);
+thrown = false;
+try {Aggregate_View::open ("/nonexistent/" VIEW_FILE);}
+catch (const IO_Failure&) {thrown = true;}
+checker.check ("open failure",
+	true, thrown);
+}
+catch (const Exception& except)
+	{
+	cout << except.message () << endl;
+	checker.check (false);
+	}
+
+cout << endl
+	 << "Checks: " << checker.Checks_Total << endl
+	 << "Passed: " << checker.Checks_Passed << endl;
+
+exit ((checker.Checks_Total == checker.Checks_Passed) ? 0 : 1);
+}
@@ -0,0 +1,148 @@
+/*	Array_benchmark
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"PVL.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<string>
+#include	<iostream>
+#include	<iomanip>
+#include	<chrono>
+#include	<memory>
+#include	<cstdlib>
+using namespace std;
+
+/*	Usage: Array_benchmark [elements]
+
+	Integer Values are appended to an Array, with poke_back, up to the
+	specified number of elements using each Vectal growth policy. Then a
+	SEQUENCE Array of the same number of elements is parsed from PVL
+	text; the Parser reserves space for the elements it finds ahead in
+	the text. The times, and the number of times the Array storage was
+	reallocated, are reported. The program exits with a non-zero status
+	if any of the Arrays does not have the specified number of elements.
+*/
+#ifndef DEFAULT_ELEMENTS
+#define DEFAULT_ELEMENTS		100000
+#endif
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Array benchmark" << endl << endl;
+
+int
+	elements = (count > 1) ? atoi (arguments[1]) : DEFAULT_ELEMENTS;
+if (elements <= 0)
+	elements = DEFAULT_ELEMENTS;
+bool
+	same = true;
+
+cout << setw (16) << left << "method"
+	 << setw (12) << right << "elements"
+	 << setw (16) << right << "reallocations"
+	 << setw (14) << right << "msec" << endl
+	 << fixed << setprecision (2);
+
+static const char* const
+	POLICY_NAMES[] = {"margin", "geometric"};
+for (int
+		policy = Array::MARGIN_GROWTH;
+	 policy <= Array::GEOMETRIC_GROWTH;
+	 policy++)
+	{
+	Array
+		array;
+	array.growth_policy ((Array::Growth_Policy)policy);
+	int
+		reallocations = 0;
+	Array::size_type
+		capacity = array.capacity ();
+	chrono::steady_clock::time_point
+		start = chrono::steady_clock::now ();
+	for (int
+			element = 0;
+		 element < elements;
+		 element++)
+		{
+		array.poke_back (new Integer (element));
+		if (capacity != array.capacity ())
+			{
+			capacity = array.capacity ();
+			++reallocations;
+			}
+		}
+	double
+		time = chrono::duration<double, milli>
+			(chrono::steady_clock::now () - start).count ();
+	cout << setw (16) << left << POLICY_NAMES[policy]
+		 << setw (12) << right << array.size ()
+		 << setw (16) << right << reallocations
+		 << setw (14) << right << time;
+	if ((int)array.size () != elements)
+		{
+		cout << "  MISMATCH";
+		same = false;
+		}
+	cout << endl;
+	}
+
+string
+	text ("(");
+for (int
+		element = 0;
+	 element < elements;
+	 element++)
+	{
+	if (element)
+		text += ", ";
+	text += to_string (element);
+	}
+text += ")";
+Parser
+	parser (text);
+chrono::steady_clock::time_point
+	start = chrono::steady_clock::now ();
+std::unique_ptr<Value>
+	value (parser.get_value ());
+double
+	time = chrono::duration<double, milli>
+		(chrono::steady_clock::now () - start).count ();
+Array
+	&parsed = static_cast<Array&>(*value);
+cout << setw (16) << left << "Parser"
+	 << setw (12) << right << parsed.size ()
+	 << setw (16) << right << "-"
+	 << setw (14) << right << time;
+if ((int)parsed.size () != elements)
+	{
+	cout << "  MISMATCH";
+	same = false;
+	}
+cout << endl;
+
+exit (same ? 0 : 1);
+}
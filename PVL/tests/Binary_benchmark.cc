@@ -0,0 +1,262 @@
+/*	Binary_benchmark
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"PVL.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<string>
+#include	<iostream>
+#include	<iomanip>
+#include	<sstream>
+#include	<chrono>
+#include	<memory>
+#include	<cstdlib>
+using namespace std;
+
+/*	Usage: Binary_benchmark [objects [repetitions]]
+
+	A label with the specified number of top level Objects is built.
+	Each Object contains a comment, Integer Values with units and a
+	base, Real and String Values, and a BAND_BIN Group with Array
+	Values. The label is listed and parsed, as a label being cached
+	would have been, and the parsed label is encoded. The time to parse
+	the listing is then compared with the time to decode the encoding,
+	and with the time to open an Aggregate_View of the encoding and
+	find the last Object's SAMPLE_MASK in it. The program exits with a
+	non-zero status if either reloaded label, or the materialized view,
+	does not list the same as the parsed label.
+*/
+#ifndef DEFAULT_OBJECTS
+#define DEFAULT_OBJECTS			500
+#endif
+#ifndef DEFAULT_REPETITIONS
+#define DEFAULT_REPETITIONS		5
+#endif
+
+
+Assignment*
+assignment
+	(
+	const string&	name,
+	const Value&	value
+	)
+{
+Assignment
+	*parameter = new Assignment (name);
+*parameter = value;
+return parameter;
+}
+
+
+Aggregate*
+label_of
+	(
+	int		objects
+	)
+{
+Aggregate
+	*label = new Aggregate (Parser::CONTAINER_NAME);
+for (int
+		object = 0;
+	 object < objects;
+	 object++)
+	{
+	Aggregate
+		*image = new Aggregate ("IMAGE_" + to_string (object), Parameter::OBJECT);
+	image->comment ("Image " + to_string (object));
+	image->poke_back (assignment ("LINES", Integer (1024).units ("pixels")));
+	image->poke_back (assignment ("SAMPLES", Integer (2048).units ("pixels")));
+	image->poke_back (assignment ("SAMPLE_MASK",
+		Integer ((Value::Integer_type)(0xFF0 + object), 16)));
+	image->poke_back (assignment ("SCALING_FACTOR", Real (1.5 + object)));
+	image->poke_back (assignment ("FILTER_NAME", String ("Near Infrared")));
+	Aggregate
+		*band_bin = new Aggregate ("BAND_BIN", Parameter::GROUP);
+	Array
+		centers (Value::SEQUENCE),
+		widths (Value::SET);
+	for (int
+			element = 0;
+		 element < 8;
+		 element++)
+		{
+		centers.push_back (Real (0.5 + element).units ("um"));
+		widths.push_back (Real (0.01 * (element + 1)));
+		}
+	band_bin->poke_back (assignment ("CENTER", centers));
+	band_bin->poke_back (assignment ("WIDTH", widths));
+	image->poke_back (band_bin);
+	label->poke_back (image);
+	}
+return label;
+}
+
+
+//	The Lister listing of a Parameter.
+string
+listing_of
+	(
+	const Parameter&	parameter
+	)
+{
+ostringstream
+	listing;
+Lister
+	lister (listing);
+lister << parameter;
+return listing.str ();
+}
+
+
+//	Elapsed microseconds for repeated reloads of a label.
+template<typename Method>
+double
+timed
+	(
+	int				repetitions,
+	Method			method,
+	Aggregate*&		reloaded
+	)
+{
+chrono::steady_clock::time_point
+	start = chrono::steady_clock::now ();
+for (int
+		repetition = 0;
+	 repetition < repetitions;
+	 repetition++)
+	{
+	delete reloaded;
+	reloaded = method ();
+	}
+return chrono::duration<double, micro>
+	(chrono::steady_clock::now () - start).count () / repetitions;
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Binary benchmark" << endl
+	 << Binary::ID << endl << endl;
+
+int
+	objects = (count > 1) ? atoi (arguments[1]) : DEFAULT_OBJECTS,
+	repetitions = (count > 2) ? atoi (arguments[2]) : DEFAULT_REPETITIONS;
+if (objects <= 0)
+	objects = DEFAULT_OBJECTS;
+if (repetitions <= 0)
+	repetitions = DEFAULT_REPETITIONS;
+Aggregate
+	*generated = label_of (objects);
+const string
+	listing (listing_of (*generated));
+delete generated;
+Parser
+	parser (listing);
+Aggregate
+	*label = new Aggregate (parser, Parser::CONTAINER_NAME);
+const string
+	expected (listing_of (*label)),
+	encoding (Binary::encode (*label));
+cout << objects << " Objects, "
+	 << label->total_size () << " Parameters, "
+	 << repetitions << " repetitions" << endl << endl
+	 << setw (10) << left << "method"
+	 << setw (14) << right << "bytes"
+	 << setw (14) << "usec" << endl;
+
+Aggregate
+	*parsed = NULL,
+	*decoded = NULL;
+double
+	parse_time = timed (repetitions, [&listing] ()
+		{
+		Parser
+			parser (listing);
+		return new Aggregate (parser, Parser::CONTAINER_NAME);
+		}, parsed),
+	decode_time = timed (repetitions, [&encoding] ()
+		{return Binary::decode (encoding);}, decoded);
+
+const string
+	last_mask ("/IMAGE_" + to_string (objects - 1) + "/SAMPLE_MASK");
+Value::Integer_type
+	mask = 0;
+chrono::steady_clock::time_point
+	start = chrono::steady_clock::now ();
+for (int
+		repetition = 0;
+	 repetition < repetitions;
+	 repetition++)
+	{
+	Aggregate_View
+		view (encoding.data (), encoding.size ());
+	mask = view.find (last_mask).value ();
+	}
+double
+	view_time = chrono::duration<double, micro>
+		(chrono::steady_clock::now () - start).count () / repetitions;
+
+bool
+	same = true;
+cout << setw (10) << left << "Parser"
+	 << setw (14) << right << listing.size ()
+	 << setw (14) << fixed << setprecision (1) << parse_time;
+if (listing_of (*parsed) != expected)
+	{
+	cout << "  MISMATCH";
+	same = false;
+	}
+cout << endl
+	 << setw (10) << left << "Binary"
+	 << setw (14) << right << encoding.size ()
+	 << setw (14) << decode_time;
+if (listing_of (*decoded) != expected)
+	{
+	cout << "  MISMATCH";
+	same = false;
+	}
+cout << endl
+	 << setw (10) << left << "View"
+	 << setw (14) << right << encoding.size ()
+	 << setw (14) << view_time;
+Aggregate_View
+	view (encoding.data (), encoding.size ());
+std::unique_ptr<Aggregate>
+	materialized (view.materialize ());
+if (mask != (Value::Integer_type)label->find (last_mask)->value () ||
+	listing_of (*materialized) != expected)
+	{
+	cout << "  MISMATCH";
+	same = false;
+	}
+cout << endl << endl
+	 << "speedup " << setprecision (1) << parse_time / decode_time << endl;
+delete parsed;
+delete decoded;
+delete label;
+
+exit (same ? 0 : 1);
+}
@@ -0,0 +1,317 @@
+/*	Binary_test
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"PVL.hh"
+#include	"Utility/Checker.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<string>
+#include	<iostream>
+#include	<sstream>
+#include	<memory>
+#include	<cstdlib>
+using namespace std;
+
+
+//	The Lister listing of a Parameter.
+string
+listing_of
+	(
+	const Parameter&	parameter
+	)
+{
+ostringstream
+	listing;
+Lister
+	lister (listing);
+lister << parameter;
+return listing.str ();
+}
+
+
+//	Tests if decoding the data throws an Invalid_Syntax exception.
+bool
+invalid
+	(
+	const string&	data
+	)
+{
+try {delete Binary::decode (data);}
+catch (const Invalid_Syntax&) {return true;}
+return false;
+}
+
+
+//	The CRC-32 of the data following a 32 byte header.
+unsigned int
+data_checksum
+	(
+	const string&	encoding
+	)
+{
+unsigned int
+	crc = 0xFFFFFFFF;
+for (string::size_type
+		index = 32;
+	 index < encoding.size ();
+	 index++)
+	{
+	crc ^= (unsigned char)encoding[index];
+	for (int
+			bit = 0;
+		 bit < 8;
+		 bit++)
+		crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+	}
+return ~crc;
+}
+
+
+/*	Changes a field of an encoding and then corrects the checksum,
+	so only the field can make the encoding invalid.
+*/
+template<typename T>
+string
+altered
+	(
+	string				encoding,
+	string::size_type	offset,
+	const T&			datum
+	)
+{
+encoding.replace (offset, sizeof (T),
+	reinterpret_cast<const char*>(&datum), sizeof (T));
+unsigned int
+	checksum = data_checksum (encoding);
+encoding.replace (12, sizeof (checksum),
+	reinterpret_cast<const char*>(&checksum), sizeof (checksum));
+return encoding;
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Binary class test" << endl
+	 << Binary::ID << endl << endl;
+
+Checker
+	checker;
+
+if (count > 1)
+	{
+	if (*arguments[1] == '-')
+		 arguments[1]++;
+	if (*arguments[1] == 'v' ||
+		*arguments[1] == 'V')
+		checker.Verbose = true;
+	}
+
+try {
+
+string
+	parameters
+		("/* Product label */\n"
+		 "PDS_Version_ID = PDS3\n"
+		 "Record_Type = FIXED_LENGTH\n"
+		 "Object = Image\n"
+		 "  Lines = 1024\n"
+		 "  Samples = 2048 <pixels>\n"
+		 "  Sample_Bits = 16#FF#\n"
+		 "  Sample_Mask = 2#0000111100001111#\n"
+		 "  Offset = -123\n"
+		 "  Scaling_Factor = 1.5E-3\n"
+		 "  Center = 123.456 <nm>\n"
+		 "  Filter_Name = \"Near Infrared\"\n"
+		 "  Note = 'Symbol value'\n"
+		 "  Start_Time = 2013-02-24T00:50:49.123Z\n"
+		 "  /* Band description */\n"
+		 "  Group = Band_Bin\n"
+		 "    Center = (1.0 <um>, 2.0 <um>, 3.0 <um>)\n"
+		 "    Width = {0.1, 0.2, 0.3} <um>\n"
+		 "    Nested = ((1, 2), {a, b}, (\"x\", 'y'))\n"
+		 "    Empty = ()\n"
+		 "  End_Group\n"
+		 "End_Object\n"
+		 "Description = \"A long description that is long enough to be\n"
+		 "  wrapped across more than one line when it is listed by the\n"
+		 "  Lister.\"\n"
+		 "Flag\n"
+		 "End\n");
+Parser
+	parser (parameters);
+Aggregate
+	label (parser, Parser::CONTAINER_NAME);
+label.find ("Band_Bin")->indenting (false);
+label.find ("Description")->verbatim_strings (true);
+
+if (checker.Verbose)
+	cout << "--- Binary::encode (label)" << endl;
+string
+	encoding (Binary::encode (label));
+checker.check ("magic",
+	string (Binary::MAGIC, sizeof (Binary::MAGIC)),
+	encoding.substr (0, sizeof (Binary::MAGIC)));
+
+if (checker.Verbose)
+	cout << "--- Binary::decode (encoding)" << endl;
+std::unique_ptr<Aggregate>
+	decoded (Binary::decode (encoding));
+checker.check ("round trip listing",
+	listing_of (label), listing_of (*decoded));
+checker.check ("round trip compare",
+	0, label.compare (*decoded));
+checker.check ("round trip size",
+	(int)label.total_size (), (int)decoded->total_size ());
+checker.check ("round trip units",
+	string ("pixels"), decoded->find ("Samples")->value ().units ());
+checker.check ("round trip base",
+	16, decoded->find ("Sample_Bits")->value ().base ());
+checker.check ("round trip digits",
+	16, decoded->find ("Sample_Mask")->value ().digits ());
+checker.check ("round trip String type",
+	(int)Value::DATE_TIME, (int)decoded->find ("Start_Time")->value ().type ());
+checker.check ("round trip Array type",
+	(int)Value::SET, (int)decoded->find ("Width")->value ().type ());
+checker.check ("round trip Array parent",
+	(void*)&decoded->find ("Nested")->value ()[1],
+	(void*)decoded->find ("Nested")->value ()[1][0].parent ());
+checker.check ("round trip comment",
+	label.find ("Band_Bin")->comment (),
+	decoded->find ("Band_Bin")->comment ());
+checker.check ("round trip Flag type",
+	(int)label.find ("Flag")->type (), (int)decoded->find ("Flag")->type ());
+checker.check ("round trip indenting mode",
+	(int)Parameter::MODE_FALSE,
+	(int)decoded->find ("Band_Bin")->mode_state
+		(Parameter::Indenting, Parameter::LOCAL_MODE_SET));
+checker.check ("round trip parent",
+	(void*)decoded->find ("Image"),
+	(void*)decoded->find ("Image/Lines")->parent ());
+
+//	Stream I/O.
+if (checker.Verbose)
+	cout << "--- Binary::write (label, stream)" << endl;
+stringstream
+	stream;
+Binary::write (label, stream);
+decoded.reset (Binary::read (stream));
+checker.check ("stream round trip listing",
+	listing_of (label), listing_of (*decoded));
+
+//	An empty Aggregate.
+Aggregate
+	empty ("Empty", Parameter::GROUP);
+decoded.reset (Binary::decode (Binary::encode (empty)));
+checker.check ("empty Aggregate",
+	listing_of (empty), listing_of (*decoded));
+
+//	Invalid encodings.
+string
+	data (encoding);
+data[0] = 'X';
+checker.check ("bad magic", true, invalid (data));
+data = encoding;
+data[4]++;
+checker.check ("unsupported version", true, invalid (data));
+data = encoding;
+data[8]++;
+checker.check ("data size mismatch", true, invalid (data));
+data = encoding.substr (0, encoding.size () - 1);
+checker.check ("truncated", true, invalid (data));
+checker.check ("header only", true,
+	invalid (encoding.substr (0, Binary::HEADER_SIZE)));
+checker.check ("short", true, invalid ("PVLB"));
+data = encoding;
+data[data.size () - 5] ^= 0x10;
+checker.check ("checksum", true, invalid (data));
+data = encoding + "extra";
+checker.check ("trailing data", true, invalid (data));
+
+/*	Out of range fields of an intact encoding of
+	Group = Small; Ratio = 1.5; End_Group.
+	The node table offset is at header offset 28. The records are the
+	Aggregate (type, parent, name, comment, modes, count and extent),
+	the Assignment (type, parent, name, comment and modes), and the
+	Real Value (type, units, digits, base, datum and format flags).
+*/
+Aggregate
+	small ("Small", Parameter::GROUP);
+small.add (Assignment ("Ratio") = Real (1.5));
+string
+	small_encoding (Binary::encode (small));
+checker.check ("checksum of an intact encoding", false,
+	invalid (altered (small_encoding, 0, 'P')));
+unsigned int
+	node_table;
+small_encoding.copy (reinterpret_cast<char*>(&node_table),
+	sizeof (node_table), 28);
+string::size_type
+	modes = 32 + node_table + 4 * sizeof (int),
+	assignment = modes + Parameter::TOTAL_LOCAL_MODES + 2 * sizeof (int),
+	real = assignment + 4 * sizeof (int) + Parameter::TOTAL_LOCAL_MODES;
+checker.check ("Aggregate mode state", true,
+	invalid (altered (small_encoding, modes, (char)3)));
+checker.check ("Assignment mode state", true,
+	invalid (altered (small_encoding,
+		assignment + 4 * sizeof (int), (char)-1)));
+checker.check ("Value digits", true,
+	invalid (altered (small_encoding,
+		real + 2 * sizeof (int), Binary::MAX_DIGITS + 1)));
+checker.check ("negative Value digits", true,
+	invalid (altered (small_encoding, real + 2 * sizeof (int), -1)));
+checker.check ("Value base", true,
+	invalid (altered (small_encoding, real + 3 * sizeof (int), 37)));
+checker.check ("Value base one", true,
+	invalid (altered (small_encoding, real + 3 * sizeof (int), 1)));
+checker.check ("Real format flags", true,
+	invalid (altered (small_encoding,
+		real + 4 * sizeof (int) + sizeof (Value::Real_type),
+		0x80000000U)));
+checker.check ("valid Value base", false,
+	invalid (altered (small_encoding, real + 3 * sizeof (int), 36)));
+
+//	Values that can not be encoded.
+Aggregate
+	unencodable ("Unencodable", Parameter::GROUP);
+unencodable.add (Assignment ("Ratio") = Real (1.5, Binary::MAX_DIGITS + 1));
+bool
+	rejected = false;
+try {Binary::encode (unencodable);}
+catch (const Out_of_Range&) {rejected = true;}
+checker.check ("unencodable digits", true, rejected);
+}
+catch (const Exception& except)
+	{
+	cout << except.message () << endl;
+	checker.check (false);
+	}
+
+cout << endl
+	 << "Checks: " << checker.Checks_Total << endl
+	 << "Passed: " << checker.Checks_Passed << endl;
+
+exit ((checker.Checks_Total == checker.Checks_Passed) ? 0 : 1);
+}
@@ -0,0 +1,197 @@
+/*	Diff_benchmark
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"PVL.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<string>
+#include	<iostream>
+#include	<iomanip>
+#include	<chrono>
+#include	<memory>
+#include	<cstdlib>
+using namespace std;
+
+/*	Usage: Diff_benchmark [objects [changes]]
+
+	A label with the specified number of top level Objects is built;
+	each Object contains ten Parameters. A revision of the label is
+	made in which every changes-th Object has a changed Value, a
+	removed Parameter, an added Parameter and a moved Parameter, and
+	the first Object is moved to the end. The times to compute the
+	structural hashes of the two labels, to make the Diff from the label
+	to its revision once the hashes are saved, and to apply the Diff to
+	a copy of the label are reported. The program exits with a non-zero status if the patched
+	label is not equivalent to the revision.
+*/
+#ifndef DEFAULT_OBJECTS
+#define DEFAULT_OBJECTS			10000
+#endif
+#ifndef DEFAULT_CHANGES
+#define DEFAULT_CHANGES			100
+#endif
+
+
+Assignment*
+assignment
+	(
+	const string&	name,
+	const Value&	value
+	)
+{
+Assignment
+	*parameter = new Assignment (name);
+*parameter = value;
+return parameter;
+}
+
+
+Aggregate*
+label_of
+	(
+	int		objects
+	)
+{
+Aggregate
+	*label = new Aggregate (Parser::CONTAINER_NAME);
+for (int
+		object = 0;
+	 object < objects;
+	 object++)
+	{
+	Aggregate
+		*image = new Aggregate ("IMAGE_" + to_string (object), Parameter::OBJECT);
+	image->poke_back (assignment ("LINES", Integer (1024)));
+	image->poke_back (assignment ("SAMPLES", Integer (2048)));
+	image->poke_back (assignment ("SAMPLE_BITS", Integer (16)));
+	image->poke_back (assignment ("SAMPLE_MASK",
+		Integer ((Value::Integer_type)(0xFF0 + object), 16)));
+	image->poke_back (assignment ("OFFSET", Real (0.5 * object)));
+	image->poke_back (assignment ("SCALING_FACTOR", Real (1.5 + object)));
+	image->poke_back (assignment ("FILTER_NAME", String ("Near Infrared")));
+	image->poke_back (assignment ("START_TIME", String ("2013-02-24T00:50:49", Value::DATE_TIME)));
+	image->poke_back (assignment ("STOP_TIME", String ("2013-02-24T00:51:49", Value::DATE_TIME)));
+	Array
+		centers (Value::SEQUENCE);
+	for (int
+			element = 0;
+		 element < 4;
+		 element++)
+		centers.push_back (Real (0.5 + element));
+	image->poke_back (assignment ("CENTER", centers));
+	label->poke_back (image);
+	}
+return label;
+}
+
+
+Aggregate*
+revision_of
+	(
+	const Aggregate&	label,
+	int					changes
+	)
+{
+Aggregate
+	*revision = new Aggregate (label);
+for (unsigned int
+		object = 0;
+	 object < revision->size ();
+	 object += changes)
+	{
+	Aggregate
+		&image = static_cast<Aggregate&>((*revision)[object]);
+	image[0] = Integer (512);
+	delete image.remove (2);
+	image.poke_back (assignment ("PRODUCT_ID", String ("X" + to_string (object))));
+	image.poke_back (image.remove ((size_t)0));
+	}
+revision->poke_back (revision->remove ((size_t)0));
+return revision;
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Diff benchmark" << endl
+	 << Diff::ID << endl << endl;
+
+int
+	objects = (count > 1) ? atoi (arguments[1]) : DEFAULT_OBJECTS,
+	changes = (count > 2) ? atoi (arguments[2]) : DEFAULT_CHANGES;
+if (objects <= 0)
+	objects = DEFAULT_OBJECTS;
+if (changes <= 0)
+	changes = DEFAULT_CHANGES;
+std::unique_ptr<Aggregate>
+	label (label_of (objects)),
+	revision (revision_of (*label, changes));
+cout << objects << " Objects, "
+	 << label->total_size () << " Parameters" << endl << endl;
+
+chrono::steady_clock::time_point
+	start = chrono::steady_clock::now ();
+label->structural_hash ();
+revision->structural_hash ();
+double
+	hash_time = chrono::duration<double, milli>
+		(chrono::steady_clock::now () - start).count ();
+
+start = chrono::steady_clock::now ();
+Diff
+	diff (*label, *revision);
+double
+	diff_time = chrono::duration<double, milli>
+		(chrono::steady_clock::now () - start).count ();
+
+Aggregate
+	patched (*label);
+start = chrono::steady_clock::now ();
+diff.apply (patched);
+double
+	apply_time = chrono::duration<double, milli>
+		(chrono::steady_clock::now () - start).count ();
+
+cout << diff.size () << " Edits" << endl << endl
+	 << setw (16) << left << "method"
+	 << setw (14) << right << "msec" << endl
+	 << fixed << setprecision (2)
+	 << setw (16) << left << "structural_hash"
+	 << setw (14) << right << hash_time << endl
+	 << setw (16) << left << "Diff"
+	 << setw (14) << right << diff_time << endl
+	 << setw (16) << left << "apply"
+	 << setw (14) << right << apply_time;
+bool
+	same =
+		patched.equivalent (*revision) &&
+		Diff (patched, *revision).empty ();
+if (! same)
+	cout << "  MISMATCH";
+cout << endl;
+
+exit (same ? 0 : 1);
+}
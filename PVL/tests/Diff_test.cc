@@ -0,0 +1,346 @@
+/*	Diff_test
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"PVL.hh"
+#include	"Utility/Checker.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<string>
+#include	<iostream>
+#include	<sstream>
+#include	<memory>
+#include	<cstdlib>
+using namespace std;
+
+
+//	An Aggregate parsed from PVL text.
+Aggregate*
+label_of
+	(
+	const string&	text
+	)
+{
+Parser
+	parser (text);
+return new Aggregate (parser, Parser::CONTAINER_NAME);
+}
+
+
+//	Tests if patching a copy of the from Aggregate produces the to Aggregate.
+bool
+patches
+	(
+	const Diff&			diff,
+	const Aggregate&	from,
+	const Aggregate&	to
+	)
+{
+Aggregate
+	patched (from);
+diff.apply (patched);
+return patched.equivalent (to) && patched.compare (to) == 0;
+}
+
+
+//	Tests if applying a Diff to an Aggregate throws Invalid_Argument.
+bool
+misfits
+	(
+	const Diff&		diff,
+	Aggregate&		aggregate
+	)
+{
+try {diff.apply (aggregate);}
+catch (const Invalid_Argument&) {return true;}
+return false;
+}
+
+
+//	A pseudo-random Aggregate hierarchy.
+void
+populate
+	(
+	Aggregate&		aggregate,
+	unsigned int&	seed,
+	int				depth
+	)
+{
+int
+	count = 2 + (seed = seed * 1103515245 + 12345) % 8;
+while (count--)
+	{
+	seed = seed * 1103515245 + 12345;
+	string
+		name (1, (char)('A' + (seed >> 8) % 6));
+	if (depth && (seed >> 12) % 4 == 0)
+		{
+		Aggregate
+			*group = new Aggregate (name, Parameter::GROUP);
+		populate (*group, seed, depth - 1);
+		aggregate.poke_back (group);
+		}
+	else
+		{
+		Assignment
+			*assignment = new Assignment (name);
+		*assignment = Integer ((Value::Integer_type)((seed >> 16) % 4));
+		aggregate.poke_back (assignment);
+		}
+	}
+}
+
+
+//	Pseudo-random changes to an Aggregate hierarchy.
+void
+mutate
+	(
+	Aggregate&		aggregate,
+	unsigned int&	seed
+	)
+{
+for (unsigned int
+		index = 0;
+		index < aggregate.size ();
+		index++)
+	{
+	seed = seed * 1103515245 + 12345;
+	switch ((seed >> 8) % 8)
+		{
+		case 0:
+			delete aggregate.remove (index--);
+			break;
+		case 1:
+			{
+			Parameter
+				*parameter = aggregate.remove (index);
+			aggregate.poke ((seed >> 16) % (aggregate.size () + 1), parameter);
+			break;
+			}
+		case 2:
+			aggregate.poke (index, new Assignment
+				(string (1, (char)('A' + (seed >> 16) % 6))));
+			index++;
+			break;
+		case 3:
+			if (aggregate[index].is_Aggregate ())
+				mutate (static_cast<Aggregate&>(aggregate[index]), seed);
+			else
+				aggregate[index] = Integer ((Value::Integer_type)(seed >> 20));
+			break;
+		}
+	}
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Diff class test" << endl
+	 << Diff::ID << endl << endl;
+
+Checker
+	checker;
+
+if (count > 1)
+	{
+	if (*arguments[1] == '-')
+		 arguments[1]++;
+	if (*arguments[1] == 'v' ||
+		*arguments[1] == 'V')
+		checker.Verbose = true;
+	}
+
+try {
+
+std::unique_ptr<Aggregate>
+	from (label_of
+		("/* Original */\n"
+		 "PDS_Version_ID = PDS3\n"
+		 "Record_Type = FIXED_LENGTH\n"
+		 "Object = Image\n"
+		 "  Lines = 1024\n"
+		 "  Samples = 2048 <pixels>\n"
+		 "  Filter_Name = \"Near Infrared\"\n"
+		 "  Group = Band_Bin\n"
+		 "    Center = (1.0, 2.0, 3.0)\n"
+		 "    Width = 0.1\n"
+		 "  End_Group\n"
+		 "End_Object\n"
+		 "Note = First\n"
+		 "Note = Second\n"
+		 "End\n")),
+	to (label_of
+		("PDS_Version_ID = PDS4\n"
+		 "Object = Image\n"
+		 "  Samples = 2048 <pixels>\n"
+		 "  Lines = 1024\n"
+		 "  Filter_Name = \"Near Infrared\"\n"
+		 "  Object = Band_Bin\n"
+		 "    Center = (1.0, 2.0, 4.0)\n"
+		 "    Width = 0.1\n"
+		 "    Unit = um\n"
+		 "  End_Object\n"
+		 "End_Object\n"
+		 "Note = First\n"
+		 "Note = Changed\n"
+		 "Product_ID = X\n"
+		 "End\n"));
+
+if (checker.Verbose)
+	cout << "--- Diff same (*from, *from)" << endl;
+Diff
+	same (*from, Aggregate (*from));
+checker.check ("no differences", true, same.empty ());
+
+if (checker.Verbose)
+	cout << "--- Diff diff (*from, *to)" << endl;
+Diff
+	diff (*from, *to);
+if (checker.Verbose)
+	cout << diff;
+ostringstream
+	listing;
+listing << diff;
+checker.check ("edit script",
+	"- /Record_Type\n"
+	"+ /Product_ID\n"
+	"~ /PDS_Version_ID\n"
+	"> /Image/Samples\n"
+	"~ /Image/Band_Bin\n"
+	"+ /Image/Band_Bin/Unit\n"
+	"~ /Image/Band_Bin/Center\n"
+	"~ /Note\n",
+	listing.str ());
+checker.check ("MOVE Index", 1, (int)diff.edits ()[3].Index);
+checker.check ("MOVE Destination", 0, (int)diff.edits ()[3].Destination);
+checker.check ("nested Path size", 2, (int)diff.edits ()[5].Path.size ());
+checker.check ("CHANGE of duplicate name Index",
+	3, (int)diff.edits ()[7].Index);
+
+if (checker.Verbose)
+	cout << "--- diff.apply (patched)" << endl;
+Aggregate
+	patched (*from);
+diff.apply (patched);
+checker.check ("patched is equivalent", true, patched.equivalent (*to));
+checker.check ("patched Aggregate type",
+	(int)Parameter::OBJECT, (int)patched.find ("Band_Bin")->type ());
+checker.check ("patched comment retained",
+	from->find ("PDS_Version_ID")->comment (),
+	patched.find ("PDS_Version_ID")->comment ());
+checker.check ("reverse patch", true,
+	patches (Diff (*to, *from), *to, *from));
+
+//	Tokens and replaced kinds.
+std::unique_ptr<Aggregate>
+	tokens (label_of ("A = 1\nB = 2\nC = 3\nEnd\n"));
+Aggregate
+	changed_tokens (*tokens);
+changed_tokens[0].type (Parameter::TOKEN);
+delete changed_tokens.remove (1);
+changed_tokens.poke (1, new Aggregate ("B"));
+checker.check ("token and kind changes", true,
+	patches (Diff (*tokens, changed_tokens), *tokens, changed_tokens));
+checker.check ("kind change is remove and add",
+	3, (int)Diff (*tokens, changed_tokens).size ());
+
+//	Reordering.
+std::unique_ptr<Aggregate>
+	ordered (label_of ("A = 1\nB = 2\nC = 3\nD = 4\nE = 5\nEnd\n")),
+	rotated (label_of ("B = 2\nC = 3\nD = 4\nE = 5\nA = 1\nEnd\n")),
+	reversed (label_of ("E = 5\nD = 4\nC = 3\nB = 2\nA = 1\nEnd\n"));
+checker.check ("rotation is one MOVE",
+	1, (int)Diff (*ordered, *rotated).size ());
+checker.check ("reversal moves all but one",
+	4, (int)Diff (*ordered, *reversed).size ());
+checker.check ("reversal patch", true,
+	patches (Diff (*ordered, *reversed), *ordered, *reversed));
+
+//	Changes through the value reference after the hashes are saved.
+if (checker.Verbose)
+	cout << "--- Diff after edits through value ()" << endl;
+std::unique_ptr<Aggregate>
+	valued (label_of ("A = 1\nB = (1, 2)\nGroup = G\n  C = 3\nEnd_Group\nEnd\n"));
+Aggregate
+	edited (*valued);
+checker.check ("hashed copy has no differences",
+	true, Diff (*valued, edited).empty ());
+edited.find ("B")->value () = Array ().add (Integer (7));
+checker.check ("Array Value replaced through value ()",
+	1, (int)Diff (*valued, edited).size ());
+static_cast<Array&>(edited.find ("B")->value ()).add (Integer (8));
+edited.find ("C")->value () = 7;
+checker.check ("nested edits through value ()",
+	2, (int)Diff (*valued, edited).size ());
+checker.check ("edits through value () patch", true,
+	patches (Diff (*valued, edited), *valued, edited));
+
+//	Random hierarchies.
+if (checker.Verbose)
+	cout << "--- Random hierarchies" << endl;
+int
+	failures = 0;
+unsigned int
+	seed = 1;
+for (int
+		trial = 0;
+	 trial < 200;
+	 trial++)
+	{
+	Aggregate
+		original ("Random");
+	populate (original, seed, 3);
+	Aggregate
+		changed (original);
+	mutate (changed, seed);
+	if (! patches (Diff (original, changed), original, changed) ||
+		! patches (Diff (changed, original), changed, original))
+		++failures;
+	}
+checker.check ("random patches", 0, failures);
+
+//	Misfits.
+Aggregate
+	empty ("Empty");
+checker.check ("apply to an unrelated Aggregate", true,
+	misfits (diff, empty));
+Aggregate
+	flat (*from);
+delete flat.remove (flat.find ("Image"));
+checker.check ("Path without an Aggregate", true,
+	misfits (Diff (*from, *to), flat));
+}
+catch (const Exception& except)
+	{
+	cout << except.message () << endl;
+	checker.check (false);
+	}
+
+cout << endl
+	 << "Checks: " << checker.Checks_Total << endl
+	 << "Passed: " << checker.Checks_Passed << endl;
+
+exit ((checker.Checks_Total == checker.Checks_Passed) ? 0 : 1);
+}
@@ -0,0 +1,395 @@
+/*	Frozen_test
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"PVL.hh"
+#include	"Utility/Checker.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<string>
+#include	<vector>
+#include	<iostream>
+#include	<sstream>
+#include	<thread>
+#include	<atomic>
+#include	<cstdlib>
+using namespace std;
+
+/*	The reader threads are intended to be run under a thread sanitizer;
+	e.g. compile with -fsanitize=thread.
+*/
+#ifndef READER_THREADS
+#define READER_THREADS		8
+#endif
+#ifndef READER_REPETITIONS
+#define READER_REPETITIONS	200
+#endif
+
+
+//	The pathnames of the found Parameters, one per line.
+string
+pathnames
+	(
+	const vector<const Parameter*>&	parameters,
+	const Aggregate&				root
+	)
+{
+string
+	listing;
+for (vector<const Parameter*>::const_iterator
+		parameter = parameters.begin ();
+	 parameter != parameters.end ();
+	 ++parameter)
+	listing += (*parameter)->pathname (&root) + '\n';
+return listing;
+}
+
+
+//	The pathnames of all the Parameters an Aggregate find_all obtains.
+string
+found_pathnames
+	(
+	const Aggregate&	aggregate,
+	const string&		pathname,
+	bool				case_sensitive
+	)
+{
+vector<const Parameter*>
+	found;
+Aggregate::Find_Range
+	range (aggregate.find_all (pathname, case_sensitive));
+for (Aggregate::Find_Iterator
+		parameter = range.begin ();
+	 parameter != range.end ();
+	 ++parameter)
+	found.push_back (&(*parameter));
+return pathnames (found, aggregate);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Frozen class test" << endl
+	 << Frozen::ID << endl << endl;
+
+Checker
+	checker;
+
+if (count > 1)
+	{
+	if (*arguments[1] == '-')
+		 arguments[1]++;
+	if (*arguments[1] == 'v' ||
+		*arguments[1] == 'V')
+		checker.Verbose = true;
+	}
+
+try {
+
+string
+	parameters
+		("Object = Image\n"
+		 "  Lines = 1024\n"
+		 "  Samples = 2048\n"
+		 "  Filter_Name = Red\n"
+		 "  Group = Band_Bin\n"
+		 "    Center = (1.0, 2.0, 3.0)\n"
+		 "    Width = (0.1, 0.2, 0.3)\n"
+		 "    Filter_Name = (Red, Green, Blue)\n"
+		 "  End_Group\n"
+		 "End_Object\n"
+		 "Object = Spectrum\n"
+		 "  Filter_Name = \"Near Infrared\"\n"
+		 "  Group = Band_Bin\n"
+		 "    Center = 1.5\n"
+		 "  End_Group\n"
+		 "End_Object\n"
+		 "Filter_Name = None\n"
+		 "Target = Mars\n");
+Parser
+	parser (parameters);
+Aggregate
+	label (parser, Parser::CONTAINER_NAME);
+
+if (checker.Verbose)
+	cout << "--- Frozen frozen (label.freeze ());" << endl;
+Frozen
+	frozen (label.freeze ());
+checker.check ("size",
+	(int)label.total_size (), (int)frozen.size ());
+checker.check ("root is a copy",
+	true, &frozen.root () != &label);
+checker.check ("root equals the original",
+	0, frozen.root ().compare (label));
+checker.check ("path_delimiter",
+	Parameter::path_delimiter (), frozen.path_delimiter ());
+
+//	Parameter table.
+string
+	expected,
+	obtained;
+int
+	index = 0;
+for (Aggregate::Depth_Iterator
+		parameter = label.begin_depth ();
+	 parameter != label.end_depth ();
+	 ++parameter, ++index)
+	{
+	expected += parameter->pathname (&label) + '\n';
+	obtained += frozen.pathname (index) + '\n';
+	}
+checker.check ("table pathnames",
+	string (expected), obtained);
+obtained.clear ();
+for (Frozen::const_iterator
+		parameter = frozen.begin ();
+	 parameter != frozen.end ();
+	 ++parameter)
+	obtained += (*parameter)->pathname (&frozen.root ()) + '\n';
+checker.check ("table order",
+	expected, obtained);
+checker.check ("table element",
+	(void*)frozen.root ().find ("/Spectrum/Band_Bin/Center"),
+	(void*)&frozen[frozen.size () - 3]);
+
+//	Find results are the same as for the Aggregate.
+const char
+	*finds[] =
+		{
+		"Filter_Name",
+		"FILTER_NAME",
+		"/Image/Filter_Name",
+		"/IMAGE/BAND_BIN/CENTER",
+		"Band_Bin/Center",
+		"band_bin",
+		"Image/Band_Bin/Width",
+		"/Filter_Name",
+		"/Band_Bin",
+		"Nothing",
+		"/Image/Nothing"
+		};
+for (unsigned int
+		find = 0;
+	 find < sizeof (finds) / sizeof (finds[0]);
+	 find++)
+	{
+	for (int
+			case_sensitive = 0;
+		 case_sensitive < 2;
+		 case_sensitive++)
+		{
+		string
+			description (string ("find_all \"") + finds[find] + '"' +
+				(case_sensitive ? " case sensitive" : ""));
+		checker.check (description,
+			found_pathnames (label, finds[find], case_sensitive != 0),
+			pathnames (frozen.find_all (finds[find], case_sensitive != 0),
+				frozen.root ()));
+		}
+	}
+checker.check ("find skip",
+	string ("/Spectrum/Filter_Name"),
+	frozen.find ("Filter_Name", false, 2)->pathname (&frozen.root ()));
+checker.check ("find skip past the end",
+	(void*)NULL, (void*)frozen.find ("Filter_Name", false, 4));
+checker.check ("find type",
+	string ("/Image/Band_Bin"),
+	frozen.find ("Band_Bin", false, 0, Parameter::GROUP)
+		->pathname (&frozen.root ()));
+checker.check ("find type mismatch",
+	(void*)NULL, (void*)frozen.find ("Lines", false, 0, Parameter::AGGREGATE));
+checker.check ("find_count",
+	4, frozen.find_count ("Filter_Name"));
+checker.check ("find empty pathname",
+	(void*)NULL, (void*)frozen.find (""));
+
+//	The snapshot delimiter applies regardless of the thread's conventions.
+	{
+	Parameter::Conventions
+		conventions ('.', false);
+	checker.check ("find with other thread conventions",
+		(void*)frozen.root ().find ("Image.Band_Bin.Width"),
+		(void*)frozen.find ("Image/Band_Bin/Width"));
+	}
+
+//	Relative pathnames include a root name other than CONTAINER_NAME.
+Aggregate
+	image (*label.find ("Image"));
+Frozen
+	image_frozen (image.freeze ());
+checker.check ("relative pathname with the root name",
+	found_pathnames (image, "Image/Band_Bin/Center", false),
+	pathnames (image_frozen.find_all ("Image/Band_Bin/Center"),
+		image_frozen.root ()));
+
+//	Select.
+Value::Integer_type
+	lines = 0,
+	samples = 0;
+Value::Real_type
+	widths[3] = {0, 0, 0};
+Value::String_type
+	target;
+Aggregate::Selection
+	selections[] =
+	{
+	Aggregate::Selection ("/Image/Lines", lines),
+	Aggregate::Selection ("Samples", samples),
+	Aggregate::Selection ("Band_Bin/Width", *widths, 3),
+	Aggregate::Selection ("Target", target),
+	Aggregate::Selection ()
+	};
+frozen.select (selections);
+checker.check ("select integer",
+	(Value::Integer_type)1024, lines);
+checker.check ("select integer relative",
+	(Value::Integer_type)2048, samples);
+checker.check ("select real array",
+	(Value::Real_type)0.3, widths[2]);
+checker.check ("select string",
+	Value::String_type ("Mars"), target);
+
+//	The snapshot is independent of the original.
+ostringstream
+	listing;
+listing << frozen.root ();
+string
+	frozen_listing (listing.str ());
+label.find ("Target")->name ("Planet");
+delete label.remove (label.find ("/Image/Band_Bin"));
+checker.check ("independent of the original",
+	(void*)NULL, (void*)frozen.find ("/Planet"));
+checker.check ("unchanged by the original",
+	string ("/Image/Band_Bin\n"),
+	pathnames (frozen.find_all ("/Image/Band_Bin"), frozen.root ()));
+Frozen
+	copy (frozen);
+checker.check ("handle copy shares the snapshot",
+	(void*)&frozen.root (), (void*)&copy.root ());
+Frozen
+	empty;
+checker.check ("empty snapshot",
+	0, (int)empty.size ());
+
+//	The depth-first offsets of long lists are built with the snapshot.
+Aggregate
+	long_list ("Long_List", Parameter::GROUP);
+Array
+	long_array;
+for (int
+		index = 0;
+	 index < 32;
+	 index++)
+	{
+	long_list.add (Assignment ("Item_" + std::to_string (index))
+		= Integer (index));
+	long_array.add (Integer (index));
+	}
+long_list.add (Assignment ("Long_Array") = long_array);
+long_list.indexed (false);
+Frozen
+	frozen_long (long_list);
+const Aggregate
+	&long_root = frozen_long.root ();
+checker.check ("prebuilt Aggregate depth offsets",
+	true,
+	long_root.memory_usage ().Indices > long_list.memory_usage ().Indices);
+checker.check ("prebuilt Array depth offsets",
+	true,
+	long_root.find ("Long_Array")->value ().memory_usage ().Indices
+		> long_array.memory_usage ().Indices);
+
+//	Concurrent readers.
+if (checker.Verbose)
+	cout << "--- " << READER_THREADS << " reader threads" << endl;
+std::atomic<int>
+	failures (0);
+std::vector<std::thread>
+	readers;
+for (int
+		reader = 0;
+	 reader < READER_THREADS;
+	 reader++)
+	readers.push_back (std::thread ([frozen, &failures, &frozen_listing] ()
+		{
+		for (int
+				repetition = 0;
+			 repetition < READER_REPETITIONS;
+			 repetition++)
+			{
+			const Parameter
+				*parameter = frozen.find ("/Image/Band_Bin/Width");
+			if (! parameter ||
+				parameter->value ()[1] != Real (0.2))
+				++failures;
+			if (frozen.find_count ("Filter_Name") != 4)
+				++failures;
+			int
+				total = 0;
+			for (Aggregate::Depth_Iterator
+					position (frozen.root ());
+				 position != position.end_depth ();
+				 ++position)
+				++total;
+			if (total != (int)frozen.size ())
+				++failures;
+			Value::Integer_type
+				samples = 0;
+			Aggregate::Selection
+				selections[] =
+				{
+				Aggregate::Selection ("Samples", samples),
+				Aggregate::Selection ()
+				};
+			frozen.select (selections);
+			if (samples != 2048)
+				++failures;
+			ostringstream
+				listing;
+			listing << frozen.root ();
+			if (listing.str () != frozen_listing)
+				++failures;
+			}
+		}));
+for (std::vector<std::thread>::iterator
+		reader = readers.begin ();
+	 reader != readers.end ();
+	 ++reader)
+	reader->join ();
+checker.check ("concurrent readers",
+	0, failures.load ());
+}
+catch (const Exception& except)
+	{
+	cout << except.message () << endl;
+	checker.check (false);
+	}
+
+cout << endl
+	 << "Checks: " << checker.Checks_Total << endl
+	 << "Passed: " << checker.Checks_Passed << endl;
+
+exit ((checker.Checks_Total == checker.Checks_Passed) ? 0 : 1);
+}
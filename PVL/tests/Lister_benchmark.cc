@@ -0,0 +1,227 @@
+/*	Lister_benchmark
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"PVL.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<string>
+#include	<memory>
+#include	<sstream>
+#include	<iostream>
+#include	<iomanip>
+#include	<chrono>
+#include	<cstdlib>
+using namespace std;
+
+/*	Usage: Lister_benchmark [megabytes]
+
+	An Assignment with a quoted TEXT String Value, an Assignment with an
+	Array of Integer Values, and an Aggregate of Groups of Assignments
+	are listed with line wrapping at the default page width and in
+	compact mode. The sizes of the Parameters are doubled from one
+	megabyte up to the specified number of megabytes; the listing time
+	of a linear wrapping engine doubles with them. Each listing is
+	parsed back and the program exits with a non-zero status if the
+	Parameter that is parsed does not match the Parameter that was
+	listed.
+*/
+#ifndef DEFAULT_MEGABYTES
+#define DEFAULT_MEGABYTES			8
+#endif
+
+
+//	A pseudo-random text of words separated by single spaces.
+string
+text_of
+	(
+	size_t	size
+	)
+{
+string
+	text;
+text.reserve (size + 16);
+unsigned int
+	seed = 13;
+while (text.length () < size)
+	{
+	if (! text.empty ())
+		text += ' ';
+	seed = seed * 1103515245 + 12345;
+	int
+		letters = 1 + (seed >> 16) % 12;
+	while (letters--)
+		text += (char)('a' + (seed = seed * 1103515245 + 12345) % 26);
+	}
+return text;
+}
+
+
+Parameter*
+text_assignment
+	(
+	size_t	size
+	)
+{
+Assignment
+	*assignment = new Assignment ("Text");
+*assignment = String (text_of (size), Value::TEXT);
+return assignment;
+}
+
+
+Parameter*
+array_assignment
+	(
+	size_t	size
+	)
+{
+//	About eight characters for each listed Integer.
+Array
+	array;
+for (size_t
+		element = 0;
+	 element < size / 8;
+	 element++)
+	array.poke_back (new Integer ((Value::Integer_type)(element * 7919 % 1000000)));
+Assignment
+	*assignment = new Assignment ("Array");
+*assignment = array;
+return assignment;
+}
+
+
+Parameter*
+aggregate_of
+	(
+	size_t	size
+	)
+{
+//	About twenty characters for each listed Assignment.
+Aggregate
+	*aggregate = new Aggregate (Parser::CONTAINER_NAME);
+Aggregate
+	*group = NULL;
+for (size_t
+		element = 0;
+	 element < size / 20;
+	 element++)
+	{
+	if (element % 100 == 0)
+		aggregate->poke_back
+			(group = new Aggregate ("Group_" + to_string (element / 100)));
+	Assignment
+		*assignment = new Assignment ("Name_" + to_string (element % 100));
+	*assignment = Integer ((Value::Integer_type)(element * 7919 % 1000000));
+	group->poke_back (assignment);
+	}
+return aggregate;
+}
+
+
+bool
+benchmark
+	(
+	const char*		description,
+	Parameter*		(*parameter_of)(size_t),
+	int				megabytes
+	)
+{
+cout << description << endl
+	 << setw (12) << left << "listing"
+	 << setw (12) << right << "megabytes"
+	 << setw (14) << right << "listed"
+	 << setw (14) << right << "msec"
+	 << setw (14) << right << "MB/sec" << endl
+	 << fixed << setprecision (2);
+bool
+	same = true;
+for (int
+		size = 1;
+	 size <= megabytes;
+	 size *= 2)
+	{
+	std::unique_ptr<Parameter>
+		parameter (parameter_of ((size_t)size << 20));
+	for (int
+			compact = 0;
+		 compact < 2;
+		 compact++)
+		{
+		ostringstream
+			listing;
+		Lister
+			lister (listing);
+		lister.compact (compact);
+
+		chrono::steady_clock::time_point
+			start = chrono::steady_clock::now ();
+		lister << *parameter;
+		lister.flush ();
+		double
+			time = chrono::duration<double, milli>
+				(chrono::steady_clock::now () - start).count ();
+
+		cout << setw (12) << left << (compact ? "compact" : "formatted")
+			 << setw (12) << right << size
+			 << setw (14) << right << listing.str ().length ()
+			 << setw (14) << right << time
+			 << setw (14) << right
+			 	<< (listing.str ().length () / 1048576.0) / (time / 1000.0);
+		Parser
+			parser (listing.str ());
+		std::unique_ptr<Parameter>
+			parsed (parser.get_parameters ());
+		if (! parsed ||
+			*parsed != *parameter)
+			{
+			cout << "  MISMATCH";
+			same = false;
+			}
+		cout << endl;
+		}
+	}
+cout << endl;
+return same;
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Lister benchmark" << endl << endl;
+
+int
+	megabytes = (count > 1) ? atoi (arguments[1]) : DEFAULT_MEGABYTES;
+if (megabytes <= 0)
+	megabytes = DEFAULT_MEGABYTES;
+
+bool
+	same =
+		benchmark ("TEXT String", text_assignment, megabytes) &
+		benchmark ("Array of Integers", array_assignment, megabytes) &
+		benchmark ("Groups of Assignments", aggregate_of, megabytes);
+
+exit (same ? 0 : 1);
+}
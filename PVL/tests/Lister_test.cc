@@ -24,6 +24,7 @@ CVS ID: Lister_test.cc,v 1.17 2013/02/24 22:27:12 castalia Exp
 #include	<sstream>
 #include	<algorithm>
 #include	<functional>
+#include	<thread>
 
 #include	"Lister.hh"
 #include	"Parameter.hh"
@@ -782,6 +783,159 @@ checker.check ("String continuation retained.",
 	expected, listing);
 
 
+//	Compact listing.
+if (checker.Verbose)
+	cout << "--- Lister compact_lister (compact_listing); compact_lister.compact (true);"
+		 << endl;
+{
+ostringstream
+	compact_listing;
+Lister
+	compact_lister (compact_listing);
+compact_lister.compact (true);
+checker.check ("compact", true, compact_lister.compact ());
+
+Parser
+	source (
+		"/* Compact */\n"
+		"Name = Value\n"
+		"Group = \"Odd name\"\n"
+		"    Count = 5 <m>\n"
+		"    Negative = -12\n"
+		"    Hex = 16#FF#\n"
+		"    Real = 1.5 <km>\n"
+		"    Text = \"Some text\"\n"
+		"    Symbol = 'symbol'\n"
+		"    Array = (1, 2, (3, 4) <s>, {a, b})\n"
+		"End_Group\n"
+		"Object = Thing\n"
+		"    Set = {1, 2}\n"
+		"End_Object\n"
+		"END\n");
+Aggregate
+	original (source, Parser::CONTAINER_NAME);
+original[0].comment ("Compact");
+compact_lister << original;
+string
+	compact =
+		"/* Compact\n"
+		"*/\n"
+		"Name=Value\n"
+		"Group=\"Odd name\"\n"
+		"Count=5<m>\n"
+		"Negative=-12\n"
+		"Hex=16#FF#\n"
+		"Real=1.5<km>\n"
+		"Text=\"Some text\"\n"
+		"Symbol='symbol'\n"
+		"Array=(1,2,(3,4)<s>,{a,b})\n"
+		"End_Group\n"
+		"Object=Thing\n"
+		"Set={1,2}\n"
+		"End_Object\n"
+		"END\n";
+checker.check ("Compact listing.",
+	compact, compact_listing.str ());
+checker.check ("Compact listing total.",
+	(int)compact.length (), (int)compact_lister.total ());
+checker.check ("Compact listing pending.",
+	0, (int)compact_lister.pending ());
+
+Parser
+	parser (compact_listing.str ());
+Aggregate
+	parsed (parser, Parser::CONTAINER_NAME);
+checker.check ("Compact listing parsed.",
+	true, parsed == original);
+
+compact_listing.str ("");
+compact_lister.strict (true);
+compact_lister << original[2];
+checker.check ("Compact listing, strict.",
+	string (
+		"BEGIN_OBJECT=Thing;\r\n"
+		"Set={1,2};\r\n"
+		"END_OBJECT=Thing;\r\n"),
+	compact_listing.str ());
+
+compact_listing.str ("");
+compact_lister << original[1][6].value ();
+checker.check ("Compact listing, Value.",
+	string ("(1,2,(3,4)<s>,{a,b})"), compact_listing.str ());
+}
+
+
+//	Per-thread default scopes.
+if (checker.Verbose)
+	cout << "--- Lister::Defaults defaults;" << endl;
+bool
+	process_strict = Lister::default_strict ();
+const string
+	process_NL (Lister::default_NL ());
+	{
+	Lister::Defaults
+		defaults;
+	Lister::default_strict (! process_strict);
+	Lister::default_NL ("\r\n");
+	checker.check ("Defaults default_strict",
+		! process_strict, Lister::default_strict ());
+	checker.check ("Defaults default_NL",
+		string ("\r\n"), string (Lister::default_NL ()));
+	bool
+		thread_strict = ! process_strict;
+	string
+		thread_NL;
+	std::thread
+		other ([&thread_strict, &thread_NL] ()
+			{
+			thread_strict = Lister::default_strict ();
+			thread_NL = Lister::default_NL ();
+			});
+	other.join ();
+	checker.check ("Defaults other thread default_strict",
+		process_strict, thread_strict);
+	checker.check ("Defaults other thread default_NL",
+		process_NL, string (thread_NL));
+	}
+checker.check ("Defaults default_strict restored",
+	process_strict, Lister::default_strict ());
+checker.check ("Defaults default_NL restored",
+	process_NL, string (Lister::default_NL ()));
+
+//	Process wide defaults changed while other threads use them.
+if (checker.Verbose)
+	cout << "--- Lister::Default_Page_Width changed concurrently" << endl;
+	{
+	int
+		page_width = Lister::Default_Page_Width;
+	bool
+		widths_seen = true;
+	std::thread
+		other ([&widths_seen, page_width] ()
+			{
+			for (int count = 0;
+					 count < 10000;
+					 count++)
+				{
+				std::ostringstream
+					out;
+				Lister
+					lister (out);
+				if (lister.page_width () != page_width &&
+					lister.page_width () != page_width + 1)
+					widths_seen = false;
+				}
+			});
+	for (int count = 0;
+			 count < 10000;
+			 count++)
+		Lister::Default_Page_Width = page_width + (count & 1);
+	other.join ();
+	Lister::Default_Page_Width = page_width;
+	checker.check ("Default_Page_Width changed concurrently",
+		true, widths_seen);
+	}
+
 } catch (Exception except)
 	{
 	cout << except.message () << endl;
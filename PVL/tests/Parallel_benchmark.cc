@@ -0,0 +1,175 @@
+/*	Parallel_benchmark
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"PVL.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<string>
+#include	<iostream>
+#include	<iomanip>
+#include	<chrono>
+#include	<thread>
+#include	<cstdlib>
+using namespace std;
+
+/*	Usage: Parallel_benchmark [parameters [threads]]
+
+	An Aggregate hierarchy of about the specified number of Parameters
+	is built. The Assignments with an Integer Value less than ten are
+	counted by stepping a Depth_Iterator through the hierarchy, and then
+	by parallel_count_if on Thread_Pools of one thread up to the
+	specified number of threads, doubling each time. The times are
+	reported. The program exits with a non-zero status if any count
+	differs from the Depth_Iterator count.
+*/
+#ifndef DEFAULT_PARAMETERS
+#define DEFAULT_PARAMETERS		1000000
+#endif
+
+
+//	Adds Groups of Assignments until there are about the specified number of Parameters.
+void
+populate
+	(
+	Aggregate&		aggregate,
+	int				parameters,
+	unsigned int&	seed
+	)
+{
+int
+	width = 40;
+if (parameters <= width * 2)
+	{
+	while (parameters-- > 0)
+		{
+		seed = seed * 1103515245 + 12345;
+		Assignment
+			*assignment = new Assignment ("Value");
+		*assignment = Integer ((Value::Integer_type)((seed >> 16) % 100));
+		aggregate.poke_back (assignment);
+		}
+	return;
+	}
+for (int
+		group = 0;
+	 group < width;
+	 group++)
+	{
+	Aggregate
+		*member = new Aggregate ("Group", Parameter::GROUP);
+	populate (*member, parameters / width - 1, seed);
+	aggregate.poke_back (member);
+	}
+}
+
+
+bool
+counted
+	(
+	const Parameter&	parameter
+	)
+{
+return parameter.is_Assignment () &&
+	(Value::Integer_type)parameter.value () < 10;
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Parallel benchmark" << endl << endl;
+
+int
+	parameters = (count > 1) ? atoi (arguments[1]) : DEFAULT_PARAMETERS;
+if (parameters <= 0)
+	parameters = DEFAULT_PARAMETERS;
+unsigned int
+	threads = (count > 2) ? atoi (arguments[2]) : 0;
+if (! threads)
+	threads = std::thread::hardware_concurrency ();
+if (threads < 4)
+	threads = 4;
+
+Aggregate
+	aggregate ("Benchmark");
+unsigned int
+	seed = 1;
+populate (aggregate, parameters, seed);
+cout << "Parameters: " << aggregate.total_size () << endl
+	 << "Hardware threads: " << std::thread::hardware_concurrency ()
+	 << endl << endl;
+
+cout << setw (24) << left << "method"
+	 << setw (10) << right << "threads"
+	 << setw (12) << right << "count"
+	 << setw (14) << right << "msec" << endl
+	 << fixed << setprecision (2);
+
+chrono::steady_clock::time_point
+	start = chrono::steady_clock::now ();
+size_t
+	expected = 0;
+for (Aggregate::depth_iterator
+		position = aggregate.begin_depth ();
+		position != aggregate.end_depth ();
+	  ++position)
+	if (counted (*position))
+		++expected;
+double
+	time = chrono::duration<double, milli>
+		(chrono::steady_clock::now () - start).count ();
+cout << setw (24) << left << "Depth_Iterator"
+	 << setw (10) << right << 1
+	 << setw (12) << right << expected
+	 << setw (14) << right << time << endl;
+
+bool
+	same = true;
+for (unsigned int
+		size = 1;
+	 size <= threads;
+	 size <<= 1)
+	{
+	Thread_Pool
+		pool (size);
+	start = chrono::steady_clock::now ();
+	size_t
+		obtained = parallel_count_if (aggregate, counted, &pool);
+	time = chrono::duration<double, milli>
+		(chrono::steady_clock::now () - start).count ();
+	cout << setw (24) << left << "parallel_count_if"
+		 << setw (10) << right << size
+		 << setw (12) << right << obtained
+		 << setw (14) << right << time;
+	if (obtained != expected)
+		{
+		cout << "  MISMATCH";
+		same = false;
+		}
+	cout << endl;
+	}
+
+exit (same ? 0 : 1);
+}
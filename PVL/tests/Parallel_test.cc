@@ -0,0 +1,306 @@
+/*	Parallel_test
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"PVL.hh"
+#include	"Utility/Checker.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<string>
+#include	<iostream>
+#include	<vector>
+#include	<atomic>
+#include	<mutex>
+#include	<set>
+#include	<stdexcept>
+#include	<cstdlib>
+using namespace std;
+
+
+//	A pseudo-random Aggregate hierarchy.
+void
+populate
+	(
+	Aggregate&		aggregate,
+	unsigned int&	seed,
+	int				depth,
+	int				width
+	)
+{
+int
+	count = width / 2 + (seed = seed * 1103515245 + 12345) % width;
+while (count--)
+	{
+	seed = seed * 1103515245 + 12345;
+	string
+		name (1, (char)('A' + (seed >> 8) % 26));
+	if (depth && (seed >> 12) % 4 == 0)
+		{
+		Aggregate
+			*group = new Aggregate (name, Parameter::GROUP);
+		populate (*group, seed, depth - 1, width);
+		aggregate.poke_back (group);
+		}
+	else
+		{
+		Assignment
+			*assignment = new Assignment (name);
+		*assignment = Integer ((Value::Integer_type)((seed >> 16) % 100));
+		aggregate.poke_back (assignment);
+		}
+	}
+}
+
+
+//	A pseudo-random Array hierarchy.
+void
+populate
+	(
+	Array&			array,
+	unsigned int&	seed,
+	int				depth,
+	int				width
+	)
+{
+int
+	count = width / 2 + (seed = seed * 1103515245 + 12345) % width;
+while (count--)
+	{
+	seed = seed * 1103515245 + 12345;
+	if (depth && (seed >> 12) % 4 == 0)
+		{
+		Array
+			*set = new Array (Value::SET);
+		populate (*set, seed, depth - 1, width);
+		array.poke_back (set);
+		}
+	else
+		array.poke_back (new Integer ((Value::Integer_type)((seed >> 16) % 100)));
+	}
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Parallel class test" << endl
+	 << Thread_Pool::ID << endl << endl;
+
+Checker
+	checker;
+
+if (count > 1)
+	{
+	if (*arguments[1] == '-')
+		 arguments[1]++;
+	if (*arguments[1] == 'v' ||
+		*arguments[1] == 'V')
+		checker.Verbose = true;
+	}
+
+try {
+
+//	Thread_Pool.
+if (checker.Verbose)
+	cout << "--- Thread_Pool pool (4);" << endl;
+Thread_Pool
+	pool (4),
+	single (1);
+checker.check ("Thread_Pool size", 4, (int)pool.size ());
+checker.check ("single Thread_Pool size", 1, (int)single.size ());
+
+vector<int>
+	done (1000, 0);
+pool.run (done.size (), [&done] (size_t index) {done[index]++;});
+bool
+	once = true;
+for (size_t
+		index = 0;
+		index < done.size ();
+		index++)
+	if (done[index] != 1)
+		once = false;
+checker.check ("Thread_Pool run performs each task once", true, once);
+
+atomic<int>
+	nested (0);
+pool.run (8, [&pool, &nested] (size_t)
+	{pool.run (8, [&nested] (size_t) {++nested;});});
+checker.check ("Thread_Pool nested run", 64, (int)nested);
+
+bool
+	rethrown = false;
+try
+	{
+	pool.run (100, [] (size_t index)
+		{if (index == 37) throw std::runtime_error ("Task 37");});
+	}
+catch (const std::runtime_error& except)
+	{rethrown = string (except.what ()) == "Task 37";}
+checker.check ("Thread_Pool run rethrows a task exception", true, rethrown);
+
+//	Aggregate hierarchy.
+if (checker.Verbose)
+	cout << "--- Aggregate hierarchy" << endl;
+Aggregate
+	tree ("Tree");
+unsigned int
+	seed = 7;
+populate (tree, seed, 3, 40);
+if (checker.Verbose)
+	cout << "    total_size = " << tree.total_size () << endl;
+
+vector<const Parameter*>
+	order;
+size_t
+	expected_count = 0;
+for (Aggregate::depth_iterator
+		position = tree.begin_depth ();
+		position != tree.end_depth ();
+	  ++position)
+	{
+	order.push_back (&*position);
+	if (position->is_Assignment () &&
+		(int)position->value () < 10)
+		++expected_count;
+	}
+
+Thread_Pool*
+	pools[] = {&single, &pool, NULL};
+for (int
+		which = 0;
+		which < 3;
+		which++)
+	{
+	string
+		description (which == 0 ? " (single)" :
+			(which == 1 ? " (pool)" : " (default)"));
+
+	std::mutex
+		lock;
+	set<const Parameter*>
+		visited;
+	atomic<size_t>
+		calls (0);
+	parallel_for_each (tree, [&] (const Parameter& parameter)
+		{
+		++calls;
+		std::lock_guard<std::mutex>
+			guard (lock);
+		visited.insert (&parameter);
+		}, pools[which]);
+	checker.check ("parallel_for_each visits each Parameter once" + description,
+		true, calls == order.size () && visited.size () == order.size () &&
+			! visited.count (&tree));
+
+	checker.check ("parallel_count_if" + description,
+		(int)expected_count, (int)parallel_count_if (tree,
+			[] (const Parameter& parameter)
+			{
+			return parameter.is_Assignment () &&
+				(int)parameter.value () < 10;
+			}, pools[which]));
+
+	//	Concatenation is associative but not commutative.
+	string
+		names;
+	for (size_t
+			index = 0;
+			index < order.size ();
+			index++)
+		names += order[index]->name ();
+	checker.check ("parallel_transform_reduce in depth-first order" + description,
+		true, "<" + names == parallel_transform_reduce (tree, string ("<"),
+			[] (const string& first, const string& second)
+				{return first + second;},
+			[] (const Parameter& parameter) {return parameter.name ();},
+			pools[which]));
+	}
+
+Aggregate
+	empty ("Empty");
+checker.check ("parallel_transform_reduce of an empty Aggregate",
+	5, parallel_transform_reduce (empty, 5,
+		[] (int first, int second) {return first + second;},
+		[] (const Parameter&) {return 1;}, &pool));
+
+rethrown = false;
+try
+	{
+	parallel_for_each (tree, [&order] (const Parameter& parameter)
+		{
+		if (&parameter == order[order.size () / 2])
+			throw std::runtime_error ("Visitor");
+		}, &pool);
+	}
+catch (const std::runtime_error&)
+	{rethrown = true;}
+checker.check ("parallel_for_each rethrows a visitor exception",
+	true, rethrown);
+
+//	Array hierarchy.
+if (checker.Verbose)
+	cout << "--- Array hierarchy" << endl;
+Array
+	array;
+seed = 11;
+populate (array, seed, 3, 40);
+Value::Integer_type
+	expected_sum = 0;
+size_t
+	values = 0;
+for (Array::depth_iterator
+		position = array.begin_depth ();
+		position != array.end_depth ();
+	  ++position, ++values)
+	if (position->is_Integer ())
+		expected_sum += (Value::Integer_type)*position;
+checker.check ("Array parallel_transform_reduce",
+	true, expected_sum == parallel_transform_reduce (array,
+		(Value::Integer_type)0,
+		[] (Value::Integer_type first, Value::Integer_type second)
+			{return first + second;},
+		[] (const Value& value) -> Value::Integer_type
+			{return value.is_Integer () ? (Value::Integer_type)value : 0;},
+		&pool));
+checker.check ("Array parallel_count_if",
+	(int)values, (int)parallel_count_if (array,
+		[] (const Value&) {return true;}, &pool));
+atomic<size_t>
+	calls (0);
+parallel_for_each (array, [&calls] (const Value&) {++calls;}, &pool);
+checker.check ("Array parallel_for_each", (int)values, (int)calls);
+}
+catch (const Exception& except)
+	{
+	cout << except.message () << endl;
+	checker.check (false);
+	}
+
+cout << endl
+	 << "Checks: " << checker.Checks_Total << endl
+	 << "Passed: " << checker.Checks_Passed << endl;
+
+exit ((checker.Checks_Total == checker.Checks_Passed) ? 0 : 1);
+}
@@ -32,6 +32,10 @@ typedef idaeim::PVL::Aggregate::Selection Selection;
 #include	<sstream>
 #include	<algorithm>
 #include	<functional>
+#include	<thread>
+#include	<vector>
+#include	<string>
+#include	<type_traits>
 using namespace std;
 
 
@@ -89,6 +93,19 @@ assignment = Real (-32.1);
 checker.check ("Assignment = Real; Assignment value",
 	-32.1, (double)assignment.value ());
 
+//	Adopt a Value.
+if (checker.Verbose)
+	cout << "--- adopting.value (new Integer (7));" << endl;
+Assignment
+	adopting ("Adopting");
+Value
+	*adopted = new Integer (7);
+adopting.value (adopted);
+checker.check ("Assignment value (Value*); Value adopted",
+	(void*)adopted, (void*)&adopting.value ());
+checker.check ("Assignment value (Value*); Value owner",
+	(void*)&adopting, (void*)adopted->owner ());
+
 //	Write. 
 if (checker.Verbose)
 	cout << "--- assignment.write (ostringstream);" << endl;
@@ -398,6 +415,104 @@ if (! checker.check ("Aggregate find case sensitive, skip 0, ASSIGNMENT type for
 		false, (parameter != NULL)))
 	cout << "    found: " << parameter->pathname () << endl;
 
+//	find_all.
+if (checker.Verbose)
+	cout << "--- aggregate.find_all (\"date\");" << endl;
+Aggregate::Find_Range
+	found = aggregate.find_all ("date");
+Aggregate::Find_Iterator
+	found_parameter = found.begin ();
+if (checker.check ("Aggregate find_all first",
+		true, found_parameter != found.end ()))
+	checker.check ("Aggregate find_all first result",
+		"/First_Group/Second_Group/Date", found_parameter->pathname ());
+if (checker.check ("Aggregate find_all second",
+		true, ++found_parameter != found.end ()))
+	checker.check ("Aggregate find_all second result",
+		"/First_Group/Second_Group/Third_Group/Date",
+		found_parameter->pathname ());
+checker.check ("Aggregate find_all end",
+	true, ++found_parameter == found.end ());
+checker.check ("Aggregate find_all empty",
+	true, aggregate.find_all ("Date", true, Parameter::AGGREGATE).empty ());
+checker.check ("Aggregate find_count",
+	2, aggregate.find_count ("Date"));
+checker.check ("Aggregate find_count case sensitive",
+	0, aggregate.find_count ("DATE", true));
+
+//	Pathname index.
+if (checker.Verbose)
+	cout << "--- aggregate.indexed (true);" << endl;
+aggregate.indexed (true);
+checker.check ("Aggregate indexed",
+	true, aggregate.indexed ());
+parameter = aggregate.find ("date");
+if (checker.check ("Aggregate indexed find case insensitive any type",
+		true, (parameter != NULL)))
+	checker.check ("Aggregate indexed find case insensitive any type result",
+		"/First_Group/Second_Group/Date", parameter->pathname ());
+parameter = aggregate.find ("Date", true, 1, Parameter::ASSIGNMENT);
+if (checker.check ("Aggregate indexed find case sensitive, skip 1, ASSIGNMENT type",
+		true, (parameter != NULL)))
+	checker.check ("Aggregate indexed find case sensitive, skip 1, ASSIGNMENT type result",
+		"/First_Group/Second_Group/Third_Group/Date", parameter->pathname ());
+checker.check ("Aggregate indexed find case sensitive, non-matching case",
+	true, aggregate.find ("date", true) == NULL);
+checker.check ("Aggregate indexed find_count",
+	2, aggregate.find_count ("Date"));
+checker.check ("Aggregate indexed find_all first",
+	(void*)aggregate.find ("Date"),
+	(void*)&(*aggregate.find_all ("Date").begin ()));
+parameter = aggregate.find ("/second_group/third_group/date");
+if (checker.check ("Aggregate indexed find absolute pathname",
+		true, (parameter != NULL)))
+	checker.check ("Aggregate indexed find absolute pathname result",
+		"/First_Group/Second_Group/Third_Group/Date", parameter->pathname ());
+checker.check ("Aggregate indexed find case sensitive absolute pathname, non-matching case",
+	true, aggregate.find ("/Second_Group/Third_Group/DATE", true) == NULL);
+parameter = aggregate.find ("Third_Group/Date");
+if (checker.check ("Aggregate indexed find relative pathname",
+		true, (parameter != NULL)))
+	checker.check ("Aggregate indexed find relative pathname result",
+		"/First_Group/Second_Group/Third_Group/Date", parameter->pathname ());
+
+//	at_pathname.
+checker.check ("at_pathname absolute from root",
+	true, parameter->at_pathname
+		("/SECOND_GROUP/third_group/Date", false, &aggregate));
+checker.check ("at_pathname absolute from root, case sensitive",
+	false, parameter->at_pathname
+		("/SECOND_GROUP/third_group/Date", true, &aggregate));
+checker.check ("at_pathname absolute from root not in the path",
+	false, parameter->at_pathname
+		("/Second_Group/Third_Group/Date", false, &assignment));
+checker.check ("at_pathname relative",
+	true, parameter->at_pathname ("second_group/third_group/date", false));
+checker.check ("at_pathname relative, partial name",
+	false, parameter->at_pathname ("ird_Group/Date", false));
+
+if (checker.Verbose)
+	cout << "--- parameter->name (\"Time\");" << endl;
+parameter->name ("Time");
+checker.check ("Aggregate indexed find after rename, old name",
+	true, aggregate.find ("Third_Group/Date") == NULL);
+checker.check ("Aggregate indexed find after rename, new name",
+	(void*)parameter, (void*)aggregate.find ("Third_Group/Time"));
+parameter->name ("Date");
+
+if (checker.Verbose)
+	cout << "--- aggregate.find (\"Third_Group\")->parent ()->add (assignment);"
+			<< endl;
+aggregate.find ("Third_Group")->parent ()->add (assignment);
+parameter = aggregate.find ("/Second_Group/The_Parameter");
+checker.check ("Aggregate indexed find after add",
+	true, parameter != NULL && parameter->name () == assignment.name ());
+if (checker.Verbose)
+	cout << "--- aggregate.remove_depth (parameter);" << endl;
+delete aggregate.remove_depth (parameter);
+checker.check ("Aggregate indexed find after remove",
+	true, aggregate.find ("The_Parameter") == NULL);
+
 //	Insert assignment at iterator begin.
 if (checker.Verbose)
 	cout << "--- aggregate.insert (aggregate.begin (), assignment);" << endl;
@@ -529,6 +644,48 @@ expected
 checker.check ("Aggregate sort",
 	expected, listing);
 
+//	Function parallel_sort.
+if (checker.Verbose)
+	cout << "--- parallel_sort (many.begin (), many.end (), 4);" << endl;
+	{
+	Aggregate
+		many ("Many");
+	for (int
+			index = 0;
+		 index < 30000;
+		 index++)
+		{
+		Assignment
+			*assignment = new Assignment
+				(string ("N") + to_string ((index * 7919) % 1009));
+		*assignment = Integer (index % 3);
+		many.poke_back (assignment);
+		}
+	vector<const Parameter*>
+		stable_order;
+	for (Aggregate::const_iterator
+			member = many.begin ();
+			member != many.end ();
+			++member)
+		stable_order.push_back (&*member);
+	stable_sort (stable_order.begin (), stable_order.end (),
+		[] (const Parameter* parameter_1, const Parameter* parameter_2)
+			{return *parameter_1 < *parameter_2;});
+	parallel_sort (many.begin (), many.end (), 4);
+	bool
+		stable = true;
+	for (unsigned int
+			index = 0;
+		 index < many.size ();
+		 index++)
+		if (&many[index] != stable_order[index])
+			stable = false;
+	checker.check ("Aggregate parallel_sort",
+		true, stable);
+	checker.check ("Aggregate parallel_sort index",
+		(void*)stable_order[0], (void*)many.find ("N0"));
+	}
+
 //	Find and remove_depth parameter.
 if (checker.Verbose)
 	cout << "--- aggregate.find (\"Third_Group\");" << endl;
@@ -659,6 +816,639 @@ for (int
 		checker.check ("Aggregate select, string array unset entry 3",
 			Value::String_type ("ddd"), strings[index]);
 	}
+
+//	Alternative pathnames; a Selection without a Variable is ignored.
+Value::Integer_type
+	alternative = -1,
+	unselected = -1;
+Selection
+	alternatives[] =
+	{
+	Selection ("NS", alternative),
+	Selection ("/integer", alternative),
+	Selection ("Integer_Array", NULL, Value::INTEGER),
+	Selection ("/Container/Integer", unselected),
+	Selection ()
+	};
+if (checker.Verbose)
+	cout << "--- container->select (alternatives)" << endl;
+container->select (alternatives);
+checker.check ("Aggregate select, alternative pathnames",
+	(Value::Integer_type)3, alternative);
+checker.check ("Aggregate select, absolute pathname includes the root",
+	(Value::Integer_type)-1, unselected);
+
+
+//	Move
+if (checker.Verbose)
+	cout << "--- Assignment moved_assignment (std::move (assignment_copy));"
+			<< endl;
+Value
+	*moved_value = &assignment_copy.value ();
+Assignment
+	moved_assignment (std::move (assignment_copy));
+checker.check ("Assignment move name",
+	"The_Parameter", moved_assignment.name ());
+checker.check ("Assignment move value not cloned",
+	(void*)moved_value, (void*)&moved_assignment.value ());
+checker.check ("Assignment move does not throw",
+	true, std::is_nothrow_move_constructible<Assignment>::value);
+checker.check ("Assignment moved from has a Default_Value",
+	true, assignment_copy.value ().is_Integer ());
+checker.check ("Assignment moved from Default_Value owner",
+	(void*)&assignment_copy, (void*)assignment_copy.value ().owner ());
+
+if (checker.Verbose)
+	cout << "--- Aggregate moved_aggregate (std::move (*container));" << endl;
+Parameter
+	*moved_parameter = &(*container)[1];
+int
+	moved_size = (int)container->size ();
+Aggregate
+	moved_aggregate (std::move (*container));
+checker.check ("Aggregate move size",
+	moved_size, (int)moved_aggregate.size ());
+checker.check ("Aggregate moved from is empty",
+	0, (int)container->size ());
+checker.check ("Aggregate move Parameter not cloned",
+	(void*)moved_parameter, (void*)&moved_aggregate[1]);
+checker.check ("Aggregate move Parameter parent",
+	(void*)&moved_aggregate, (void*)moved_parameter->parent ());
+
+if (checker.Verbose)
+	cout << "--- *container = std::move (moved_aggregate);" << endl;
+*container = std::move (moved_aggregate);
+checker.check ("Aggregate move assign size",
+	moved_size, (int)container->size ());
+checker.check ("Aggregate move assign Parameter not cloned",
+	(void*)moved_parameter, (void*)&(*container)[1]);
+checker.check ("Aggregate move assign Parameter parent",
+	(void*)container, (void*)moved_parameter->parent ());
+
+if (checker.Verbose)
+	cout << "--- container->push_back (std::move (moved_assignment));"
+			<< endl;
+container->push_back (std::move (moved_assignment));
+checker.check ("Aggregate push_back move value not cloned",
+	(void*)moved_value, (void*)&container->back ().value ());
+checker.check ("Aggregate push_back move parent",
+	(void*)container, (void*)container->back ().parent ());
+
+if (checker.Verbose)
+	cout << "--- container->emplace_back<Assignment> (\"Emplaced\");"
+			<< endl;
+Assignment
+	&emplaced = container->emplace_back<Assignment> ("Emplaced");
+checker.check ("Aggregate emplace_back",
+	(void*)&emplaced, (void*)&container->back ());
+checker.check ("Aggregate emplace_back parent",
+	(void*)container, (void*)emplaced.parent ());
+
+if (checker.Verbose)
+	cout << "--- container->adopt (std::unique_ptr<Parameter>"
+			" (new Aggregate (\"Adopted\")));" << endl;
+moved_parameter = new Aggregate ("Adopted");
+container->adopt (std::unique_ptr<Parameter> (moved_parameter));
+checker.check ("Aggregate adopt",
+	(void*)moved_parameter, (void*)&container->back ());
+checker.check ("Aggregate adopt parent",
+	(void*)container, (void*)moved_parameter->parent ());
+delete container;
+
+//	Structural hash.
+if (checker.Verbose)
+	cout << "--- Aggregate::structural_hash ()" << endl;
+{
+Aggregate
+	hashed ("Hashed", Parameter::OBJECT);
+hashed.push_back (Assignment ("Lines") = Integer (1024));
+hashed.push_back (Aggregate ("Band", Parameter::GROUP));
+static_cast<Aggregate*>(hashed.find ("Band"))->add (Assignment ("Center") = Real (1.5));
+Aggregate
+	hashed_copy (hashed);
+checker.check ("structural_hash of a copy",
+	true, hashed.structural_hash () == hashed_copy.structural_hash ());
+checker.check ("equivalent copy",
+	true, hashed.equivalent (hashed_copy));
+
+hashed_copy.comment ("Presentation only.");
+hashed_copy.find ("Lines")->value ().base (16);
+hashed_copy.find ("Lines")->invalidate_hash ();
+checker.check ("structural_hash ignores comment and base",
+	true, hashed.structural_hash () == hashed_copy.structural_hash ());
+
+std::uint64_t
+	hash = hashed_copy.structural_hash ();
+*hashed_copy.find ("Center") = Real (2.5);
+checker.check ("structural_hash changed by a nested Value assignment",
+	true, hash != hashed_copy.structural_hash ());
+checker.check ("not equivalent after a Value change",
+	false, hashed.equivalent (hashed_copy));
+*hashed_copy.find ("Center") = Real (1.5);
+checker.check ("structural_hash restored with the Value",
+	true, hashed.structural_hash () == hashed_copy.structural_hash ());
+
+hashed_copy.find ("Center")->name ("Width");
+checker.check ("structural_hash changed by a nested rename",
+	true, hashed.structural_hash () != hashed_copy.structural_hash ());
+hashed_copy.find ("Width")->name ("Center");
+checker.check ("structural_hash restored with the name",
+	true, hashed.structural_hash () == hashed_copy.structural_hash ());
+
+static_cast<Aggregate*>(hashed_copy.find ("Band"))->add (Assignment ("Added"));
+checker.check ("structural_hash changed by a nested insert",
+	true, hashed.structural_hash () != hashed_copy.structural_hash ());
+delete static_cast<Aggregate*>(hashed_copy.find ("Band"))->remove (1);
+checker.check ("structural_hash restored by removal",
+	true, hashed.structural_hash () == hashed_copy.structural_hash ());
+
+hashed_copy.find ("Band")->type (Parameter::OBJECT);
+checker.check ("structural_hash changed by the Aggregate type",
+	true, hashed.structural_hash () != hashed_copy.structural_hash ());
+checker.check ("compare ignores the Aggregate type",
+	0, hashed.compare (hashed_copy));
+checker.check ("equivalent distinguishes the Aggregate type",
+	false, hashed.equivalent (hashed_copy));
+
+hashed_copy.find ("Band")->type (Parameter::GROUP);
+Parameter
+	&lines = *hashed_copy.find ("Lines");
+hash = hashed_copy.structural_hash ();
+lines.value () = 2048;
+checker.check ("structural_hash changed through the value reference",
+	true, hash != hashed_copy.structural_hash ());
+checker.check ("equivalent agrees with compare after a value reference change",
+	hashed.compare (hashed_copy) == 0, hashed.equivalent (hashed_copy));
+lines.value () = 1024;
+checker.check ("structural_hash restored through the value reference",
+	true, hashed.structural_hash () == hashed_copy.structural_hash ());
+lines.value ().units ("pixels");
+checker.check ("structural_hash changed by units through the value reference",
+	true, hashed.structural_hash () != hashed_copy.structural_hash ());
+lines.value ().units ("");
+
+Array
+	sizes;
+sizes.add (Integer (1));
+sizes.add (Array ().add (Integer (2)));
+hashed.add (Assignment ("Sizes") = sizes);
+hashed_copy.add (Assignment ("Sizes") = sizes);
+checker.check ("equivalent with an Array Value",
+	true, hashed.equivalent (hashed_copy));
+Array
+	&copy_sizes = static_cast<Array&>(hashed_copy.find ("Sizes")->value ());
+copy_sizes.add (Integer (3));
+checker.check ("structural_hash changed by adding to an Array Value",
+	true, hashed.structural_hash () != hashed_copy.structural_hash ());
+checker.check ("not equivalent after adding to an Array Value",
+	false, hashed.equivalent (hashed_copy));
+delete copy_sizes.remove (2);
+checker.check ("structural_hash restored by removing from an Array Value",
+	true, hashed.structural_hash () == hashed_copy.structural_hash ());
+copy_sizes[1][0] = 7;
+checker.check ("structural_hash changed by a nested Array element",
+	true, hashed.structural_hash () != hashed_copy.structural_hash ());
+checker.check ("equivalent agrees with compare after a nested element change",
+	hashed.compare (hashed_copy) == 0, hashed.equivalent (hashed_copy));
+}
+
+//	Random-access Depth_Iterator.
+if (checker.Verbose)
+	cout << "--- Aggregate::depth_iterator random access" << endl;
+{
+Aggregate
+	wide ("Wide");
+for (int
+		index = 0;
+		index < 40;
+		index++)
+	{
+	if (index % 5)
+		wide.poke_back (new Assignment (string ("A") + char ('a' + index % 26)));
+	else
+		{
+		Aggregate
+			*group = new Aggregate (string ("G") + char ('a' + index % 26));
+		for (int
+				member = 0;
+				member < 20;
+				member++)
+			{
+			if (member % 3)
+				group->poke_back (new Assignment ("M"));
+			else
+				{
+				Aggregate
+					*inner = new Aggregate ("I");
+				inner->poke_back (new Assignment ("X"));
+				inner->poke_back (new Assignment ("Y"));
+				group->poke_back (inner);
+				}
+			}
+		wide.poke_back (group);
+		}
+	}
+
+//	Compares random access with stepping through the hierarchy.
+std::function<bool (Aggregate&)>
+	consistent = [] (Aggregate& aggregate)
+	{
+	vector<Parameter*>
+		order;
+	for (Aggregate::depth_iterator
+			position = aggregate.begin_depth ();
+			position != aggregate.end_depth ();
+		  ++position)
+		order.push_back (&*position);
+	if (aggregate.total_size () != order.size ())
+		return false;
+	Aggregate::depth_iterator
+		first = aggregate.begin_depth (),
+		last = aggregate.end_depth ();
+	if (last - first != (int)order.size () ||
+		first + order.size () != last)
+		return false;
+	for (int
+			index = 0;
+			index < (int)order.size ();
+			index++)
+		{
+		Aggregate::depth_iterator
+			position = first + index;
+		if (&*position != order[index] ||
+			position - first != index ||
+			last - position != (int)order.size () - index ||
+			&*(position - index / 2) != order[index - index / 2] ||
+			(first < position) != (index > 0) ||
+			! (position < last) ||
+			first - Aggregate::iterator (position) != -index)
+			return false;
+		}
+	return true;
+	};
+
+checker.check ("total_size", 40 + 8 * (20 + 7 * 2), (int)wide.total_size ());
+checker.check ("depth_iterator random access", true, consistent (wide));
+
+Aggregate::depth_iterator
+	position = wide.begin_depth () + 5;
+bool
+	out_of_range = false;
+try {position += wide.total_size ();}
+catch (const Out_of_Range&) {out_of_range = true;}
+checker.check ("depth_iterator offset past the end throws Out_of_Range",
+	true, out_of_range);
+checker.check ("depth_iterator unmoved by Out_of_Range",
+	(void*)&*(wide.begin_depth () + 5), (void*)&*position);
+
+Aggregate
+	&group = static_cast<Aggregate&>(wide[10]);
+delete group.remove (3);
+group.poke (7, new Aggregate ("Added"));
+static_cast<Aggregate&>(group[7]).poke_back (new Assignment ("Z"));
+checker.check ("total_size after nested changes",
+	40 + 8 * (20 + 7 * 2) - 3 + 2, (int)wide.total_size ());
+checker.check ("depth_iterator random access after nested changes",
+	true, consistent (wide));
+
+Aggregate
+	moved ("Moved");
+moved.move_in (group);
+checker.check ("total_size after move_in",
+	40 + 8 * (20 + 7 * 2) - 3 + 2 - 33, (int)wide.total_size ());
+checker.check ("total_size of the moved Parameters",
+	20 + 7 * 2 - 3 + 2, (int)moved.total_size ());
+checker.check ("depth_iterator random access after move_in",
+	true, consistent (wide));
+
+sort (wide.begin (), wide.end ());
+checker.check ("depth_iterator random access after sort",
+	true, consistent (wide));
+
+Aggregate
+	copy (wide);
+checker.check ("total_size of a copy",
+	(int)wide.total_size (), (int)copy.total_size ());
+copy = moved;
+checker.check ("total_size after assignment",
+	(int)moved.total_size (), (int)copy.total_size ());
+checker.check ("depth_iterator random access after assignment",
+	true, consistent (copy));
+}
+
+//	Depth_Iterator traversal modes.
+if (checker.Verbose)
+	cout << "--- Aggregate::depth_iterator parent traversal" << endl;
+{
+Aggregate
+	deep ("Deep"),
+	*level = &deep;
+for (int
+		depth = 0;
+		depth < 12;
+		depth++)
+	{
+	level->poke_back (new Assignment ("Before"));
+	Aggregate
+		*inner = new Aggregate ("Level");
+	level->poke_back (inner);
+	level->poke_back (new Assignment ("After"));
+	level = inner;
+	}
+level->poke_back (new Assignment ("Bottom"));
+
+vector<Parameter*>
+	order;
+unsigned int
+	deepest = 0;
+for (Aggregate::depth_iterator
+		position = deep.begin_depth ();
+		position != deep.end_depth ();
+	  ++position)
+	{
+	order.push_back (&*position);
+	deepest = max (deepest, position.depth ());
+	}
+checker.check ("depth_iterator depth beyond the inline stack",
+	12, (int)deepest);
+
+Aggregate::depth_iterator
+	parent_position (deep, true),
+	parent_end = parent_position.end_depth ();
+checker.check ("depth_iterator parent_traversal",
+	true, parent_end.parent_traversal ());
+bool
+	same = true;
+unsigned int
+	index = 0;
+for (;
+	 parent_position != parent_end;
+	 ++parent_position, ++index)
+	if (index >= order.size () ||
+		&*parent_position != order[index])
+		same = false;
+checker.check ("parent traversal forward order",
+	true, same && index == order.size ());
+while (index)
+	if (&*--parent_position != order[--index])
+		same = false;
+checker.check ("parent traversal reverse order",
+	true, same);
+for (index = 0;
+	 index < order.size ();
+	 index++)
+	{
+	Aggregate::depth_iterator
+		position = Aggregate::depth_iterator (deep, true) + index;
+	if (&*position != order[index] ||
+		position - parent_end != (int)index - (int)order.size ())
+		same = false;
+	}
+checker.check ("parent traversal random access",
+	true, same);
+
+//	Ascents out of the Aggregates of a long Parameter list.
+Aggregate
+	wide_groups ("Wide_Groups");
+for (int
+		group = 0;
+		group < 500;
+		group++)
+	{
+	Aggregate
+		*outer = new Aggregate ("Outer"),
+		*inner = new Aggregate ("Inner");
+	inner->poke_back (new Assignment ("Value"));
+	outer->poke_back (new Assignment ("First"));
+	outer->poke_back (inner);
+	wide_groups.poke_back (outer);
+	}
+Aggregate::depth_iterator
+	stack_position = wide_groups.begin_depth (),
+	wide_position (wide_groups, true),
+	wide_end = wide_position.end_depth ();
+for (index = 0;
+	 wide_position != wide_end;
+	 ++wide_position, ++stack_position, ++index)
+	if (&*wide_position != &*stack_position ||
+		wide_position.depth () != stack_position.depth () ||
+		wide_position - wide_end != (int)index - (int)wide_groups.total_size ())
+		same = false;
+checker.check ("parent traversal ascends out of a long list",
+	true, same && index == wide_groups.total_size ());
+
+//	The Bottom Assignment follows the Before and Level of each depth.
+Aggregate::depth_iterator
+	stacked = deep.begin_depth () + 24,
+	copied (stacked),
+	moved (std::move (copied));
+checker.check ("depth_iterator moved beyond the inline stack",
+	true, moved == stacked && moved.depth () == 12);
+++moved;
+checker.check ("depth_iterator increment after move",
+	(void*)order[25], (void*)&*moved);
+checker.check ("depth_iterator copy unchanged",
+	(void*)order[24], (void*)&*stacked);
+++moved;
+checker.check ("depth_iterator ascends within the stack",
+	10, (int)moved.depth ());
+checker.check ("depth_iterator root beyond the inline stack",
+	(void*)&deep, (void*)stacked.root ());
+}
+
+//	Bulk move_in.
+if (checker.Verbose)
+	cout << "--- Aggregate::move_in" << endl;
+	{
+	Aggregate
+		source ("Source"),
+		target ("Target"),
+		empty ("Empty");
+	for (int
+			count = 0;
+			count < 100;
+			count++)
+		{
+		Aggregate
+			*group = new Aggregate ("Group", Parameter::GROUP);
+		group->add (Assignment ("A")).add (Assignment ("B"));
+		source.poke_back (group);
+		}
+	target.add (Assignment ("First"));
+	Aggregate
+		*inner = new Aggregate ("Inner");
+	target.poke_back (inner);
+	vector<const Parameter*>
+		entries;
+	for (Aggregate::iterator
+			parameter = source.begin ();
+			parameter != source.end ();
+		  ++parameter)
+		entries.push_back (&*parameter);
+
+	inner->move_in (source);
+	bool
+		moved = inner->size () == entries.size ();
+	for (size_t
+			index = 0;
+			moved && index < entries.size ();
+			index++)
+		if (&(*inner)[index] != entries[index] ||
+			(*inner)[index].parent () != inner)
+			moved = false;
+	checker.check ("move_in order and parents", true, moved);
+	checker.check ("move_in source emptied",
+		true, source.empty () && source.total_size () == 0);
+	checker.check ("move_in total_size", 300, (int)inner->total_size ());
+	checker.check ("move_in parent total_size", 302, (int)target.total_size ());
+	checker.check ("move_in find after move",
+		(void*)&(*inner)[99], (void*)target.find ("Inner/Group", false, 99));
+
+	empty.move_in (*inner);
+	checker.check ("move_in to a non-empty Aggregate",
+		true, inner->empty () && inner->total_size () == 0 &&
+			target.total_size () == 2);
+	inner->add (Assignment ("Last"));
+	inner->move_in (empty);
+	checker.check ("move_in appended",
+		true, inner->size () == 101 &&
+			(*inner)[0].name () == "Last" &&
+			&(*inner)[1] == entries[0] &&
+			(*inner)[100].parent () == inner);
+
+	Aggregate
+		&group = static_cast<Aggregate&>((*inner)[1]);
+	bool
+		thrown = false;
+	try {group.move_in (target);}
+	catch (Invalid_Argument)
+		{thrown = true;}
+	checker.check ("move_in of a parent throws Invalid_Argument",
+		true, thrown && target.size () == 2 && inner->parent () == &target &&
+			target.total_size () == 303 && group.size () == 2);
+
+	inner->move_in (*inner);
+	checker.check ("move_in from itself",
+		true, inner->size () == 101 && inner->total_size () == 301);
+	}
+
+//	Memory usage.
+if (checker.Verbose)
+	cout << "--- Aggregate::memory_usage ()" << endl;
+	{
+	Aggregate
+		label ("Label");
+	Memory_Usage
+		usage = label.memory_usage ();
+	checker.check ("memory_usage of an empty Aggregate",
+		true, usage.Nodes == sizeof (Aggregate) &&
+			usage.Node_Overhead == 0 &&
+			usage.Strings == label.name_symbol ().memory_usage () &&
+			usage.Lists == 0 && usage.Indices == 0);
+
+	string
+		long_name ("A_Parameter_Name_Longer_Than_Short_Strings");
+	Assignment
+		assignment (long_name);
+	assignment = String ("A String Value Longer Than Short Strings");
+	usage = assignment.memory_usage ();
+	checker.check ("memory_usage of an Assignment",
+		(int)(sizeof (Assignment) + sizeof (String)), (int)usage.Nodes);
+	checker.check ("memory_usage of the Assignment strings",
+		true, usage.Strings > long_name.size () + 40);
+	checker.check ("memory_usage of the Assignment heap Value node",
+		0, (int)usage.Node_Overhead);
+
+	label.reserve (64);
+	label.add (assignment).add (Assignment ("Short"));
+	usage = label.memory_usage ();
+	checker.check ("memory_usage of the Aggregate list",
+		(int)(2 * sizeof (Parameter*)), (int)usage.Lists);
+	checker.check ("memory_usage of the Aggregate list slack",
+		(int)((label.capacity () - 2) * sizeof (Parameter*)), (int)usage.Slack);
+	checker.check ("memory_usage Nodes",
+		(int)(sizeof (Aggregate) + 2 * sizeof (Assignment) +
+			sizeof (String) + sizeof (Integer)), (int)usage.Nodes);
+	label.indexed (true).find ("Short");
+	checker.check ("memory_usage of the pathname index",
+		true, label.memory_usage ().Indices > 0);
+
+	size_t
+		strings = assignment.memory_usage ().Strings;
+	assignment.name (Symbol::intern (long_name));
+	checker.check ("memory_usage of an interned name",
+		true, assignment.memory_usage ().Strings < strings);
+	}
+
+//	Per-thread pathname conventions.
+if (checker.Verbose)
+	cout << "--- Parameter::Conventions conventions ('.', true);" << endl;
+char
+	process_delimiter = Parameter::path_delimiter ();
+bool
+	process_case_sensitive = Parameter::case_sensitive ();
+	{
+	Parameter::Conventions
+		conventions ('.', true);
+	checker.check ("Conventions path_delimiter",
+		'.', Parameter::path_delimiter ());
+	checker.check ("Conventions case_sensitive",
+		true, Parameter::case_sensitive ());
+	Parameter::path_delimiter (':');
+	checker.check ("Conventions path_delimiter set in scope",
+		':', Parameter::path_delimiter ());
+	char
+		thread_delimiter = 0;
+	bool
+		thread_case_sensitive = false;
+	std::thread
+		other ([&thread_delimiter, &thread_case_sensitive] ()
+			{
+			thread_delimiter = Parameter::path_delimiter ();
+			thread_case_sensitive = Parameter::case_sensitive ();
+			});
+	other.join ();
+	checker.check ("Conventions other thread path_delimiter",
+		process_delimiter, thread_delimiter);
+	checker.check ("Conventions other thread case_sensitive",
+		process_case_sensitive, thread_case_sensitive);
+	}
+checker.check ("Conventions path_delimiter restored",
+	process_delimiter, Parameter::path_delimiter ());
+checker.check ("Conventions case_sensitive restored",
+	process_case_sensitive, Parameter::case_sensitive ());
+
+if (checker.Verbose)
+	cout << "--- indexed find with different delimiters" << endl;
+	{
+	Aggregate
+		top ("Top");
+	top.indexed (true);
+	Aggregate
+		*group = new Aggregate ("Group");
+	group->poke_back (new Assignment ("Member"));
+	top.poke_back (group);
+	const Parameter
+		*found = top.find (string (1, process_delimiter) + "Group"
+			+ process_delimiter + "Member");
+	const Parameter
+		*thread_found = NULL;
+	std::thread
+		other ([&top, &thread_found] ()
+			{
+			Parameter::Conventions
+				conventions ('.', false);
+			thread_found = top.find (".Group.Member");
+			});
+	other.join ();
+	checker.check ("Conventions indexed find",
+		(void*)&group->front (), (void*)found);
+	checker.check ("Conventions indexed find in other thread",
+		(void*)&group->front (), (void*)thread_found);
+	checker.check ("Conventions indexed find after other thread",
+		(void*)found, (void*)top.find (string (1, process_delimiter)
+			+ "Group" + process_delimiter + "Member"));
+	}
 }
 catch (Exception except)
 	{
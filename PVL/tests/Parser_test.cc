@@ -30,9 +30,52 @@ using namespace PVL;
 #include	<fstream>
 #include	<sstream>
 #include	<cstdlib>
+#include	<atomic>
+#include	<thread>
+#include	<vector>
 using namespace std;
 
 
+//	Node allocation accounting.
+std::atomic<long>
+	Allocated (0);
+
+void
+count_node
+	(
+	long			bytes,
+	const Arena*
+	)
+{Allocated += bytes;}
+
+
+//	Concurrent symbol interning.
+std::atomic<int>
+	Mismatched_Symbols (0);
+
+void
+intern_symbols
+	(
+	int		first
+	)
+{
+for (int
+		entry = 0;
+		entry < 2000;
+		entry++)
+	{
+	string
+		name ("Symbol_" + to_string ((first + entry) % 3000));
+	Symbol
+		interned = Symbol::intern (name);
+	if (! Symbol::lookup (name).is_interned () ||
+		! Symbol::lookup (name).equals (interned) ||
+		interned.str () != name)
+		++Mismatched_Symbols;
+	}
+}
+
+
 int
 main
 	(
@@ -202,6 +245,235 @@ expected[0] = new ostringstream;
 	<< "END" << endl;
 checker.check ("parsed parameters",
 	*expected[0], parameters);
+
+//	Memory usage.
+if (checker.Verbose)
+	cout << "--- Arena::node_hook (count_node);" << endl;
+Arena::Node_Hook
+	previous_hook = Arena::node_hook (count_node);
+Allocated = 0;
+ifstream
+	usage_input ("Parser_test.parameters");
+Parser
+	usage_parser (usage_input);
+Aggregate
+	*usage_aggregate =
+		dynamic_cast<Aggregate*>(usage_parser.get_parameters ());
+Memory_Usage
+	usage = usage_aggregate->memory_usage ();
+Arena::node_usage (usage_aggregate, usage);
+checker.check ("node hook counts the parsed nodes",
+	(int)(usage.Nodes + usage.Node_Overhead), (int)Allocated);
+checker.check ("node hook does not count the strings and lists",
+	true, (size_t)Allocated < usage.total ());
+checker.check ("heap nodes are not Arena nodes",
+	0, (int)usage.Arena_Nodes);
+checker.check ("memory usage of the parsed strings",
+	true, usage.Strings > 0);
+checker.check ("memory usage of the parsed lists",
+	true, usage.Lists >= 11 * sizeof (Parameter*));
+checker.check ("memory usage total",
+	true, usage.total () ==
+		usage.Nodes + usage.Node_Overhead + usage.Strings +
+		usage.Lists + usage.Slack + usage.Indices);
+checker.check ("memory usage of the Parser warnings",
+	true, usage_parser.memory_usage ().Warnings > 0);
+delete usage_aggregate;
+checker.check ("node hook counts the released nodes",
+	0, (int)Allocated);
+
+//	Arena.
+if (checker.Verbose)
+	cout << "--- Parser *arena_parser = new Parser (arena_input);" << endl
+		 << "--- arena_parser->arena (true);" << endl;
+ifstream
+	arena_input ("Parser_test.parameters");
+Parser
+	*arena_parser = new Parser (arena_input);
+arena_parser->arena (true);
+Arena
+	*arena = arena_parser->arena ();
+checker.check ("Parser arena enabled",
+	true, arena != NULL);
+Aggregate
+	*arena_aggregate =
+		dynamic_cast<Aggregate*>(arena_parser->get_parameters ());
+parameters.str ("");
+parameters << *arena_aggregate;
+checker.check ("arena parsed parameters",
+	*expected[0], parameters);
+checker.check ("arena contains the parsed root",
+	true, arena->contains (arena_aggregate));
+checker.check ("arena contains a parsed Value",
+	true, arena->contains (&arena_aggregate->find ("Integer_Number")->value ()));
+//	12 Parameters and 8 Values.
+checker.check ("arena node count",
+	20, (int)arena->nodes ());
+checker.check ("arena blocks",
+	1, (int)arena->blocks ());
+usage = arena_aggregate->memory_usage ();
+Arena::node_usage (arena_aggregate, usage);
+checker.check ("node hook counts the Arena nodes",
+	(int)(usage.Nodes + usage.Node_Overhead), (int)Allocated);
+//	The Arena also holds the memory of nodes the Parser has released.
+checker.check ("memory usage of the Arena nodes",
+	true, usage.Arena_Nodes == (size_t)Allocated &&
+		usage.Arena_Nodes <= arena->used ());
+if (checker.Verbose)
+	cout << "--- delete arena_parser;" << endl;
+delete arena_parser;
+checker.check ("arena remains after the Parser is deleted",
+	20, (int)arena->nodes ());
+delete arena_aggregate;
+checker.check ("node hook counts the released Arena nodes",
+	0, (int)Allocated);
+checker.check ("node hook restored",
+	true, Arena::node_hook (previous_hook) == count_node);
+
+//	Interned symbols.
+if (checker.Verbose)
+	cout << "--- intern_parser.intern_symbols (true);" << endl;
+ifstream
+	intern_input_1 ("Parser_test.parameters"),
+	intern_input_2 ("Parser_test.parameters");
+Parser
+	intern_parser_1 (intern_input_1),
+	intern_parser_2 (intern_input_2);
+intern_parser_1.intern_symbols (true);
+intern_parser_2.intern_symbols (true);
+checker.check ("Parser intern symbols enabled",
+	true, intern_parser_1.intern_symbols ());
+Aggregate
+	*intern_aggregate_1 =
+		dynamic_cast<Aggregate*>(intern_parser_1.get_parameters ()),
+	*intern_aggregate_2 =
+		dynamic_cast<Aggregate*>(intern_parser_2.get_parameters ());
+parameters.str ("");
+parameters << *intern_aggregate_1;
+checker.check ("interned parsed parameters",
+	*expected[0], parameters);
+Parameter
+	*intern_parameter_1 = intern_aggregate_1->find ("integer_number"),
+	*intern_parameter_2 = intern_aggregate_2->find ("Integer_Number");
+checker.check ("interned name found without case sensitivity",
+	true, intern_parameter_1 != NULL);
+checker.check ("interned name is interned",
+	true, intern_parameter_1->name_symbol ().is_interned ());
+checker.check ("interned names share their text",
+	(void*)&intern_parameter_1->name_symbol ().str (),
+	(void*)&intern_parameter_2->name_symbol ().str ());
+checker.check ("interned units share their text",
+	(void*)&intern_parameter_1->value ().units_symbol ().str (),
+	(void*)&intern_parameter_2->value ().units_symbol ().str ());
+checker.check ("interned names compare without case sensitivity",
+	true, intern_parameter_1->name_symbol ().equals
+		(Symbol::intern ("INTEGER_NUMBER"), false));
+checker.check ("interned names compare with case sensitivity",
+	false, intern_parameter_1->name_symbol ().equals
+		(Symbol::intern ("INTEGER_NUMBER"), true));
+delete intern_aggregate_1;
+delete intern_aggregate_2;
+checker.check ("Symbol is pointer sized",
+	(int)sizeof (void*), (int)sizeof (Symbol));
+vector<thread>
+	interning;
+for (int
+		first = 0;
+		first < 4;
+		first++)
+	interning.push_back (thread (intern_symbols, first * 500));
+for (vector<thread>::iterator
+		worker = interning.begin ();
+		worker != interning.end ();
+	  ++worker)
+	worker->join ();
+checker.check ("concurrent interned symbols",
+	0, (int)Mismatched_Symbols);
+checker.check ("concurrent interned symbol lookup",
+	true, Symbol::lookup ("Symbol_2999").is_interned () &&
+		Symbol::lookup ("symbol_2999").equals
+			(Symbol::intern ("SYMBOL_2999"), false));
+
+//	Comment stripping.
+if (checker.Verbose)
+	cout << "--- strip_parser.strip_comments (true);" << endl;
+string
+	commented;
+for (int
+		entry = 0;
+		entry < 50;
+		entry++)
+	commented +=
+		"/* The description of an archival label entry. */\n"
+		"/* Another line of the description. */\n"
+		"Entry = " + to_string (entry) + " <units>\n";
+commented += "END\n";
+Parser
+	keep_parser (commented),
+	strip_parser (commented);
+strip_parser.strip_comments (true);
+checker.check ("Parser strip comments enabled",
+	true, strip_parser.strip_comments ());
+Parameter
+	*kept = keep_parser.get_parameters (),
+	*stripped = strip_parser.get_parameters ();
+checker.check ("kept comments",
+	" The description of an archival label entry. \n"
+	" Another line of the description. ",
+	static_cast<Aggregate*>(kept)->find ("Entry")->comment ());
+bool
+	no_comments = true;
+for (Aggregate::depth_iterator
+		parameter = static_cast<Aggregate*>(stripped)->begin_depth ();
+		parameter != static_cast<Aggregate*>(stripped)->end_depth ();
+	  ++parameter)
+	if (! parameter->comment ().empty ())
+		no_comments = false;
+checker.check ("stripped comments",
+	true, no_comments && stripped->comment ().empty ());
+checker.check ("stripped parameters compare equal",
+	0, kept->compare (*stripped));
+checker.check ("stripped comments memory usage",
+	true, stripped->memory_usage ().Strings + 50 * 80 <
+		kept->memory_usage ().Strings);
+delete kept;
+delete stripped;
+
+//	Multi-line comments are still checked when stripping.
+if (checker.Verbose)
+	cout << "--- strict_strip_parser.strict (true).strip_comments (true);"
+		 << endl;
+Parser
+	strict_strip_parser ("/* A comment\n   on two lines. */\nEntry = 1\nEND\n");
+strict_strip_parser.strict (true).strip_comments (true);
+bool
+	multiline_thrown = false;
+try
+	{
+	delete strict_strip_parser.get_parameters ();
+	}
+catch (const idaeim::Exception&)
+	{
+	multiline_thrown =
+		strict_strip_parser.warnings () &&
+		dynamic_cast<const Multiline_Comment*>
+			(strict_strip_parser.warnings ()->back ()) != NULL;
+	}
+checker.check ("stripped multi-line comment in strict mode",
+	true, multiline_thrown);
+
+//	Array space reserved from the size estimate.
+if (checker.Verbose)
+	cout << "--- Parser sized (\"(1, (2, 3), \\\"a, b\\\", 4)\");" << endl;
+Parser
+	sized ("(1, (2, 3), \"a, b\", 4)");
+Value
+	*sized_value = sized.get_value ();
+checker.check ("reserved Array size",
+	4, (int)static_cast<Array*>(sized_value)->size ());
+checker.check ("reserved Array capacity",
+	5, (int)static_cast<Array*>(sized_value)->capacity ());
+delete sized_value;
 }
 catch (const Exception& except)
 	{
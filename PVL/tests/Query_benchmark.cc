@@ -0,0 +1,257 @@
+/*	Query_benchmark
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"PVL.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<string>
+#include	<vector>
+#include	<iostream>
+#include	<iomanip>
+#include	<chrono>
+#include	<cstdlib>
+using namespace std;
+
+/*	Usage: Query_benchmark [objects [repetitions]]
+
+	A label with the specified number of top level Objects is built.
+	Each Object contains a FILTER_NAME, a BAND_BIN Group with a few
+	Parameters, and an Array Value; every tenth Array has more than
+	1000 elements. Each query is then timed against the equivalent
+	find loop, or Depth_Iterator loop, with and without the pathname
+	index. The program exits with a non-zero status if any method
+	selects different Parameters.
+*/
+#ifndef DEFAULT_OBJECTS
+#define DEFAULT_OBJECTS			500
+#endif
+#ifndef DEFAULT_REPETITIONS
+#define DEFAULT_REPETITIONS		5
+#endif
+
+
+Assignment*
+assignment
+	(
+	const string&	name,
+	const Value&	value
+	)
+{
+Assignment
+	*parameter = new Assignment (name);
+*parameter = value;
+return parameter;
+}
+
+
+Aggregate*
+label_of
+	(
+	int		objects
+	)
+{
+Aggregate
+	*label = new Aggregate (Parser::CONTAINER_NAME);
+for (int
+		object = 0;
+	 object < objects;
+	 object++)
+	{
+	Aggregate
+		*image = new Aggregate ("IMAGE_" + to_string (object), Parameter::OBJECT);
+	image->poke_back (assignment ("LINES", Integer (1024)));
+	image->poke_back (assignment ("SAMPLES", Integer (2048)));
+	image->poke_back (assignment ("FILTER_NAME", String ("RED")));
+	Aggregate
+		*band_bin = new Aggregate ("BAND_BIN", Parameter::GROUP);
+	band_bin->poke_back (assignment ("CENTER", Real (1.5)));
+	band_bin->poke_back (assignment ("WIDTH", Real (0.1)));
+	band_bin->poke_back (assignment ("FILTER_NAME", String ("GREEN")));
+	image->poke_back (band_bin);
+	Array
+		samples (Value::SEQUENCE);
+	for (int
+			element = (object % 10) ? 16 : 1024;
+		 element;
+		 element--)
+		samples.push_back (Integer (element));
+	image->poke_back (assignment ("SAMPLE_VALUES", samples));
+	label->poke_back (image);
+	}
+return label;
+}
+
+
+//	Elapsed microseconds for repeated calls of a selection method.
+template<typename Method>
+double
+timed
+	(
+	int						repetitions,
+	Method					method,
+	vector<Parameter*>&		selected
+	)
+{
+chrono::steady_clock::time_point
+	start = chrono::steady_clock::now ();
+for (int
+		repetition = 0;
+	 repetition < repetitions;
+	 repetition++)
+	{
+	selected.clear ();
+	method (selected);
+	}
+return chrono::duration<double, micro>
+	(chrono::steady_clock::now () - start).count () / repetitions;
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Query benchmark" << endl
+	 << Query::ID << endl << endl;
+
+int
+	objects = (count > 1) ? atoi (arguments[1]) : DEFAULT_OBJECTS,
+	repetitions = (count > 2) ? atoi (arguments[2]) : DEFAULT_REPETITIONS;
+if (objects <= 0)
+	objects = DEFAULT_OBJECTS;
+if (repetitions <= 0)
+	repetitions = DEFAULT_REPETITIONS;
+Aggregate
+	*label = label_of (objects);
+cout << objects << " Objects, "
+	 << label->total_size () << " Parameters, "
+	 << repetitions << " repetitions" << endl << endl
+	 << setw (24) << left << "query"
+	 << setw (10) << right << "indexed"
+	 << setw (14) << "loop usec"
+	 << setw (14) << "Query usec"
+	 << setw (10) << "matches" << endl;
+
+const char
+	*expressions[] =
+		{
+		"/*/FILTER_NAME",
+		"//BAND_BIN/*",
+		"[Array][SIZE > 1000]"
+		};
+bool
+	same = true;
+for (int
+		indexed = 0;
+	 indexed < 2;
+	 indexed++)
+	{
+	label->indexed (indexed != 0);
+	for (int
+			expression = 0;
+		 expression < 3;
+		 expression++)
+		{
+		vector<Parameter*>
+			looped,
+			queried;
+		double
+			loop_time = 0;
+		switch (expression)
+			{
+			case 0:
+				//	Every FILTER_NAME, keeping those in top level Aggregates.
+				loop_time = timed (repetitions, [label] (vector<Parameter*>& selected)
+					{
+					Parameter
+						*parameter;
+					for (int
+							skip = 0;
+						 (parameter = label->find ("FILTER_NAME", false, skip));
+						 skip++)
+						if (parameter->parent ()->parent () == label)
+							selected.push_back (parameter);
+					}, looped);
+				break;
+			case 1:
+				//	The contents of every BAND_BIN Aggregate.
+				loop_time = timed (repetitions, [label] (vector<Parameter*>& selected)
+					{
+					Parameter
+						*parameter;
+					for (int
+							skip = 0;
+						 (parameter = label->find
+							("BAND_BIN", false, skip, Parameter::AGGREGATE));
+						 skip++)
+						{
+						Aggregate
+							*band_bin = static_cast<Aggregate*>(parameter);
+						for (Aggregate::iterator
+								element = band_bin->begin ();
+							 element != band_bin->end ();
+							 ++element)
+							selected.push_back (&(*element));
+						}
+					}, looped);
+				break;
+			case 2:
+				//	Every Assignment with a large Array Value.
+				loop_time = timed (repetitions, [label] (vector<Parameter*>& selected)
+					{
+					for (Aggregate::Depth_Iterator
+							parameter = label->begin_depth ();
+						 parameter != label->end_depth ();
+						 ++parameter)
+						if (parameter->is_Assignment () &&
+							parameter->value ().is_Array () &&
+							static_cast<const Array&>(parameter->value ()).size ()
+								> 1000)
+							selected.push_back (&(*parameter));
+					}, looped);
+				break;
+			}
+		Query
+			query (expressions[expression]);
+		double
+			query_time = timed (repetitions, [&query, label]
+				(vector<Parameter*>& selected)
+				{selected = query.evaluate (*label);}, queried);
+		cout << setw (24) << left << expressions[expression]
+			 << setw (10) << right << (indexed ? "yes" : "no")
+			 << setw (14) << fixed << setprecision (1) << loop_time
+			 << setw (14) << query_time
+			 << setw (10) << queried.size ();
+		if (looped != queried)
+			{
+			cout << "  MISMATCH (" << looped.size () << " by the loop)";
+			same = false;
+			}
+		cout << endl;
+		}
+	}
+delete label;
+
+exit (same ? 0 : 1);
+}
@@ -0,0 +1,275 @@
+/*	Query_test
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"PVL.hh"
+#include	"Utility/Checker.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<string>
+#include	<vector>
+#include	<iostream>
+#include	<sstream>
+#include	<cstdlib>
+using namespace std;
+
+
+//	The pathnames of the selected Parameters, one per line.
+string
+pathnames
+	(
+	const vector<Parameter*>&	parameters,
+	const Aggregate&			root
+	)
+{
+string
+	listing;
+for (vector<Parameter*>::const_iterator
+		parameter = parameters.begin ();
+	 parameter != parameters.end ();
+	 ++parameter)
+	listing += (*parameter)->pathname (&root) + '\n';
+return listing;
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Query class test" << endl
+	 << Query::ID << endl << endl;
+
+Checker
+	checker;
+
+if (count > 1)
+	{
+	if (*arguments[1] == '-')
+		 arguments[1]++;
+	if (*arguments[1] == 'v' ||
+		*arguments[1] == 'V')
+		checker.Verbose = true;
+	}
+
+try {
+
+string
+	parameters
+		("Object = Image\n"
+		 "  Lines = 1024\n"
+		 "  Samples = 2048\n"
+		 "  Filter_Name = Red\n"
+		 "  Group = Band_Bin\n"
+		 "    Center = (1.0, 2.0, 3.0)\n"
+		 "    Width = (0.1, 0.2, 0.3)\n"
+		 "    Filter_Name = (Red, Green, Blue)\n"
+		 "  End_Group\n"
+		 "End_Object\n"
+		 "Object = Spectrum\n"
+		 "  Filter_Name = \"Near Infrared\"\n"
+		 "  Group = Band_Bin\n"
+		 "    Center = 1.5\n"
+		 "  End_Group\n"
+		 "End_Object\n"
+		 "Filter_Name = None\n"
+		 "Target = Mars\n");
+Parser
+	parser (parameters);
+Aggregate
+	label (parser, Parser::CONTAINER_NAME);
+
+for (int
+		indexed = 0;
+	 indexed < 2;
+	 indexed++)
+	{
+	label.indexed (indexed != 0);
+	string
+		mode (indexed ? " (indexed)" : "");
+
+	//	Absolute wildcard.
+	if (checker.Verbose)
+		cout << "--- Query (\"/*/FILTER_NAME\").evaluate (label)" << mode << endl;
+	checker.check ("top level Aggregate names" + mode,
+		string
+		("/Image/Filter_Name\n"
+		 "/Spectrum/Filter_Name\n"),
+		pathnames (Query ("/*/FILTER_NAME").evaluate (label), label));
+
+	//	Relative.
+	checker.check ("relative name" + mode,
+		string
+		("/Image/Filter_Name\n"
+		 "/Image/Band_Bin/Filter_Name\n"
+		 "/Spectrum/Filter_Name\n"
+		 "/Filter_Name\n"),
+		pathnames (Query ("Filter_Name").evaluate (label), label));
+	checker.check ("relative pathname" + mode,
+		string
+		("/Image/Band_Bin/Center\n"
+		 "/Spectrum/Band_Bin/Center\n"),
+		pathnames (Query ("band_bin/center").evaluate (label), label));
+
+	//	Descendants.
+	checker.check ("Aggregate contents" + mode,
+		string
+		("/Image/Band_Bin/Center\n"
+		 "/Image/Band_Bin/Width\n"
+		 "/Image/Band_Bin/Filter_Name\n"
+		 "/Spectrum/Band_Bin/Center\n"),
+		pathnames (Query ("//BAND_BIN/*").evaluate (label), label));
+	checker.check ("absolute descendant" + mode,
+		string
+		("/Image/Filter_Name\n"
+		 "/Image/Band_Bin/Filter_Name\n"),
+		pathnames (Query ("/Image//Filter_Name").evaluate (label), label));
+	checker.check ("all descendants" + mode,
+		string
+		("/Spectrum/Filter_Name\n"
+		 "/Spectrum/Band_Bin\n"
+		 "/Spectrum/Band_Bin/Center\n"),
+		pathnames (Query ("/Spectrum//").evaluate (label), label));
+
+	//	Wildcards and case sensitivity.
+	checker.check ("single character wildcard" + mode,
+		string
+		("/Image/Band_Bin/Width\n"),
+		pathnames (Query ("W?DTH").evaluate (label), label));
+	checker.check ("case sensitive" + mode,
+		string
+		(""),
+		pathnames (Query ("/*/FILTER_NAME", true).evaluate (label), label));
+	checker.check ("case sensitive match" + mode,
+		string
+		("/Image/Filter_Name\n"
+		 "/Spectrum/Filter_Name\n"),
+		pathnames (Query ("/*/Filter_Name", true).evaluate (label), label));
+	checker.check ("absolute literal" + mode,
+		string
+		("/Image/Band_Bin/Center\n"),
+		pathnames (Query ("/image/band_bin/center").evaluate (label), label));
+
+	//	Predicates.
+	checker.check ("Array type predicate" + mode,
+		string
+		("/Image/Band_Bin/Center\n"
+		 "/Image/Band_Bin/Width\n"
+		 "/Image/Band_Bin/Filter_Name\n"),
+		pathnames (Query ("[Array]").evaluate (label), label));
+	checker.check ("size predicate" + mode,
+		string
+		("/Image/Band_Bin/Center\n"
+		 "/Image/Band_Bin/Width\n"
+		 "/Image/Band_Bin/Filter_Name\n"),
+		pathnames (Query ("[ASSIGNMENT][SIZE > 1]").evaluate (label), label));
+	checker.check ("Group predicate" + mode,
+		string
+		("/Image/Band_Bin\n"
+		 "/Spectrum/Band_Bin\n"),
+		pathnames (Query ("[Group]").evaluate (label), label));
+	checker.check ("numeric value predicate" + mode,
+		string
+		("/Image/Samples\n"),
+		pathnames (Query ("//*[VALUE >= 2000]").evaluate (label), label));
+	checker.check ("string value predicate" + mode,
+		string
+		("/Spectrum/Filter_Name\n"),
+		pathnames (Query ("Filter_Name [VALUE = \"near *\"]").evaluate (label), label));
+	checker.check ("Aggregate size predicate" + mode,
+		string
+		("/Image\n"),
+		pathnames (Query ("/*[SIZE = 4]").evaluate (label), label));
+
+	//	Programmatic predicate.
+	Query
+		query ("Center");
+	query.where ([] (const Parameter& parameter)
+		{return parameter.value ().is_Real ();});
+	checker.check ("where predicate" + mode,
+		string
+		("/Spectrum/Band_Bin/Center\n"),
+		pathnames (query.evaluate (label), label));
+
+	//	First and count.
+	checker.check ("first" + mode,
+		(void*)label.find ("/Image/Band_Bin/Filter_Name"),
+		(void*)Query ("Band_Bin/Filter_Name").first (label));
+	checker.check ("first none" + mode,
+		(void*)NULL,
+		(void*)Query ("/Nothing").first (label));
+	checker.check ("count" + mode,
+		4, (int)Query ("Filter_Name").count (label));
+	}
+label.indexed (false);
+
+//	matches.
+Parameter
+	*parameter = label.find ("/Image/Band_Bin/Width");
+checker.check ("matches",
+	true, Query ("/Image//Width").matches (*parameter));
+checker.check ("matches relative to an Aggregate",
+	true, Query ("/Band_Bin/Width").matches
+		(*parameter, dynamic_cast<const Aggregate*>(label.find ("Image"))));
+checker.check ("does not match outside the root",
+	false, Query ("Width").matches
+		(*parameter, dynamic_cast<const Aggregate*>(label.find ("Spectrum"))));
+
+//	Syntax errors.
+const char
+	*invalid[] =
+		{
+		"",
+		"/",
+		"A///B",
+		"Name[Array",
+		"Name[Unknown]",
+		"Name[SIZE > many]",
+		"Name[VALUE ~ 3]",
+		"Name[Array] extra"
+		};
+for (unsigned int
+		index = 0;
+	 index < sizeof (invalid) / sizeof (invalid[0]);
+	 index++)
+	{
+	bool
+		thrown = false;
+	try {Query query (invalid[index]);}
+	catch (const Invalid_Syntax&) {thrown = true;}
+	checker.check (string ("Invalid_Syntax for \"") + invalid[index] + '"',
+		true, thrown);
+	}
+}
+catch (const Exception& except)
+	{
+	cout << except.message () << endl;
+	checker.check (false);
+	}
+
+cout << endl
+	 << "Checks: " << checker.Checks_Total << endl
+	 << "Passed: " << checker.Checks_Passed << endl;
+
+exit ((checker.Checks_Total == checker.Checks_Passed) ? 0 : 1);
+}
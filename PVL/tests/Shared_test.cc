@@ -0,0 +1,162 @@
+/*	Shared_test
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"Shared.hh"
+#include	"Parameter.hh"
+#include	"Value.hh"
+#include	"Parser.hh"
+#include	"Utility/Checker.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<iostream>
+#include	<sstream>
+using namespace std;
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Shared class test" << endl
+	 << Parameter::ID << endl << endl;
+
+Checker
+	checker;
+
+if (count > 1)
+	{
+	if (*arguments[1] == '-')
+		 arguments[1]++;
+	if (*arguments[1] == 'v' ||
+		*arguments[1] == 'V')
+		checker.Verbose = true;
+	}
+
+ostringstream
+	expected,
+	listing;
+
+try {
+
+string
+	parameters
+		("Group = Image\n"
+		 "  Lines = 1024\n"
+		 "  Samples = 2048\n"
+		 "End_Group\n"
+		 "Target = Mars\n");
+Parser
+	parser (parameters);
+Aggregate
+	label (parser, Parser::CONTAINER_NAME);
+listing << label;
+
+//	Construct.
+if (checker.Verbose)
+	cout << "--- Shared_Aggregate original (std::move (label));" << endl;
+Shared_Aggregate
+	original (std::move (label));
+expected << *original;
+checker.check ("Shared_Aggregate moved in",
+	listing, expected);
+checker.check ("Shared_Aggregate moved from is empty",
+	0, (int)label.size ());
+checker.check ("Shared_Aggregate not shared",
+	false, original.is_shared ());
+
+//	Copy.
+if (checker.Verbose)
+	cout << "--- Shared_Aggregate snapshot (original);" << endl;
+Shared_Aggregate
+	snapshot (original);
+checker.check ("Shared_Aggregate copy is shared",
+	true, snapshot.shares_with (original));
+checker.check ("Shared_Aggregate copy share count",
+	2, (int)original.shares ());
+checker.check ("Shared_Aggregate copy refers to the same tree",
+	(void*)&*original, (void*)&*snapshot);
+
+//	Read does not copy.
+if (checker.Verbose)
+	cout << "--- snapshot->find (\"Image/Lines\");" << endl;
+const Parameter
+	*lines = snapshot->find ("Image/Lines");
+checker.check ("Shared_Aggregate find",
+	(void*)&(*original)[0][0], (void*)lines);
+checker.check ("Shared_Aggregate still shared after read",
+	true, snapshot.shares_with (original));
+
+//	Modify.
+if (checker.Verbose)
+	cout << "--- original.modify ()[1] = String (\"Moon\");" << endl;
+original.modify ()[1] = String ("Moon");
+checker.check ("Shared_Aggregate not shared after modify",
+	false, snapshot.shares_with (original));
+checker.check ("Shared_Aggregate modified value",
+	Value::String_type ("Moon"),
+	static_cast<Value::String_type>(original->find ("Target")->value ()));
+checker.check ("Shared_Aggregate snapshot value unchanged",
+	Value::String_type ("Mars"),
+	static_cast<Value::String_type>(snapshot->find ("Target")->value ()));
+checker.check ("Shared_Aggregate modified parent",
+	(void*)&*original, (void*)(*original)[1].parent ());
+checker.check ("Shared_Aggregate snapshot parent",
+	(void*)&*snapshot, (void*)(*snapshot)[1].parent ());
+
+//	Modify unshared.
+if (checker.Verbose)
+	cout << "--- original.modify ();" << endl;
+const Aggregate
+	*tree = &*original;
+original.modify ();
+checker.check ("Shared_Aggregate unshared modify does not copy",
+	(void*)tree, (void*)&*original);
+
+//	Array.
+if (checker.Verbose)
+	cout << "--- Shared_Array array; array.modify ().add (Integer (1));"
+			<< endl;
+Shared_Array
+	array;
+array.modify ().add (Integer (1));
+Shared_Array
+	array_snapshot (array);
+array.modify ().add (Integer (2));
+checker.check ("Shared_Array modified size",
+	2, (int)array->size ());
+checker.check ("Shared_Array snapshot size",
+	1, (int)array_snapshot->size ());
+}
+catch (Exception except)
+	{
+	cout << except.message () << endl;
+	checker.check (false);
+	}
+
+cout << endl
+	 << "Checks: " << checker.Checks_Total << endl
+	 << "Passed: " << checker.Checks_Passed << endl;
+
+exit ((checker.Checks_Total == checker.Checks_Passed) ? 0 : 1);
+}
@@ -0,0 +1,275 @@
+/*	Sort_benchmark
+
+Copyright (C) 2026  The idaeim PVL contributors
+
+This file is part of the idaeim libraries.
+
+The idaeim libraries are free software; you can redistribute them and/or
+modify them under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+The idaeim libraries are distributed in the hope that they will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************/
+
+#include	"PVL.hh"
+using namespace idaeim;
+using namespace PVL;
+
+#include	<string>
+#include	<vector>
+#include	<unordered_map>
+#include	<memory>
+#include	<iostream>
+#include	<iomanip>
+#include	<chrono>
+#include	<cstdlib>
+using namespace std;
+
+/*	Usage: Sort_benchmark [elements [bubble_elements]]
+
+	An Array of String Values and an Aggregate of Assignments, each with
+	the specified number of elements in a pseudo-random order with many
+	duplicates, are sorted by the sort and parallel_sort functions. The
+	bubble sort that the sort functions replaced is timed on the first
+	bubble_elements of each list, and the sort functions are timed on
+	the same shorter lists for comparison. The program exits with a
+	non-zero status if any of the sorts does not produce the same order
+	of the element pointers.
+*/
+#ifndef DEFAULT_ELEMENTS
+#define DEFAULT_ELEMENTS			200000
+#endif
+#ifndef DEFAULT_BUBBLE_ELEMENTS
+#define DEFAULT_BUBBLE_ELEMENTS		5000
+#endif
+
+
+//	The bubble sort the sort functions replaced.
+template<typename Container>
+void
+bubble_sort
+	(
+	typename Container::iterator	first,
+	typename Container::iterator	last
+	)
+{
+if (first == last)
+	return;
+typename Container::Base_iterator
+	bubble,
+	this_element;
+for (--last;
+	 first != last;
+	 --last)
+	{
+	bubble = first;
+	do
+		{
+		this_element = bubble;
+		 ++bubble;
+		if (**bubble < **this_element)
+			swap (*bubble, *this_element);
+		}
+		while (bubble != last);
+	}
+}
+
+
+string
+key_of
+	(
+	int		element
+	)
+{return "KEY_" + to_string ((element * 7919) % 10007);}
+
+
+Array*
+strings_of
+	(
+	int		elements
+	)
+{
+Array
+	*array = new Array;
+for (int
+		element = 0;
+	 element < elements;
+	 element++)
+	array->push_back (String (key_of (element)));
+return array;
+}
+
+
+Aggregate*
+assignments_of
+	(
+	int		elements
+	)
+{
+Aggregate
+	*aggregate = new Aggregate ("Sort");
+for (int
+		element = 0;
+	 element < elements;
+	 element++)
+	{
+	Assignment
+		*assignment = new Assignment (key_of (element));
+	*assignment = Integer (element % 7);
+	aggregate->poke_back (assignment);
+	}
+return aggregate;
+}
+
+
+//	The original positions of the elements of a list in their current order.
+template<typename Container>
+vector<size_t>
+order_of
+	(
+	const Container&							container,
+	const unordered_map<const void*, size_t>&	positions
+	)
+{
+vector<size_t>
+	order;
+for (typename Container::const_iterator
+		element = container.begin ();
+		element != container.end ();
+		++element)
+	order.push_back (positions.at (&*element));
+return order;
+}
+
+
+enum Method {BUBBLE, SORT, PARALLEL, METHODS};
+
+/*	Times the sort methods, from the first method on, on new lists of
+	the specified size and reports whether the methods all produce the
+	same order.
+*/
+template<typename Container>
+bool
+compare
+	(
+	Container*		(*list_of)(int),
+	int				size,
+	int				first_method
+	)
+{
+static const char* const
+	METHOD_NAMES[] = {"bubble", "sort", "parallel_sort"};
+bool
+	same = true;
+vector<size_t>
+	expected;
+for (int
+		method = first_method;
+	 method < METHODS;
+	 method++)
+	{
+	std::unique_ptr<Container>
+		list (list_of (size));
+	unordered_map<const void*, size_t>
+		positions;
+	for (typename Container::const_iterator
+			element = list->begin ();
+			element != list->end ();
+			++element)
+		positions.emplace (&*element, positions.size ());
+
+	chrono::steady_clock::time_point
+		start = chrono::steady_clock::now ();
+	switch (method)
+		{
+		case BUBBLE:
+			bubble_sort<Container> (list->begin (), list->end ());
+			break;
+		case SORT:
+			sort (list->begin (), list->end ());
+			break;
+		case PARALLEL:
+			parallel_sort (list->begin (), list->end ());
+			break;
+		}
+	double
+		time = chrono::duration<double, milli>
+			(chrono::steady_clock::now () - start).count ();
+
+	cout << setw (16) << left << METHOD_NAMES[method]
+		 << setw (12) << right << size
+		 << setw (14) << right << time;
+	vector<size_t>
+		order (order_of (*list, positions));
+	if (expected.empty ())
+		expected = order;
+	else if (order != expected)
+		{
+		cout << "  MISMATCH";
+		same = false;
+		}
+	cout << endl;
+	}
+return same;
+}
+
+
+template<typename Container>
+bool
+benchmark
+	(
+	const char*		description,
+	Container*		(*list_of)(int),
+	int				elements,
+	int				bubble_elements
+	)
+{
+cout << description << endl
+	 << setw (16) << left << "method"
+	 << setw (12) << right << "elements"
+	 << setw (14) << right << "msec" << endl
+	 << fixed << setprecision (2);
+bool
+	same =
+		compare (list_of, bubble_elements, BUBBLE) &
+		compare (list_of, elements, SORT);
+cout << endl;
+return same;
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**arguments
+	)
+{
+cout << "*** Sort benchmark" << endl << endl;
+
+int
+	elements = (count > 1) ? atoi (arguments[1]) : DEFAULT_ELEMENTS,
+	bubble_elements = (count > 2) ? atoi (arguments[2]) : DEFAULT_BUBBLE_ELEMENTS;
+if (elements <= 0)
+	elements = DEFAULT_ELEMENTS;
+if (bubble_elements <= 0 ||
+	bubble_elements > elements)
+	bubble_elements = (elements < DEFAULT_BUBBLE_ELEMENTS) ?
+		elements : DEFAULT_BUBBLE_ELEMENTS;
+
+bool
+	same =
+		benchmark<Array> ("Array of Strings", strings_of,
+			elements, bubble_elements) &
+		benchmark<Aggregate> ("Aggregate of Assignments", assignments_of,
+			elements, bubble_elements);
+
+exit (same ? 0 : 1);
+}
@@ -31,6 +31,8 @@ using namespace PVL;
 #include	<sstream>
 #include	<algorithm>
 #include	<functional>
+#include	<vector>
+#include	<string>
 using namespace std;
 
 
@@ -519,6 +521,40 @@ if (checker.Verbose)
 checker.check ("Array, get last element (back), compare to String.",
 	true, list_copy.back () == (String)"Text");
 
+//	Move.
+if (checker.Verbose)
+	cout << "--- Array list_moved (std::move (list_copy));" << endl;
+Value
+	*last_value = list_copy.peek_back ();
+Array
+	list_moved (std::move (list_copy));
+checker.check ("Array, move constructor, size.",
+	6, (int)list_moved.size ());
+checker.check ("Array, move constructor, source emptied.",
+	0, (int)list_copy.size ());
+checker.check ("Array, move constructor, Value not cloned.",
+	(void*)last_value, (void*)list_moved.peek_back ());
+checker.check ("Array, move constructor, Value parent.",
+	(void*)&list_moved, (void*)last_value->parent ());
+
+if (checker.Verbose)
+	cout << "--- list_copy = std::move (list_moved);" << endl;
+list_copy = std::move (list_moved);
+listing << list_copy;
+expected << "{16#ABC# <integer>, Text, 23 <number>, 2748.0 <integer>, 23.0, Text}";
+checker.check ("Array, move assignment.",
+	expected, listing);
+checker.check ("Array, move assignment, Value parent.",
+	(void*)&list_copy, (void*)last_value->parent ());
+
+if (checker.Verbose)
+	cout << "--- String moved_string (std::move (String (\"Moved\")));"
+			<< endl;
+String
+	moved_string (std::move (String ("Moved")));
+checker.check ("String, move constructor.",
+	true, moved_string == (String)"Moved");
+
 //	Function sort.
 if (checker.Verbose)
 	cout << "--- sort (list_copy.begin (), list_copy.end ());" << endl;
@@ -528,6 +564,70 @@ expected << "{23 <number>, 23.0, 16#ABC# <integer>, 2748.0 <integer>, Text, Text
 checker.check ("Array, sort.",
 	expected, listing);
 
+//	Function parallel_sort.
+if (checker.Verbose)
+	cout << "--- parallel_sort (strings.begin (), strings.end (), 4);" << endl;
+Array
+	strings;
+for (int
+		index = 0;
+	 index < 50000;
+	 index++)
+	strings.push_back (String (to_string ((index * 7919) % 10007)));
+vector<const Value*>
+	unsorted;
+for (Array::const_iterator
+		element = strings.begin ();
+		element != strings.end ();
+		++element)
+	unsorted.push_back (&*element);
+//	The expected order of the Value pointers, with equal Values in order.
+vector<const Value*>
+	stable_order (unsorted);
+stable_sort (stable_order.begin (), stable_order.end (),
+	[] (const Value* value_1, const Value* value_2)
+		{return (Value::String_type)*value_1 < (Value::String_type)*value_2;});
+parallel_sort (strings.begin (), strings.end (), 4);
+bool
+	stable = true;
+for (unsigned int
+		index = 0;
+	 index < strings.size ();
+	 index++)
+	if (&strings[index] != stable_order[index])
+		stable = false;
+checker.check ("Array, parallel_sort.",
+	true, stable);
+
+//	Function sort is stable.
+if (checker.Verbose)
+	cout << "--- sort (strings.begin (), strings.end ());" << endl;
+strings.clear ();
+for (int
+		index = 0;
+	 index < 50000;
+	 index++)
+	strings.push_back (String (to_string ((index * 7919) % 10007)));
+for (unsigned int
+		index = 0;
+	 index < strings.size ();
+	 index++)
+	unsorted[index] = &strings[index];
+stable_order = unsorted;
+stable_sort (stable_order.begin (), stable_order.end (),
+	[] (const Value* value_1, const Value* value_2)
+		{return (Value::String_type)*value_1 < (Value::String_type)*value_2;});
+sort (strings.begin (), strings.end ());
+stable = true;
+for (unsigned int
+		index = 0;
+	 index < strings.size ();
+	 index++)
+	if (&strings[index] != stable_order[index])
+		stable = false;
+checker.check ("Array, sort is stable.",
+	true, stable);
+
 //	Algorithm count_if on Iterator.
 if (checker.Verbose)
 	cout << "--- number = count_if (list.begin (), list.end ()," << endl
@@ -799,6 +899,225 @@ if (checker.check ("Array, find Real (1.4)",
 else if (checker.Verbose)
 	cout << "    Array: " << *array << endl;
 
+//	Random-access Depth_Iterator.
+if (checker.Verbose)
+	cout << "--- Array::depth_iterator random access" << endl;
+{
+Array
+	wide;
+for (int
+		index = 0;
+	 index < 40;
+	 index++)
+	{
+	if (index % 5)
+		wide.add (Integer (index));
+	else
+		{
+		Array
+			*set = new Array (Value::SET);
+		for (int
+				member = 0;
+			 member < 20;
+			 member++)
+			{
+			if (member % 3)
+				set->add (Integer (member));
+			else
+				{
+				Array
+					*inner = new Array;
+				inner->add (Integer (-1));
+				inner->add (Integer (-2));
+				set->add (inner);
+				}
+			}
+		wide.add (set);
+		}
+	}
+
+//	Compares random access with stepping through the hierarchy.
+std::function<bool (Array&)>
+	consistent = [] (Array& array)
+	{
+	vector<Value*>
+		order;
+	for (Array::depth_iterator
+			position = array.begin_depth ();
+			position != array.end_depth ();
+		  ++position)
+		order.push_back (&*position);
+	if (array.total_size () != order.size ())
+		return false;
+	Array::depth_iterator
+		first = array.begin_depth (),
+		last = array.end_depth ();
+	if (last - first != (int)order.size () ||
+		first + order.size () != last)
+		return false;
+	for (int
+			index = 0;
+			index < (int)order.size ();
+			index++)
+		{
+		Array::depth_iterator
+			position = first + index;
+		if (&*position != order[index] ||
+			position - first != index ||
+			last - position != (int)order.size () - index ||
+			&*(position - index / 2) != order[index - index / 2] ||
+			(first < position) != (index > 0) ||
+			! (position < last) ||
+			first - Array::iterator (position) != -index)
+			return false;
+		}
+	return true;
+	};
+
+checker.check ("Array, total_size.",
+	40 + 8 * (20 + 7 * 2), (int)wide.total_size ());
+checker.check ("Array, depth_iterator random access.",
+	true, consistent (wide));
+
+Array::depth_iterator
+	offset = wide.begin_depth () + 5;
+bool
+	out_of_range = false;
+try {offset += wide.total_size ();}
+catch (const Out_of_Range&) {out_of_range = true;}
+checker.check ("Array, depth_iterator offset past the end throws Out_of_Range.",
+	true, out_of_range);
+checker.check ("Array, depth_iterator unmoved by Out_of_Range.",
+	(void*)&*(wide.begin_depth () + 5), (void*)&*offset);
+
+Array
+	&set = static_cast<Array&>(wide[10]);
+delete set.remove ((Array::size_type)3);
+set.poke (7, new Array);
+static_cast<Array&>(set[7]).add (Integer (0));
+checker.check ("Array, total_size after nested changes.",
+	40 + 8 * (20 + 7 * 2) - 3 + 2, (int)wide.total_size ());
+checker.check ("Array, depth_iterator random access after nested changes.",
+	true, consistent (wide));
+
+Array
+	moved;
+moved.move_in (set);
+checker.check ("Array, total_size after move_in.",
+	40 + 8 * (20 + 7 * 2) - 3 + 2 - 33, (int)wide.total_size ());
+checker.check ("Array, total_size of the moved Values.",
+	20 + 7 * 2 - 3 + 2, (int)moved.total_size ());
+checker.check ("Array, depth_iterator random access after move_in.",
+	true, consistent (wide));
+
+sort (wide.begin_depth (), wide.end_depth ());
+checker.check ("Array, depth_iterator random access after sort.",
+	true, consistent (wide));
+
+Array
+	copy (wide);
+checker.check ("Array, total_size of a copy.",
+	(int)wide.total_size (), (int)copy.total_size ());
+copy = moved;
+checker.check ("Array, total_size after assignment.",
+	(int)moved.total_size (), (int)copy.total_size ());
+checker.check ("Array, depth_iterator random access after assignment.",
+	true, consistent (copy));
+
+Array::depth_iterator
+	stacked = wide.begin_depth (),
+	parent_position (wide, true);
+bool
+	same = true;
+for (;
+	 stacked != wide.end_depth ();
+	 ++stacked, ++parent_position)
+	if (&*stacked != &*parent_position ||
+		stacked.depth () != parent_position.depth ())
+		same = false;
+checker.check ("Array, depth_iterator parent traversal.",
+	true, same && parent_position == wide.end_depth ());
+parent_position = Array::depth_iterator (wide, true).end_depth ();
+parent_position -= wide.total_size () - 100;
+checker.check ("Array, depth_iterator parent traversal random access.",
+	(void*)&*(wide.begin_depth () + 100), (void*)&*parent_position);
+}
+
+//	Bulk move_in.
+if (checker.Verbose)
+	cout << "--- Array::move_in" << endl;
+	{
+	Array
+		source,
+		target,
+		empty;
+	for (int
+			count = 0;
+			count < 100;
+			count++)
+		{
+		Array
+			*set = new Array (Value::SET);
+		set->add (Integer (count)).add (Integer (-count));
+		source.poke_back (set);
+		}
+	target.add (Integer (0));
+	Array
+		*inner = new Array;
+	target.poke_back (inner);
+	vector<const Value*>
+		entries;
+	for (Array::iterator
+			value = source.begin ();
+			value != source.end ();
+		  ++value)
+		entries.push_back (&*value);
+
+	inner->move_in (source);
+	bool
+		moved = inner->size () == entries.size ();
+	for (size_t
+			index = 0;
+			moved && index < entries.size ();
+			index++)
+		if (&(*inner)[index] != entries[index] ||
+			(*inner)[index].parent () != inner)
+			moved = false;
+	checker.check ("Array, move_in order and parents.", true, moved);
+	checker.check ("Array, move_in source emptied.",
+		true, source.empty () && source.total_size () == 0);
+	checker.check ("Array, move_in total_size.", 300, (int)inner->total_size ());
+	checker.check ("Array, move_in parent total_size.",
+		302, (int)target.total_size ());
+	checker.check ("Array, depth_iterator after move_in.",
+		(void*)&(*inner)[99][1], (void*)&*(target.end_depth () - 1));
+
+	empty.move_in (*inner);
+	inner->add (Integer (-1));
+	inner->move_in (empty);
+	checker.check ("Array, move_in appended.",
+		true, inner->size () == 101 &&
+			(int)(*inner)[0] == -1 &&
+			&(*inner)[1] == entries[0] &&
+			(*inner)[100].parent () == inner &&
+			target.total_size () == 303);
+
+	Array
+		&set = static_cast<Array&>((*inner)[1]);
+	bool
+		thrown = false;
+	try {set.move_in (target);}
+	catch (Invalid_Argument)
+		{thrown = true;}
+	checker.check ("Array, move_in of a parent throws Invalid_Argument.",
+		true, thrown && target.size () == 2 && inner->parent () == &target &&
+			target.total_size () == 303 && set.size () == 2);
+
+	inner->move_in (*inner);
+	checker.check ("Array, move_in from itself.",
+		true, inner->size () == 101 && inner->total_size () == 301);
+	}
+
 } catch (Exception except)
 	{
 	cout << except.message () << endl;
@@ -604,6 +604,106 @@ if (! checker.check ("*const_reverse_iterator == *reverse_iterator over entire l
 		true, identical))
 	Done ();
 
+//	Move
+unsigned int
+	total = Virtual::Total;
+int
+	size = copy->size ();
+Virtual
+	*last = copy->peek_back ();
+if (checker.Verbose)
+	cout << endl
+		 << "--- Vectal<Virtual> moved (std::move (*copy));" << endl;
+Vectal<Virtual>
+	moved (std::move (*copy));
+checker.check ("move constructor size",
+	size, (int)moved.size ());
+checker.check ("move constructor source emptied",
+	0, (int)copy->size ());
+checker.check ("move constructor values not copied",
+	(void*)last, (void*)moved.peek_back ());
+
+if (checker.Verbose)
+	cout << endl
+		 << "--- *copy = std::move (moved);" << endl;
+*copy = std::move (moved);
+checker.check ("move assignment size",
+	size, (int)copy->size ());
+checker.check ("move assignment source emptied",
+	0, (int)moved.size ());
+checker.check ("move assignment values not copied",
+	(void*)last, (void*)copy->peek_back ());
+checker.check ("no Virtuals constructed by moves",
+	total, Virtual::Total);
+
+if (checker.Verbose)
+	cout << endl
+		 << "--- copy->emplace_back<Actual_A> ();" << endl;
+Actual_A
+	&emplaced = copy->emplace_back<Actual_A> ();
+checker.check ("emplace_back size",
+	size + 1, (int)copy->size ());
+checker.check ("emplace_back value not copied",
+	(void*)&emplaced, (void*)copy->peek_back ());
+checker.check ("emplace_back constructs one Virtual",
+	total + 1, Virtual::Total);
+
+if (checker.Verbose)
+	cout << endl
+		 << "--- copy->adopt (std::unique_ptr<Virtual> (new Actual_B));" << endl;
+last = new Actual_B;
+copy->adopt (std::unique_ptr<Virtual> (last));
+checker.check ("adopt size",
+	size + 2, (int)copy->size ());
+checker.check ("adopt value not copied",
+	(void*)last, (void*)copy->peek_back ());
+checker.check ("adopt constructs no other Virtual",
+	total + 2, Virtual::Total);
+
+if (checker.Verbose)
+	cout << endl
+		 << "--- growing.poke_back (new Actual_A);" << endl;
+Vectal<Virtual>
+	growing;
+checker.check ("default growth policy",
+	(int)Vectal<Virtual>::GEOMETRIC_GROWTH, (int)growing.growth_policy ());
+for (int
+		policy = Vectal<Virtual>::MARGIN_GROWTH;
+	 policy <= Vectal<Virtual>::GEOMETRIC_GROWTH;
+	 policy++)
+	{
+	growing.clear ();
+	growing.growth_policy ((Vectal<Virtual>::Growth_Policy)policy);
+	int
+		reallocations = 0;
+	bool
+		margin = true;
+	Vectal<Virtual>::size_type
+		capacity = growing.capacity ();
+	for (int
+			count = 0;
+		 count < 10000;
+		 count++)
+		{
+		growing.poke_back (new Actual_A);
+		if (growing.capacity () <= growing.size ())
+			margin = false;
+		if (capacity != growing.capacity ())
+			{
+			capacity = growing.capacity ();
+			++reallocations;
+			}
+		}
+	if (policy == Vectal<Virtual>::MARGIN_GROWTH)
+		checker.check ("margin growth reallocations",
+			10000 / VECTAL_CAPACITY_MARGIN + 1, reallocations);
+	else
+		checker.check ("geometric growth reallocations",
+			true, reallocations < 30);
+	checker.check ("capacity exceeds size",
+		true, margin);
+	}
+
 
 Done (0);
 }